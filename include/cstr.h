@@ -10,9 +10,81 @@
 
 #include <Windows.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <stdint.h>
 #include <stdbool.h>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#pragma comment(lib, "Synchronization.lib")
+#endif
+
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define CSTR_HAVE_SSE2 1  ///< SSE2 kernels are available at compile time
+#endif
+
+/**
+ * @def CSTR_TARGET
+ * @brief Compile one function for an instruction set extension
+ *
+ * Lets SSSE3/AVX2 kernels live in a binary built for the baseline target;
+ * callers only run them when cstr_cpu_level() reports the extension.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define CSTR_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CSTR_TARGET(isa)
+#endif
+
+#if defined(CSTR_HAVE_SSE2) && (defined(_MSC_VER) || defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define CSTR_HAVE_SSSE3 1 ///< SSSE3 (pshufb) kernels are compiled in, used when the CPU has SSSE3
+#define CSTR_HAVE_AVX2 1  ///< AVX2 kernels are compiled in, used when the CPU has AVX2
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+/**
+ * @def CSTR_INLINE
+ * @brief Internal linkage inline function (hot accessors, SIMD kernels,
+ *        module-private helpers)
+ */
+#if defined(_MSC_VER) && !defined(__cplusplus)
+#define CSTR_INLINE static __inline
+#else
+#define CSTR_INLINE static inline
+#endif
+
+/**
+ * @def CSTR_API
+ * @brief Linkage of library functions
+ *
+ * By default the headers are self-contained: every function is defined
+ * CSTR_INLINE in each translation unit that includes them. With
+ * CSTR_LIBRARY defined the headers only declare the functions, which are
+ * linked from the compiled cstr library (see CMakeLists.txt). Each
+ * src/cstr_*.c defines CSTR_IMPLEMENT_<MODULE> to compile one module.
+ * CSTR_SHARED marks the functions for export from the shared library.
+ * Only public entry points are CSTR_API; internal helpers are CSTR_INLINE
+ * inside their module's implementation section and are never exported.
+ * The one exception is cstr_lock_acquire_slow(): the inline lock fast path
+ * calls it from user code, so it must be linkable.
+ */
+#if !defined(CSTR_LIBRARY)
+#define CSTR_API CSTR_INLINE
+#elif defined(CSTR_SHARED) && defined(_WIN32) && defined(CSTR_BUILD_LIBRARY)
+#define CSTR_API __declspec(dllexport)
+#elif defined(CSTR_SHARED) && defined(_WIN32)
+#define CSTR_API __declspec(dllimport)
+#elif defined(CSTR_SHARED) && defined(__GNUC__)
+#define CSTR_API __attribute__((visibility("default")))
+#else
+#define CSTR_API
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -24,23 +96,587 @@ extern "C"
      */
     static const size_t cstr_invalid = (size_t)-1;
 
+    /**
+     * @def CSTR_LOCK_SPIN_COUNT
+     * @brief Number of spins before a contended lock parks the thread
+     */
+#ifndef CSTR_LOCK_SPIN_COUNT
+#define CSTR_LOCK_SPIN_COUNT 64
+#endif
+
+#define CSTR_LOCK_LOCKED    0x1  ///< Lock word bit: lock is held
+#define CSTR_LOCK_PARKED    0x2  ///< Lock word bit: at least one thread may be parked
+#define CSTR_LOCK_DEPTH_ONE 0x4  ///< Lock word increment for one level of recursion
+
+#define CSTR_CPU_SCALAR 0  ///< Kernel level: portable C only
+#define CSTR_CPU_SSE2   1  ///< Kernel level: SSE2
+#define CSTR_CPU_SSSE3  2  ///< Kernel level: SSSE3
+#define CSTR_CPU_AVX2   3  ///< Kernel level: AVX2 with OS support for YMM state
+#define CSTR_CPU_AVX512 4  ///< Kernel level: AVX-512 F/BW (runs the AVX2 kernels)
+
+    /**
+     * @struct CStringLock
+     * @brief Compact recursive lock (8 bytes)
+     *
+     * @var state - Lock word: locked/parked bits plus recursion depth
+     * @var owner - Identifier of the owning thread, 0 when free
+     *
+     * @note Spins briefly, then parks on the lock word with WaitOnAddress.
+     *       A zero-filled CStringLock is a valid unlocked lock.
+     */
+    typedef struct
+    {
+        volatile LONG state;   ///< Lock word
+        volatile DWORD owner;  ///< Owning thread identifier
+    }CStringLock;
+
+    /**
+     * @brief Count trailing zero bits
+     * @param value Non-zero value
+     * @return Index of the lowest set bit
+     */
+    CSTR_INLINE unsigned cstr_ctz32(_In_ uint32_t value)
+    {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, value);
+        return (unsigned)index;
+#else
+        return (unsigned)__builtin_ctz(value);
+#endif
+    }
+
+    /**
+     * @brief Count trailing zero bits of a 64-bit value
+     * @param value Non-zero value
+     * @return Index of the lowest set bit
+     */
+    CSTR_INLINE unsigned cstr_ctz64(_In_ uint64_t value)
+    {
+        uint32_t low = (uint32_t)value;
+        return low ? cstr_ctz32(low) : 32 + cstr_ctz32((uint32_t)(value >> 32));
+    }
+
+    /**
+     * @brief Count set bits
+     * @param value Value to inspect
+     * @return Number of one bits
+     */
+    CSTR_INLINE unsigned cstr_popcount64(_In_ uint64_t value)
+    {
+#ifdef _MSC_VER
+        value = value - ((value >> 1) & 0x5555555555555555ULL);
+        value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+        value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return (unsigned)((value * 0x0101010101010101ULL) >> 56);
+#else
+        return (unsigned)__builtin_popcountll(value);
+#endif
+    }
+
+    /**
+     * @brief Decode one UTF-8 sequence
+     * @param data  Input bytes (size > 0)
+     * @param size  Bytes available
+     * @param code  Receives the code point (U+FFFD for malformed input)
+     * @return Bytes consumed (at least 1)
+     */
+    CSTR_INLINE size_t cstr_utf8_next(_In_reads_(size) const uint8_t* data, _In_ size_t size, _Out_ uint32_t* code)
+    {
+        uint8_t c = data[0];
+        size_t length = c >= 0xF0 && c <= 0xF4 ? 4 : c >= 0xE0 ? 3 : c >= 0xC2 && c < 0xE0 ? 2 : 0;
+
+        *code = 0xFFFD;
+
+        if (length == 0 || length > size || c > 0xF4)
+            return 1;
+
+        uint32_t value = c & (0x7F >> length);
+        for (size_t i = 1; i < length; ++i)
+        {
+            if ((data[i] & 0xC0) != 0x80)
+                return 1;
+            value = (value << 6) | (data[i] & 0x3F);
+        }
+
+        // Reject overlong forms, surrogates and values past U+10FFFF
+        if ((length == 3 && (value < 0x800 || (value >= 0xD800 && value <= 0xDFFF))) ||
+            (length == 4 && (value < 0x10000 || value > 0x10FFFF)))
+            return 1;
+
+        *code = value;
+        return length;
+    }
+
+    /**
+     * @brief Encode one code point as UTF-8
+     * @param out  Receives 1 to 4 bytes
+     * @param code Code point (at most U+10FFFF)
+     * @return Bytes written
+     */
+    CSTR_INLINE size_t cstr_utf8_encode(_Out_writes_(4) char* out, _In_ uint32_t code)
+    {
+        if (code < 0x80)
+        {
+            out[0] = (char)code;
+            return 1;
+        }
+
+        if (code < 0x800)
+        {
+            out[0] = (char)(0xC0 | (code >> 6));
+            out[1] = (char)(0x80 | (code & 0x3F));
+            return 2;
+        }
+
+        if (code < 0x10000)
+        {
+            out[0] = (char)(0xE0 | (code >> 12));
+            out[1] = (char)(0x80 | ((code >> 6) & 0x3F));
+            out[2] = (char)(0x80 | (code & 0x3F));
+            return 3;
+        }
+
+        out[0] = (char)(0xF0 | (code >> 18));
+        out[1] = (char)(0x80 | ((code >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((code >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (code & 0x3F));
+        return 4;
+    }
+
+    /**
+     * @brief Length of the leading run of ASCII bytes
+     * @param data Input bytes
+     * @param size Input length
+     * @return Offset of the first byte >= 0x80, or size if none
+     */
+    CSTR_INLINE size_t cstr_ascii_run(_In_reads_(size) const uint8_t* data, _In_ size_t size)
+    {
+        size_t i = 0;
+
+#ifdef CSTR_HAVE_SSE2
+        for (; i + 16 <= size; i += 16)
+        {
+            int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(data + i)));
+            if (mask)
+                return i + cstr_ctz32((uint32_t)mask);
+        }
+#endif
+
+        while (i < size && data[i] < 0x80)
+            ++i;
+
+        return i;
+    }
+
+    /**
+     * @brief Buffer allocation callback
+     * @param context  CStringAllocator::context
+     * @param data     Buffer to resize, or NULL to allocate
+     * @param old_size Current size of data (0 if NULL)
+     * @param new_size Requested size, or 0 to free data
+     * @return Buffer holding the first min(old_size, new_size) bytes of data,
+     *         or NULL on failure (data stays valid) or after freeing. New
+     *         buffers must be aligned for a pointer, like malloc()
+     */
+    typedef void* (*CStringReallocFn)(void* context, void* data, size_t old_size, size_t new_size);
+
+    /**
+     * @struct CStringAllocator
+     * @brief Source of CString buffers
+     *
+     * @var reallocate - Allocation callback, NULL for malloc/realloc/free
+     * @var context    - Passed to reallocate (e.g. an arena)
+     *
+     * @note A zero-initialized allocator uses the C heap. Arena callbacks may
+     *       ignore frees: memory is then released with the arena. Every buffer
+     *       starts with a copy of its allocator, so the struct passed in need
+     *       not outlive the strings.
+     */
+    typedef struct
+    {
+        CStringReallocFn reallocate; ///< Allocation callback
+        void* context;               ///< Callback state
+    }CStringAllocator;
+
     /**
      * @struct CString
      * @brief Thread-safe dynamic string container
      *
-     * @var data     - Pointer to null-terminated character buffer
-     * @var length   - Current string length (excluding null-terminator)
-     * @var capacity - Total allocated buffer size
-     * @var cs       - Critical section for thread synchronization
+     * @var data      - Pointer to null-terminated character buffer
+     * @var length    - Current string length (excluding null-terminator)
+     * @var capacity  - Total allocated buffer size
+     * @var lock      - Recursive lock for thread synchronization
+     *
+     * @note 32 bytes on 64-bit targets. The allocator a buffer came from is
+     *       stored in front of data (see cstr_buffer_allocator()) and is used
+     *       for growth, substrings and tokens.
      */
     typedef struct
     {
-        char* data;           ///< Character buffer
-        size_t length;        ///< Current string length
-        size_t capacity;      ///< Allocated buffer size
-        CRITICAL_SECTION cs;  ///< Thread synchronization primitive
+        char* data;                 ///< Character buffer
+        size_t length;              ///< Current string length
+        size_t capacity;            ///< Allocated buffer size
+        CStringLock lock;           ///< Thread synchronization primitive
     }CString;
 
+    /**
+     * @struct CStringView
+     * @brief Non-owning reference to a character range
+     *
+     * @var data   - Pointer to first character (not necessarily null-terminated)
+     * @var length - Number of characters in the range
+     */
+    typedef struct
+    {
+        const char* data;     ///< First character
+        size_t length;        ///< Number of characters
+    }CStringView;
+
+    /**
+     * @struct CStringKernels
+     * @brief SIMD kernel families bound to the CPU level (see cstr_kernels())
+     *
+     * @var find     - Offset of needle in haystack, or CSTR_INVALID
+     *                 (requires 1 <= needle_length)
+     * @var case_map - ASCII upper/lower case in place; blocks with other bytes
+     *                 go through toupper()/tolower()
+     * @var span     - Length of the prefix whose bytes are (in_set) or are not
+     *                 (!in_set) among the set_size bytes of set
+     */
+    typedef struct
+    {
+        size_t (*find)(const char* haystack, size_t haystack_length, const char* needle, size_t needle_length); ///< Substring search
+        void (*case_map)(char* data, size_t size, bool upper);                                                ///< Case conversion
+        size_t (*span)(const char* data, size_t size, const char* set, size_t set_size, bool in_set);         ///< Byte set scan
+    }CStringKernels;
+
+    CSTR_API void cstr_lock_acquire_slow(_Inout_ CStringLock* lock);
+    CSTR_API char* cstr_strdup(_In_ const char* str);
+    CSTR_API wchar_t* cstr_wcsdup(_In_ const wchar_t* str);
+    CSTR_API wchar_t* cstr_chars2wchars(_In_ const char* str, _In_ size_t cp);
+    CSTR_API bool cstr_create_ex(_Inout_ CString* obj, _In_opt_ const CStringAllocator* allocator);
+    CSTR_API bool cstr_create(_Inout_ CString* obj);
+    CSTR_API bool cstr_create_from_cstr_ex(_Inout_ CString* obj, _In_ CString* obj2, _In_opt_ const CStringAllocator* allocator);
+    CSTR_API bool cstr_create_from_cstr(_Inout_ CString* obj, _In_ CString* obj2);
+    CSTR_API bool cstr_create_from_chars_ex(_Inout_ CString* obj, _In_ const char* data, _In_opt_ const CStringAllocator* allocator);
+    CSTR_API bool cstr_create_from_chars(_Inout_ CString* obj, _In_ const char* data);
+    CSTR_API bool cstr_create_from_wchars_ex(_Inout_ CString* obj, _In_ const wchar_t* data, _In_opt_ const CStringAllocator* allocator);
+    CSTR_API bool cstr_create_from_wchars(_Inout_ CString* obj, _In_ const wchar_t* data);
+    CSTR_API bool cstr_create_from_buffer_ex(_Inout_ CString* obj, _In_reads_(size) const uint8_t* buffer, _In_ size_t size, _In_opt_ const CStringAllocator* allocator);
+    CSTR_API bool cstr_create_from_buffer(_Inout_ CString* obj, _In_ uint8_t* buffer, _In_ size_t size);
+    CSTR_API bool cstr_destroy(_In_ CString* obj);
+    CSTR_API boolean cstr_at(_In_ CString* obj, _In_ size_t index, _Inout_ char* chr);
+    CSTR_API char cstr_get(_In_ CString* obj, _In_ size_t index);
+    CSTR_API char cstr_front(_In_ CString* obj);
+    CSTR_API char cstr_back(_In_ CString* obj);
+    CSTR_API CStringView cstr_view_from_chars(_In_ const char* data);
+    CSTR_API int cstr_view_compare(_In_ CStringView a, _In_ CStringView b);
+    CSTR_API uint64_t cstr_view_hash(_In_ CStringView view);
+    CSTR_API unsigned cstr_cpu_detect(void);
+    CSTR_API unsigned cstr_cpu_level(void);
+    CSTR_API const CStringKernels* cstr_kernels(void);
+    CSTR_API size_t cstr_view_find(_In_ CStringView haystack, _In_ CStringView needle);
+    CSTR_API bool cstr_resize(_In_ CString* obj, _In_ size_t size);
+    CSTR_API bool cstr_reserve(_In_ CString* obj, _In_ size_t length);
+    CSTR_API bool cstr_shrink_to_fit(_In_ CString* obj);
+    CSTR_API bool cstr_clear(_In_ CString* obj);
+    CSTR_API bool cstr_push_back_char(_In_ CString* obj, _In_ char chr);
+    CSTR_API bool cstr_push_back_wchar(_In_ CString* obj, _In_ wchar_t chr);
+    CSTR_API bool cstr_pop_back(_In_ CString* obj);
+    CSTR_API bool cstr_append_cstr(_In_ CString* obj, _In_ CString* obj2);
+    CSTR_API bool cstr_append_chars(_In_ CString* obj, _In_ const char* data);
+    CSTR_API bool cstr_append_wchars(_In_ CString* obj, _In_ const wchar_t* data);
+    CSTR_API bool cstr_append_views(_In_ CString* obj, _In_reads_(count) const CStringView* parts, _In_ size_t count);
+    CSTR_API bool cstr_concat(_In_ CString* obj, _In_ size_t count, ...);
+    CSTR_API bool cstr_substring(_In_ CString* obj, _Inout_ CString* dest, _In_ size_t start, _In_ size_t length);
+    CSTR_API bool cstr_erase(_In_ CString* obj, _In_ size_t index, _In_ size_t size);
+    CSTR_API bool cstr_insert(_In_ CString* obj, _In_ size_t index, _In_ char chr);
+    CSTR_API bool cstr_swap(_In_ CString* obj, _In_ CString* obj2);
+    CSTR_API size_t cstr_find_cstr(_In_ CString* obj, _In_ CString* obj2);
+    CSTR_API size_t cstr_find_chars(_In_ CString* obj, _In_ const char* data);
+    CSTR_API size_t cstr_find_wchars(_In_ CString* obj, _In_ const wchar_t* data);
+    CSTR_API bool cstr_to_upper(_In_ CString* obj);
+    CSTR_API bool cstr_to_lower(_In_ CString* obj);
+    CSTR_API bool cstr_trim(_In_ CString* obj);
+    CSTR_API bool cstr_scan_token(_In_reads_(len) const char* data, _In_ size_t len, _In_ const char* delimiters, _Inout_ size_t* start_pos, _Out_ CStringView* token);
+    CSTR_API bool cstr_scan_token_ex(_In_reads_(len) const char* data, _In_ size_t len, _In_ const char* delimiters, _In_ const char* zone_pairs, _In_ const char* escape_chars, _Inout_ size_t* start_pos, _Out_ CStringView* token);
+    CSTR_API bool cstr_tokenize(_In_ CString* obj, _Inout_ CString* token, _In_ const char* delimiters, _Inout_ size_t* start_pos);
+    CSTR_API bool cstr_tokenize_ex(_In_ CString* obj, _Inout_ CString* token, _In_ const char* delimiters, _In_ const char* zone_pairs, _In_ const char* escape_chars, _Inout_ size_t* start_pos);
+
+    /**
+     * @brief Initialize lock in unlocked state
+     * @param lock Lock to initialize
+     */
+    CSTR_INLINE void cstr_lock_init(_Out_ CStringLock* lock)
+    {
+        lock->state = 0;
+        lock->owner = 0;
+    }
+
+    /**
+     * @brief Acquire lock (recursive)
+     * @param lock Lock to acquire
+     */
+    CSTR_INLINE void cstr_lock_acquire(_Inout_ CStringLock* lock)
+    {
+        DWORD self = GetCurrentThreadId();
+
+        if (lock->owner == self)
+        {
+            InterlockedExchangeAdd(&lock->state, CSTR_LOCK_DEPTH_ONE);
+            return;
+        }
+
+        if (InterlockedCompareExchange(&lock->state, CSTR_LOCK_LOCKED, 0) != 0)
+            cstr_lock_acquire_slow(lock);
+
+        lock->owner = self;
+    }
+
+    /**
+     * @brief Release lock
+     * @param lock Lock held by the calling thread
+     * @note Wakes one parked thread when the outermost level is released
+     */
+    CSTR_INLINE void cstr_lock_release(_Inout_ CStringLock* lock)
+    {
+        if ((lock->state & ~(LONG)(CSTR_LOCK_LOCKED | CSTR_LOCK_PARKED)) != 0)
+        {
+            InterlockedExchangeAdd(&lock->state, -CSTR_LOCK_DEPTH_ONE);
+            return;
+        }
+
+        lock->owner = 0;
+
+        if (InterlockedExchange(&lock->state, 0) & CSTR_LOCK_PARKED)
+            WakeByAddressSingle((PVOID)&lock->state);
+    }
+
+    /**
+     * @brief Acquire exclusive access
+     * @param obj CString object
+     */
+    CSTR_INLINE void cstr_lock(_In_ CString* obj)
+    {
+        if (obj)
+            cstr_lock_acquire(&obj->lock);
+    }
+
+    /**
+     * @brief Release exclusive access
+     * @param obj CString object
+     */
+    CSTR_INLINE void cstr_unlock(_In_ CString* obj)
+    {
+        if (obj)
+            cstr_lock_release(&obj->lock);
+    }
+
+    /**
+     * @brief Get current string length
+     * @param obj CString object
+     * @return Length in bytes or CSTR_INVALID
+     */
+    CSTR_INLINE size_t cstr_length(_In_ CString* obj)
+    {
+        if (!obj)
+            return cstr_invalid;
+
+        cstr_lock(obj);
+
+        size_t out = obj->length;
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Get allocated buffer capacity
+     * @param obj CString object
+     * @return Capacity in bytes or CSTR_INVALID
+     */
+    CSTR_INLINE size_t cstr_capacity(_In_ CString* obj)
+    {
+        if (!obj)
+            return cstr_invalid;
+
+        cstr_lock(obj);
+
+        size_t out = obj->capacity;
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Check if string is empty
+     * @param obj CString object
+     * @return true if empty, false otherwise
+     */
+    CSTR_INLINE bool cstr_empty(_In_ CString* obj)
+    {
+        if (!obj)
+            return false;
+
+        cstr_lock(obj);
+
+        bool out = obj->data == NULL || obj->length == 0;
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Get raw character buffer
+     * @param obj CString object
+     * @return Pointer to internal buffer
+     * @warning Buffer valid until next modifying operation
+     */
+    CSTR_INLINE char* cstr_data(_In_ CString* obj)
+    {
+        if (!obj)
+            return 0;
+
+        cstr_lock(obj);
+
+        char* out = obj->data;
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Get view of string contents
+     * @param obj CString object
+     * @return View over the internal buffer (empty view for NULL)
+     * @warning View valid until next modifying operation
+     */
+    CSTR_INLINE CStringView cstr_view(_In_ CString* obj)
+    {
+        CStringView out = { NULL, 0 };
+
+        if (!obj)
+            return out;
+
+        cstr_lock(obj);
+
+        out.data = obj->data;
+        out.length = obj->length;
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Allocator of a CString buffer
+     * @param data CString::data (may be NULL)
+     * @return Copy stored in front of data, or NULL for the C heap when there is no buffer
+     */
+    CSTR_INLINE const CStringAllocator* cstr_buffer_allocator(_In_opt_ const char* data)
+    {
+        return data ? (const CStringAllocator*)data - 1 : NULL;
+    }
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_CORE)
+
+    /**
+     * @brief Contended path of cstr_lock_acquire()
+     * @param lock Lock to acquire
+     * @note Spins CSTR_LOCK_SPIN_COUNT times, then parks until woken
+     */
+    void cstr_lock_acquire_slow(_Inout_ CStringLock* lock)
+    {
+        for (int spin = 0; spin < CSTR_LOCK_SPIN_COUNT; ++spin)
+        {
+            if (lock->state == 0 && InterlockedCompareExchange(&lock->state, CSTR_LOCK_LOCKED, 0) == 0)
+                return;
+            YieldProcessor();
+        }
+
+        for (;;)
+        {
+            LONG state = lock->state;
+
+            if (state == 0)
+            {
+                // Another thread may still be parked, so keep the parked bit
+                if (InterlockedCompareExchange(&lock->state, CSTR_LOCK_LOCKED | CSTR_LOCK_PARKED, 0) == 0)
+                    return;
+                continue;
+            }
+
+            if (!(state & CSTR_LOCK_PARKED))
+            {
+                if (InterlockedCompareExchange(&lock->state, state | CSTR_LOCK_PARKED, state) != state)
+                    continue;
+                state |= CSTR_LOCK_PARKED;
+            }
+
+            WaitOnAddress(&lock->state, &state, sizeof(state), INFINITE);
+        }
+    }
+
+    /**
+     * @brief Allocate, resize or free a buffer through an allocator
+     * @param allocator Allocator (NULL or zero-initialized for the C heap)
+     * @param data      Buffer to resize, or NULL to allocate
+     * @param old_size  Current size of data
+     * @param new_size  Requested size, or 0 to free data
+     * @return New buffer, or NULL on failure (data stays valid) or after freeing
+     */
+    CSTR_INLINE void* cstr_reallocate(_In_opt_ const CStringAllocator* allocator, _In_opt_ void* data, _In_ size_t old_size, _In_ size_t new_size)
+    {
+        if (allocator && allocator->reallocate)
+            return allocator->reallocate(allocator->context, data, old_size, new_size);
+
+        if (new_size == 0)
+        {
+            free(data);
+            return NULL;
+        }
+
+        return realloc(data, new_size);
+    }
+
+    /**
+     * @brief Allocate, resize or free a CString buffer
+     * @param allocator Allocator for a new buffer (ignored when data is not NULL)
+     * @param data      Buffer to resize, or NULL to allocate
+     * @param old_size  Current size of data
+     * @param new_size  Requested size, or 0 to free data
+     * @return New buffer, or NULL on failure (data stays valid) or after freeing
+     * @note Each allocation holds a copy of its allocator followed by the
+     *       buffer, so the allocator travels with the buffer
+     */
+    CSTR_INLINE char* cstr_buffer_reallocate(_In_opt_ const CStringAllocator* allocator, _In_opt_ char* data, _In_ size_t old_size, _In_ size_t new_size)
+    {
+        CStringAllocator owner = { NULL, NULL };
+        if (data)
+            owner = *cstr_buffer_allocator(data);
+        else if (allocator)
+            owner = *allocator;
+
+        if (new_size > cstr_invalid - sizeof(CStringAllocator))
+            return NULL;
+
+        CStringAllocator* base = (CStringAllocator*)cstr_reallocate(&owner,
+            data ? (CStringAllocator*)data - 1 : NULL,
+            data ? old_size + sizeof(CStringAllocator) : 0,
+            new_size ? new_size + sizeof(CStringAllocator) : 0);
+        if (!base)
+            return NULL;
+
+        *base = owner;
+
+        return (char*)(base + 1);
+    }
+
     /**
      * @brief Duplicate null-terminated C string
      * @param str Source string to copy
@@ -94,6 +730,33 @@ extern "C"
         return buf;
     }
 
+    /**
+     * @brief Initialize a new empty CString with a custom allocator
+     * @param obj       Pointer to CString object to initialize
+     * @param allocator Allocator for all buffers of obj (copied; NULL for the C heap)
+     * @return true on success, false on allocation failure
+     * @note Creates empty string with capacity 1
+     */
+    bool cstr_create_ex(_Inout_ CString* obj, _In_opt_ const CStringAllocator* allocator)
+    {
+        if (!obj)
+            return false;
+
+        char* data = cstr_buffer_reallocate(allocator, NULL, 0, 1);
+        if (data == NULL)
+            return false;
+
+        data[0] = '\0';
+
+        obj->data = data;
+        obj->length = 0;
+        obj->capacity = 1;
+
+        cstr_lock_init(&obj->lock);
+
+        return true;
+    }
+
     /**
      * @brief Initialize a new empty CString
      * @param obj Pointer to CString object to initialize
@@ -102,20 +765,39 @@ extern "C"
      */
     bool cstr_create(_Inout_ CString* obj)
     {
-        if (!obj)
+        return cstr_create_ex(obj, NULL);
+    }
+
+    /**
+     * @brief Create CString copy from another CString with a custom allocator
+     * @param obj       Destination CString
+     * @param obj2      Source CString
+     * @param allocator Allocator for all buffers of obj (copied; NULL for the C heap)
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_create_from_cstr_ex(_Inout_ CString* obj, _In_ CString* obj2, _In_opt_ const CStringAllocator* allocator)
+    {
+        if (!obj || !obj2)
             return false;
 
-        char* data = (char*)malloc(1);
+        cstr_lock(obj2);
+
+        char* data = cstr_buffer_reallocate(allocator, NULL, 0, obj2->length + 1);
         if (data == NULL)
+        {
+            cstr_unlock(obj2);
             return false;
+        }
 
-        data[0] = '\0';
+        memcpy(data, obj2->data, obj2->length + 1);
 
         obj->data = data;
-        obj->length = 0;
-        obj->capacity = 1;
+        obj->length = obj2->length;
+        obj->capacity = obj2->length + 1;
+
+        cstr_unlock(obj2);
 
-        InitializeCriticalSection(&obj->cs);
+        cstr_lock_init(&obj->lock);
 
         return true;
     }
@@ -128,14 +810,33 @@ extern "C"
      */
     bool cstr_create_from_cstr(_Inout_ CString* obj, _In_ CString* obj2)
     {
-        if (!obj || !obj2)
+        return cstr_create_from_cstr_ex(obj, obj2, NULL);
+    }
+
+    /**
+     * @brief Create CString from null-terminated C string with a custom allocator
+     * @param obj       Destination CString
+     * @param data      Source C string
+     * @param allocator Allocator for all buffers of obj (copied; NULL for the C heap)
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_create_from_chars_ex(_Inout_ CString* obj, _In_ const char* data, _In_opt_ const CStringAllocator* allocator)
+    {
+        if (!obj || !data)
             return false;
 
-        obj->data = cstr_strdup(obj2->data);
-        obj->length = obj2->length;
-        obj->capacity = obj2->capacity;
+        size_t length = strlen(data);
+        char* buffer = cstr_buffer_reallocate(allocator, NULL, 0, length + 1);
+        if (buffer == NULL)
+            return false;
+
+        memcpy(buffer, data, length + 1);
+
+        obj->data = buffer;
+        obj->length = length;
+        obj->capacity = length + 1;
 
-        InitializeCriticalSection(&obj->cs);
+        cstr_lock_init(&obj->lock);
 
         return true;
     }
@@ -148,26 +849,18 @@ extern "C"
      */
     bool cstr_create_from_chars(_Inout_ CString* obj, _In_ const char* data)
     {
-        if (!obj || !data)
-            return false;
-
-        obj->data = cstr_strdup(data);
-        obj->length = strlen(data);
-        obj->capacity = obj->length + 1;
-
-        InitializeCriticalSection(&obj->cs);
-
-        return true;
+        return cstr_create_from_chars_ex(obj, data, NULL);
     }
 
     /**
-     * @brief Create CString from wide character string
-     * @param obj  Destination CString
-     * @param data Source wide string
+     * @brief Create CString from wide character string with a custom allocator
+     * @param obj       Destination CString
+     * @param data      Source wide string
+     * @param allocator Allocator for all buffers of obj (copied; NULL for the C heap)
      * @return true on success, false on conversion/allocation failure
      * @note Uses WideCharToMultiByte with ANSI code page
      */
-    bool cstr_create_from_wchars(_Inout_ CString* obj, _In_ const wchar_t* data)
+    bool cstr_create_from_wchars_ex(_Inout_ CString* obj, _In_ const wchar_t* data, _In_opt_ const CStringAllocator* allocator)
     {
         if (!obj || !data)
             return false;
@@ -176,13 +869,13 @@ extern "C"
         if (len == 0)
             return false;
 
-        char* mb_data = (char*)malloc(len);
+        char* mb_data = cstr_buffer_reallocate(allocator, NULL, 0, (size_t)len);
         if (!mb_data)
             return false;
 
         if (!WideCharToMultiByte(CP_ACP, 0, data, -1, mb_data, len, NULL, NULL))
         {
-            free(mb_data);
+            cstr_buffer_reallocate(NULL, mb_data, (size_t)len, 0);
             return false;
         }
 
@@ -190,40 +883,66 @@ extern "C"
         obj->length = strlen(mb_data);
         obj->capacity = len;
 
-        InitializeCriticalSection(&obj->cs);
+        cstr_lock_init(&obj->lock);
 
         return true;
     }
 
     /**
-     * @brief Create CString from binary buffer
-     * @param obj    Destination CString
-     * @param buffer Source binary data
-     * @param size   Number of bytes to copy
+     * @brief Create CString from wide character string
+     * @param obj  Destination CString
+     * @param data Source wide string
+     * @return true on success, false on conversion/allocation failure
+     * @note Uses WideCharToMultiByte with ANSI code page
+     */
+    bool cstr_create_from_wchars(_Inout_ CString* obj, _In_ const wchar_t* data)
+    {
+        return cstr_create_from_wchars_ex(obj, data, NULL);
+    }
+
+    /**
+     * @brief Create CString from binary buffer with a custom allocator
+     * @param obj       Destination CString
+     * @param buffer    Source binary data
+     * @param size      Number of bytes to copy
+     * @param allocator Allocator for all buffers of obj (copied; NULL for the C heap)
      * @return true on success, false on allocation failure
      * @note Adds null-terminator after buffer contents
      */
-    bool cstr_create_from_buffer(_Inout_ CString* obj, _In_ uint8_t* buffer, _In_ size_t size)
+    bool cstr_create_from_buffer_ex(_Inout_ CString* obj, _In_reads_(size) const uint8_t* buffer, _In_ size_t size, _In_opt_ const CStringAllocator* allocator)
     {
-        if (!obj || !buffer)
+        if (!obj || !buffer || size == cstr_invalid)
             return false;
 
-        char* data = (char*)malloc(size + 1);
+        char* data = cstr_buffer_reallocate(allocator, NULL, 0, size + 1);
         if (data == NULL)
             return false;
 
-        memcpy(data, (void*)buffer, size);
+        memcpy(data, (const void*)buffer, size);
         data[size] = '\0';
 
         obj->data = data;
         obj->length = size;
         obj->capacity = size + 1;
 
-        InitializeCriticalSection(&obj->cs);
+        cstr_lock_init(&obj->lock);
 
         return true;
     }
 
+    /**
+     * @brief Create CString from binary buffer
+     * @param obj    Destination CString
+     * @param buffer Source binary data
+     * @param size   Number of bytes to copy
+     * @return true on success, false on allocation failure
+     * @note Adds null-terminator after buffer contents
+     */
+    bool cstr_create_from_buffer(_Inout_ CString* obj, _In_ uint8_t* buffer, _In_ size_t size)
+    {
+        return cstr_create_from_buffer_ex(obj, buffer, size, NULL);
+    }
+
     /**
      * @brief Destroy CString and release resources
      * @param obj CString to destroy
@@ -238,38 +957,16 @@ extern "C"
         if (obj->data)
         {
             SecureZeroMemory(obj->data, obj->capacity);
-            free(obj->data);
+            cstr_buffer_reallocate(NULL, obj->data, obj->capacity, 0);
             obj->data = NULL;
         }
 
-        DeleteCriticalSection(&obj->cs);
-
         obj->length = 0;
         obj->capacity = 0;
 
         return true;
     }
 
-    /**
-     * @brief Acquire exclusive access
-     * @param obj CString object
-     */
-    void cstr_lock(_In_ CString* obj)
-    {
-        if (obj)
-            EnterCriticalSection(&obj->cs);
-    }
-
-    /**
-     * @brief Release exclusive access
-     * @param obj CString object
-     */
-    void cstr_unlock(_In_ CString* obj)
-    {
-        if (obj)
-            LeaveCriticalSection(&obj->cs);
-    }
-
     /**
      * @brief Get character at specific index
      * @param obj   CString object
@@ -358,80 +1055,463 @@ extern "C"
     }
 
     /**
-     * @brief Get raw character buffer
-     * @param obj CString object
-     * @return Pointer to internal buffer
-     * @warning Buffer valid until next modifying operation
+     * @brief Create view over null-terminated C string
+     * @param data Source C string
+     * @return View over data (empty view for NULL)
      */
-    char* cstr_data(_In_ CString* obj)
+    CStringView cstr_view_from_chars(_In_ const char* data)
     {
-        if (!obj)
-            return 0;
+        CStringView out = { data, data ? strlen(data) : 0 };
+        return out;
+    }
 
-        cstr_lock(obj);
+    /**
+     * @brief Binary-safe lexicographic comparison of two views
+     * @param a First view
+     * @param b Second view
+     * @return Negative, zero or positive like memcmp()
+     * @note A proper prefix orders before the longer string
+     */
+    int cstr_view_compare(_In_ CStringView a, _In_ CStringView b)
+    {
+        size_t n = a.length < b.length ? a.length : b.length;
+        int cmp = n ? memcmp(a.data, b.data, n) : 0;
 
-        char* out = obj->data;
+        if (cmp != 0)
+            return cmp;
 
-        cstr_unlock(obj);
+        return (a.length > b.length) - (a.length < b.length);
+    }
 
-        return out;
+    /**
+     * @brief Hash the contents of a view
+     * @param view Characters to hash
+     * @return 64-bit hash (not cryptographic; equal views hash equally)
+     * @note Mixes 8 bytes per multiply; the tail is folded in with one partial load
+     */
+    uint64_t cstr_view_hash(_In_ CStringView view)
+    {
+        const uint64_t k = 0x9E3779B97F4A7C15ULL;
+        const unsigned char* p = (const unsigned char*)view.data;
+        size_t n = view.length;
+        uint64_t h = (uint64_t)n * k;
+
+        for (; n >= 8; n -= 8, p += 8)
+        {
+            uint64_t word;
+            memcpy(&word, p, 8);
+            h = (h ^ word) * k;
+            h ^= h >> 29;
+        }
+
+        if (n)
+        {
+            uint64_t word = 0;
+            memcpy(&word, p, n);
+            h = (h ^ word) * k;
+        }
+
+        // Final avalanche (MurmurHash3 fmix64)
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ULL;
+        h ^= h >> 33;
+
+        return h;
     }
 
     /**
-     * @brief Get current string length
-     * @param obj CString object
-     * @return Length in bytes or CSTR_INVALID
+     * @brief Highest kernel level supported by the CPU and operating system
+     * @return CSTR_CPU_* level
+     * @note Reads the cpuid feature bits; AVX levels also require the OS to
+     *       save YMM/ZMM state (xgetbv)
+     */
+    unsigned cstr_cpu_detect(void)
+    {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+        unsigned leaf1[4] = { 0 };  // eax, ebx, ecx, edx
+        unsigned leaf7[4] = { 0 };
+        uint64_t xcr0 = 0;
+
+#ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 0);
+        unsigned max_leaf = (unsigned)info[0];
+
+        __cpuid(info, 1);
+        for (int k = 0; k < 4; ++k)
+            leaf1[k] = (unsigned)info[k];
+
+        if (max_leaf >= 7)
+        {
+            __cpuidex(info, 7, 0);
+            for (int k = 0; k < 4; ++k)
+                leaf7[k] = (unsigned)info[k];
+        }
+
+        if (leaf1[2] & (1u << 27))
+            xcr0 = _xgetbv(0);
+#else
+        unsigned max_leaf = __get_cpuid_max(0, NULL);
+
+        __cpuid(1, leaf1[0], leaf1[1], leaf1[2], leaf1[3]);
+
+        if (max_leaf >= 7)
+            __cpuid_count(7, 0, leaf7[0], leaf7[1], leaf7[2], leaf7[3]);
+
+        if (leaf1[2] & (1u << 27))
+        {
+            uint32_t low, high;
+            __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+            xcr0 = ((uint64_t)high << 32) | low;
+        }
+#endif
+
+        unsigned level = CSTR_CPU_SCALAR;
+
+        if (leaf1[3] & (1u << 26))
+            level = CSTR_CPU_SSE2;
+        if (level == CSTR_CPU_SSE2 && (leaf1[2] & (1u << 9)))
+            level = CSTR_CPU_SSSE3;
+        if (level == CSTR_CPU_SSSE3 && (xcr0 & 0x6) == 0x6 && (leaf1[2] & (1u << 28)) && (leaf7[1] & (1u << 5)))
+            level = CSTR_CPU_AVX2;
+        if (level == CSTR_CPU_AVX2 && (xcr0 & 0xE6) == 0xE6 && (leaf7[1] & (1u << 16)) && (leaf7[1] & (1u << 30)))
+            level = CSTR_CPU_AVX512;
+
+        return level;
+#else
+        return CSTR_CPU_SCALAR;
+#endif
+    }
+
+    /**
+     * @brief Kernel level used by the process
+     * @return CSTR_CPU_* level
+     * @note Detected once. The CSTR_CPU_LEVEL environment variable ("scalar",
+     *       "sse2", "ssse3", "avx2", "avx512" or 0-4) lowers the level so every
+     *       kernel can be tested and benchmarked on one machine; it never
+     *       raises it above what the CPU supports
+     */
+    unsigned cstr_cpu_level(void)
+    {
+        static volatile LONG cached = -1;
+
+        LONG level = cached;
+        if (level >= 0)
+            return (unsigned)level;
+
+        static const char* const names[] = { "scalar", "sse2", "ssse3", "avx2", "avx512" };
+        char value[16];
+        DWORD length = GetEnvironmentVariableA("CSTR_CPU_LEVEL", value, sizeof(value));
+
+        level = (LONG)cstr_cpu_detect();
+
+        if (length > 0 && length < sizeof(value))
+        {
+            for (LONG forced = CSTR_CPU_SCALAR; forced <= CSTR_CPU_AVX512; ++forced)
+            {
+                if (strcmp(value, names[forced]) == 0 || (value[0] == '0' + forced && value[1] == '\0'))
+                {
+                    if (forced < level)
+                        level = forced;
+                    break;
+                }
+            }
+        }
+
+        InterlockedExchange(&cached, level);
+
+        return (unsigned)level;
+    }
+
+    /**
+     * @brief Portable substring search (memchr() on the first needle byte)
+     */
+    CSTR_INLINE size_t cstr_find_scalar(_In_reads_(haystack_length) const char* haystack, _In_ size_t haystack_length, _In_reads_(needle_length) const char* needle, _In_ size_t needle_length)
+    {
+        if (needle_length > haystack_length)
+            return cstr_invalid;
+
+        const char* p = haystack;
+        const char* end = haystack + (haystack_length - needle_length) + 1;
+
+        while (p < end)
+        {
+            p = (const char*)memchr(p, needle[0], (size_t)(end - p));
+            if (!p)
+                break;
+            if (memcmp(p + 1, needle + 1, needle_length - 1) == 0)
+                return (size_t)(p - haystack);
+            p++;
+        }
+
+        return cstr_invalid;
+    }
+
+    /**
+     * @brief Portable case conversion through toupper()/tolower()
+     */
+    CSTR_INLINE void cstr_case_map_scalar(_Inout_updates_(size) char* data, _In_ size_t size, _In_ bool upper)
+    {
+        for (size_t i = 0; i < size; ++i)
+            data[i] = (char)(upper ? toupper((unsigned char)data[i]) : tolower((unsigned char)data[i]));
+    }
+
+    /**
+     * @brief Portable byte set scan
+     */
+    CSTR_INLINE size_t cstr_span_scalar(_In_reads_(size) const char* data, _In_ size_t size, _In_reads_(set_size) const char* set, _In_ size_t set_size, _In_ bool in_set)
+    {
+        size_t i = 0;
+
+        while (i < size && (memchr(set, data[i], set_size) != NULL) == in_set)
+            ++i;
+
+        return i;
+    }
+
+#ifdef CSTR_HAVE_SSE2
+    /**
+     * @brief SSE2 substring search: 16 candidates filtered on the first and last needle byte
+     */
+    CSTR_INLINE size_t cstr_find_sse2(_In_reads_(haystack_length) const char* haystack, _In_ size_t haystack_length, _In_reads_(needle_length) const char* needle, _In_ size_t needle_length)
+    {
+        if (needle_length < 2 || needle_length > haystack_length)
+            return cstr_find_scalar(haystack, haystack_length, needle, needle_length);
+
+        const char* p = haystack;
+        const char* end = haystack + (haystack_length - needle_length) + 1;
+        const __m128i first = _mm_set1_epi8(needle[0]);
+        const __m128i last = _mm_set1_epi8(needle[needle_length - 1]);
+
+        for (; p + 16 <= end; p += 16)
+        {
+            __m128i head = _mm_loadu_si128((const __m128i*)p);
+            __m128i tail = _mm_loadu_si128((const __m128i*)(p + needle_length - 1));
+            uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last)));
+
+            while (mask)
+            {
+                unsigned bit = cstr_ctz32(mask);
+                if (memcmp(p + bit + 1, needle + 1, needle_length - 2) == 0)
+                    return (size_t)(p + bit - haystack);
+                mask &= mask - 1;
+            }
+        }
+
+        size_t found = cstr_find_scalar(p, (size_t)(end - p) + needle_length - 1, needle, needle_length);
+        return found == cstr_invalid ? cstr_invalid : (size_t)(p - haystack) + found;
+    }
+
+    /**
+     * @brief SSE2 case conversion, 16 bytes per step
+     */
+    CSTR_INLINE void cstr_case_map_sse2(_Inout_updates_(size) char* data, _In_ size_t size, _In_ bool upper)
+    {
+        const __m128i flip = _mm_set1_epi8(0x20);
+        const __m128i below = _mm_set1_epi8(upper ? 'a' - 1 : 'A' - 1);
+        const __m128i above = _mm_set1_epi8(upper ? 'z' + 1 : 'Z' + 1);
+        size_t i = 0;
+
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+
+            // Bytes >= 0x80 may be letters of the current locale
+            if (_mm_movemask_epi8(v))
+            {
+                cstr_case_map_scalar(data + i, 16, upper);
+                continue;
+            }
+
+            __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(v, below), _mm_cmpgt_epi8(above, v));
+            _mm_storeu_si128((__m128i*)(data + i), _mm_xor_si128(v, _mm_and_si128(letter, flip)));
+        }
+
+        cstr_case_map_scalar(data + i, size - i, upper);
+    }
+
+    /**
+     * @brief SSE2 byte set scan for sets of up to 8 bytes
+     */
+    CSTR_INLINE size_t cstr_span_sse2(_In_reads_(size) const char* data, _In_ size_t size, _In_reads_(set_size) const char* set, _In_ size_t set_size, _In_ bool in_set)
+    {
+        if (set_size == 0 || set_size > 8)
+            return cstr_span_scalar(data, size, set, set_size, in_set);
+
+        __m128i members[8];
+        for (size_t k = 0; k < set_size; ++k)
+            members[k] = _mm_set1_epi8(set[k]);
+
+        uint32_t invert = in_set ? 0xFFFF : 0;
+        size_t i = 0;
+
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(data + i));
+            __m128i hit = _mm_cmpeq_epi8(v, members[0]);
+            for (size_t k = 1; k < set_size; ++k)
+                hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, members[k]));
+
+            uint32_t mask = (uint32_t)_mm_movemask_epi8(hit) ^ invert;
+            if (mask)
+                return i + cstr_ctz32(mask);
+        }
+
+        return i + cstr_span_scalar(data + i, size - i, set, set_size, in_set);
+    }
+#endif
+
+#ifdef CSTR_HAVE_AVX2
+    /**
+     * @brief AVX2 counterpart of cstr_find_sse2 (32 candidates per step)
+     */
+    CSTR_INLINE CSTR_TARGET("avx2") size_t cstr_find_avx2(_In_reads_(haystack_length) const char* haystack, _In_ size_t haystack_length, _In_reads_(needle_length) const char* needle, _In_ size_t needle_length)
+    {
+        if (needle_length < 2 || needle_length > haystack_length)
+            return cstr_find_scalar(haystack, haystack_length, needle, needle_length);
+
+        const char* p = haystack;
+        const char* end = haystack + (haystack_length - needle_length) + 1;
+        const __m256i first = _mm256_set1_epi8(needle[0]);
+        const __m256i last = _mm256_set1_epi8(needle[needle_length - 1]);
+
+        for (; p + 32 <= end; p += 32)
+        {
+            __m256i head = _mm256_loadu_si256((const __m256i*)p);
+            __m256i tail = _mm256_loadu_si256((const __m256i*)(p + needle_length - 1));
+            uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(head, first), _mm256_cmpeq_epi8(tail, last)));
+
+            while (mask)
+            {
+                unsigned bit = cstr_ctz32(mask);
+                if (memcmp(p + bit + 1, needle + 1, needle_length - 2) == 0)
+                    return (size_t)(p + bit - haystack);
+                mask &= mask - 1;
+            }
+        }
+
+        size_t found = cstr_find_sse2(p, (size_t)(end - p) + needle_length - 1, needle, needle_length);
+        return found == cstr_invalid ? cstr_invalid : (size_t)(p - haystack) + found;
+    }
+
+    /**
+     * @brief AVX2 counterpart of cstr_case_map_sse2
+     */
+    CSTR_INLINE CSTR_TARGET("avx2") void cstr_case_map_avx2(_Inout_updates_(size) char* data, _In_ size_t size, _In_ bool upper)
+    {
+        const __m256i flip = _mm256_set1_epi8(0x20);
+        const __m256i below = _mm256_set1_epi8(upper ? 'a' - 1 : 'A' - 1);
+        const __m256i above = _mm256_set1_epi8(upper ? 'z' + 1 : 'Z' + 1);
+        size_t i = 0;
+
+        for (; i + 32 <= size; i += 32)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+
+            if (_mm256_movemask_epi8(v))
+            {
+                cstr_case_map_scalar(data + i, 32, upper);
+                continue;
+            }
+
+            __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(v, below), _mm256_cmpgt_epi8(above, v));
+            _mm256_storeu_si256((__m256i*)(data + i), _mm256_xor_si256(v, _mm256_and_si256(letter, flip)));
+        }
+
+        cstr_case_map_sse2(data + i, size - i, upper);
+    }
+
+    /**
+     * @brief AVX2 counterpart of cstr_span_sse2
      */
-    size_t cstr_length(_In_ CString* obj)
+    CSTR_INLINE CSTR_TARGET("avx2") size_t cstr_span_avx2(_In_reads_(size) const char* data, _In_ size_t size, _In_reads_(set_size) const char* set, _In_ size_t set_size, _In_ bool in_set)
     {
-        if (!obj)
-            return cstr_invalid;
+        if (set_size == 0 || set_size > 8)
+            return cstr_span_scalar(data, size, set, set_size, in_set);
 
-        cstr_lock(obj);
+        __m256i members[8];
+        for (size_t k = 0; k < set_size; ++k)
+            members[k] = _mm256_set1_epi8(set[k]);
 
-        size_t out = obj->length;
+        uint32_t invert = in_set ? 0xFFFFFFFFu : 0;
+        size_t i = 0;
 
-        cstr_unlock(obj);
+        for (; i + 32 <= size; i += 32)
+        {
+            __m256i v = _mm256_loadu_si256((const __m256i*)(data + i));
+            __m256i hit = _mm256_cmpeq_epi8(v, members[0]);
+            for (size_t k = 1; k < set_size; ++k)
+                hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(v, members[k]));
+
+            uint32_t mask = (uint32_t)_mm256_movemask_epi8(hit) ^ invert;
+            if (mask)
+                return i + cstr_ctz32(mask);
+        }
 
-        return out;
+        return i + cstr_span_sse2(data + i, size - i, set, set_size, in_set);
     }
+#endif
 
     /**
-     * @brief Get allocated buffer capacity
-     * @param obj CString object
-     * @return Capacity in bytes or CSTR_INVALID
+     * @brief Kernel table for cstr_cpu_level()
+     * @return Function pointers of the best kernels the process may run
+     * @note Bound on first use; the tables are constant, so concurrent first
+     *       calls all bind the same one
      */
-    size_t cstr_capacity(_In_ CString* obj)
+    const CStringKernels* cstr_kernels(void)
     {
-        if (!obj)
-            return cstr_invalid;
+        static const CStringKernels scalar = { cstr_find_scalar, cstr_case_map_scalar, cstr_span_scalar };
+#ifdef CSTR_HAVE_SSE2
+        static const CStringKernels sse2 = { cstr_find_sse2, cstr_case_map_sse2, cstr_span_sse2 };
+#endif
+#ifdef CSTR_HAVE_AVX2
+        static const CStringKernels avx2 = { cstr_find_avx2, cstr_case_map_avx2, cstr_span_avx2 };
+#endif
+        static const CStringKernels* volatile bound = NULL;
 
-        cstr_lock(obj);
+        const CStringKernels* kernels = bound;
+        if (kernels)
+            return kernels;
 
-        size_t out = obj->capacity;
+        unsigned level = cstr_cpu_level();
+        (void)level;
 
-        cstr_unlock(obj);
+        kernels = &scalar;
+#ifdef CSTR_HAVE_SSE2
+        if (level >= CSTR_CPU_SSE2)
+            kernels = &sse2;
+#endif
+#ifdef CSTR_HAVE_AVX2
+        if (level >= CSTR_CPU_AVX2)
+            kernels = &avx2;
+#endif
 
-        return out;
+        bound = kernels;
+
+        return kernels;
     }
 
     /**
-     * @brief Check if string is empty
-     * @param obj CString object
-     * @return true if empty, false otherwise
+     * @brief Binary-safe substring search in a view
+     * @param haystack View to search
+     * @param needle   View to find
+     * @return Starting index or CSTR_INVALID
+     * @note Runs the find kernel of cstr_kernels(): with SSE2/AVX2, 16 or 32
+     *       candidate positions are filtered at once on the first and last
+     *       needle byte; otherwise skips with memchr() on the first byte.
+     *       Candidates are verified with memcmp()
      */
-    bool cstr_empty(_In_ CString* obj)
+    size_t cstr_view_find(_In_ CStringView haystack, _In_ CStringView needle)
     {
-        if (!obj)
-            return false;
-
-        cstr_lock(obj);
-
-        bool out = obj->data == NULL || obj->length == 0;
+        if (needle.length == 0)
+            return 0;
 
-        cstr_unlock(obj);
+        if (!haystack.data || needle.length > haystack.length)
+            return cstr_invalid;
 
-        return out;
+        return cstr_kernels()->find(haystack.data, haystack.length, needle.data, needle.length);
     }
 
     /**
@@ -448,7 +1528,7 @@ extern "C"
 
         cstr_lock(obj);
 
-        char* new_data = (char*)realloc(obj->data, size);
+        char* new_data = cstr_buffer_reallocate(NULL, obj->data, obj->capacity, size);
         if (new_data == NULL)
         {
             cstr_unlock(obj);
@@ -463,6 +1543,37 @@ extern "C"
         return true;
     }
 
+    /**
+     * @brief Ensure room for a string of given length
+     * @param obj    CString object
+     * @param length String length (excluding null-terminator) to make room for
+     * @return true on success, false on allocation failure
+     * @note Grows geometrically (at least 1.5x) so repeated appends stay amortized O(1)
+     */
+    bool cstr_reserve(_In_ CString* obj, _In_ size_t length)
+    {
+        if (!obj || length == cstr_invalid)
+            return false;
+
+        cstr_lock(obj);
+
+        if (length + 1 <= obj->capacity)
+        {
+            cstr_unlock(obj);
+            return true;
+        }
+
+        size_t capacity = obj->capacity + obj->capacity / 2;
+        if (capacity < length + 1)
+            capacity = length + 1;
+
+        bool out = cstr_resize(obj, capacity);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
     /**
      * @brief Minimize buffer to fit current contents
      * @param obj CString object
@@ -581,16 +1692,12 @@ extern "C"
 
         if (required_capacity > obj->capacity)
         {
-            size_t new_capacity = required_capacity;
-            char* new_data = (char*)realloc(obj->data, new_capacity);
-            if (!new_data)
+            if (!cstr_resize(obj, required_capacity))
             {
                 free(mb_str);
                 cstr_unlock(obj);
                 return false;
             }
-            obj->data = new_data;
-            obj->capacity = new_capacity;
         }
 
         memcpy(obj->data + obj->length, mb_str, data_len);
@@ -758,6 +1865,174 @@ extern "C"
         return true;
     }
 
+    /**
+     * @brief Make room for appending without invalidating the current buffer
+     * @param obj          Destination CString (locked by caller)
+     * @param added        Number of characters about to be appended
+     * @param old          Receives the replaced buffer, to free once copying is done (NULL if none)
+     * @param old_capacity Receives the size of *old
+     * @return true on success, false on overflow or allocation failure
+     * @note Grows like cstr_reserve() but allocates a fresh buffer instead of realloc(),
+     *       so operands that point into obj stay readable until *old is freed with
+     *       cstr_buffer_reallocate(NULL, *old, *old_capacity, 0)
+     */
+    CSTR_INLINE bool cstr_append_prepare(_In_ CString* obj, _In_ size_t added, _Out_ char** old, _Out_ size_t* old_capacity)
+    {
+        *old = NULL;
+        *old_capacity = 0;
+
+        if (added > cstr_invalid - 2 - obj->length)
+            return false;
+
+        size_t required_capacity = obj->length + added + 1;
+        if (required_capacity <= obj->capacity)
+            return true;
+
+        size_t capacity = obj->capacity + obj->capacity / 2;
+        if (capacity < required_capacity)
+            capacity = required_capacity;
+
+        char* data = cstr_buffer_reallocate(cstr_buffer_allocator(obj->data), NULL, 0, capacity);
+        if (!data)
+            return false;
+
+        if (obj->length)
+            memcpy(data, obj->data, obj->length);
+
+        *old = obj->data;
+        *old_capacity = obj->capacity;
+        obj->data = data;
+        obj->capacity = capacity;
+
+        return true;
+    }
+
+    /**
+     * @brief Append several character ranges with a single allocation
+     * @param obj   Destination CString
+     * @param parts Ranges to append in order (may point into obj itself)
+     * @param count Number of ranges
+     * @return true on success, false on allocation failure
+     * @note Sums the lengths first, grows at most once, and copies each part once
+     */
+    bool cstr_append_views(_In_ CString* obj, _In_reads_(count) const CStringView* parts, _In_ size_t count)
+    {
+        if (!obj || (!parts && count))
+            return false;
+
+        size_t total = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (parts[i].length > cstr_invalid - 1 - total)
+                return false;
+            total += parts[i].length;
+        }
+
+        cstr_lock(obj);
+
+        char* old;
+        size_t old_capacity;
+        if (!cstr_append_prepare(obj, total, &old, &old_capacity))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        char* out = obj->data + obj->length;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (parts[i].length)
+                memcpy(out, parts[i].data, parts[i].length);
+            out += parts[i].length;
+        }
+
+        if (old)
+            cstr_buffer_reallocate(NULL, old, old_capacity, 0);
+
+        obj->length += total;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Append several C strings with a single allocation
+     * @param obj   Destination CString
+     * @param count Number of string arguments that follow
+     * @param ...   count null-terminated strings (const char*, NULL is treated as empty)
+     * @return true on success, false on allocation failure
+     * @note cstr_concat(&out, 5, a, sep, b, sep, c) replaces a chain of appends;
+     *       arguments may point into obj itself
+     */
+    bool cstr_concat(_In_ CString* obj, _In_ size_t count, ...)
+    {
+        if (!obj)
+            return false;
+
+        // Lengths of the first few operands are kept so they are scanned only once
+        size_t lengths[16];
+        size_t total = 0;
+
+        va_list args;
+        va_start(args, count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const char* part = va_arg(args, const char*);
+            size_t length = part ? strlen(part) : 0;
+
+            if (i < sizeof(lengths) / sizeof(lengths[0]))
+                lengths[i] = length;
+
+            if (length > cstr_invalid - 1 - total)
+            {
+                va_end(args);
+                return false;
+            }
+            total += length;
+        }
+
+        va_end(args);
+
+        cstr_lock(obj);
+
+        char* old;
+        size_t old_capacity;
+        if (!cstr_append_prepare(obj, total, &old, &old_capacity))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        char* out = obj->data + obj->length;
+
+        va_start(args, count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const char* part = va_arg(args, const char*);
+            size_t length = i < sizeof(lengths) / sizeof(lengths[0]) ? lengths[i] : (part ? strlen(part) : 0);
+
+            if (length)
+                memcpy(out, part, length);
+            out += length;
+        }
+
+        va_end(args);
+
+        if (old)
+            cstr_buffer_reallocate(NULL, old, old_capacity, 0);
+
+        obj->length += total;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
     /**
      * @brief Extract substring
      * @param obj    Source CString
@@ -765,7 +2040,7 @@ extern "C"
      * @param start  Starting index
      * @param length Number of characters to extract
      * @return true on success
-     * @note Automatically clamps to valid range
+     * @note Automatically clamps to valid range. dest is allocated with obj's allocator.
      */
     bool cstr_substring(_In_ CString* obj, _Inout_ CString* dest, _In_ size_t start, _In_ size_t length)
     {
@@ -784,25 +2059,12 @@ extern "C"
         if (length > max_length)
             length = max_length;
 
-        char* buffer = (char*)malloc(length + 1);
-        if (!buffer)
-        {
-            cstr_unlock(obj);
-            return false;
-        }
-
-        memcpy(buffer, obj->data + start, length);
-        buffer[length] = '\0';
-
-        if (!cstr_create_from_chars(dest, buffer))
+        if (!cstr_create_from_buffer_ex(dest, (const uint8_t*)(obj->data + start), length, cstr_buffer_allocator(obj->data)))
         {
-            free(buffer);
             cstr_unlock(obj);
             return false;
         }
 
-        free(buffer);
-
         cstr_unlock(obj);
 
         return true;
@@ -921,6 +2183,7 @@ extern "C"
      * @param obj  CString to search
      * @param obj2 Substring to find
      * @return Starting index or CSTR_INVALID
+     * @note Binary-safe: both lengths are explicit, so embedded NULs match
      */
     size_t cstr_find_cstr(_In_ CString* obj, _In_ CString* obj2)
     {
@@ -930,8 +2193,9 @@ extern "C"
         cstr_lock(obj);
         cstr_lock(obj2);
 
-        char* pos = strstr(obj->data, obj2->data);
-        size_t out = (pos != NULL) ? (size_t)(pos - obj->data) : cstr_invalid;
+        CStringView haystack = { obj->data, obj->length };
+        CStringView needle = { obj2->data, obj2->length };
+        size_t out = cstr_view_find(haystack, needle);
 
         cstr_unlock(obj2);
         cstr_unlock(obj);
@@ -950,10 +2214,12 @@ extern "C"
         if (!obj || !data)
             return cstr_invalid;
 
+        CStringView needle = cstr_view_from_chars(data);
+
         cstr_lock(obj);
 
-        char* pos = strstr(obj->data, data);
-        size_t out = (pos != NULL) ? (size_t)(pos - obj->data) : cstr_invalid;
+        CStringView haystack = { obj->data, obj->length };
+        size_t out = cstr_view_find(haystack, needle);
 
         cstr_unlock(obj);
 
@@ -988,8 +2254,10 @@ extern "C"
 
         cstr_lock(obj);
 
-        char* pos = strstr(obj->data, mb_data);
-        size_t result = (pos != NULL) ? (size_t)(pos - obj->data) : cstr_invalid;
+        // len counts the terminator
+        CStringView haystack = { obj->data, obj->length };
+        CStringView needle = { mb_data, (size_t)len - 1 };
+        size_t result = cstr_view_find(haystack, needle);
 
         cstr_unlock(obj);
 
@@ -1010,8 +2278,7 @@ extern "C"
 
         cstr_lock(obj);
 
-        for (size_t i = 0; i < obj->length; ++i)
-            obj->data[i] = (char)toupper((unsigned char)obj->data[i]);
+        cstr_kernels()->case_map(obj->data, obj->length, true);
 
         cstr_unlock(obj);
 
@@ -1030,8 +2297,7 @@ extern "C"
 
         cstr_lock(obj);
 
-        for (size_t i = 0; i < obj->length; ++i)
-            obj->data[i] = (char)tolower((unsigned char)obj->data[i]);
+        cstr_kernels()->case_map(obj->data, obj->length, false);
 
         cstr_unlock(obj);
 
@@ -1079,102 +2345,71 @@ extern "C"
     }
 
     /**
-     * @brief Extract token using delimiters
-     * @param obj        Source CString
-     * @param token      Output token
+     * @brief Locate next token in a character range
+     * @param data       Source characters
+     * @param len        Number of characters in data
      * @param delimiters Separator characters
      * @param start_pos  Starting/ending position (updated)
+     * @param token      Output view into data
      * @return true if token found
+     * @note Unsynchronized; shared by cstr_tokenize() and the array/range tokenizers
      */
-    bool cstr_tokenize(_In_ CString* obj, _Inout_ CString* token, _In_ const char* delimiters, _Inout_ size_t* start_pos)
+    bool cstr_scan_token(_In_reads_(len) const char* data, _In_ size_t len, _In_ const char* delimiters, _Inout_ size_t* start_pos, _Out_ CStringView* token)
     {
-        if (!obj || !delimiters || !start_pos || *start_pos >= obj->length)
+        if (!data || !delimiters || !start_pos || !token || *start_pos >= len)
             return false;
 
-        cstr_lock(obj);
-
-        size_t len = obj->length;
+        const CStringKernels* kernels = cstr_kernels();
+        size_t set_size = strlen(delimiters) + 1;  // As with strchr(), NUL is a delimiter
         size_t pos = *start_pos;
-        
-        while (pos < len && strchr(delimiters, obj->data[pos]) != NULL)
-            pos++;
+
+        pos += kernels->span(data + pos, len - pos, delimiters, set_size, true);
 
         if (pos >= len)
         {
             *start_pos = pos;
-            cstr_unlock(obj);
             return false;
         }
 
         size_t token_start = pos;
 
-        while (pos < len && strchr(delimiters, obj->data[pos]) == NULL)
-            pos++;
+        pos += kernels->span(data + pos, len - pos, delimiters, set_size, false);
 
         size_t token_end = pos;
 
-        size_t token_len = token_end - token_start;
-        char* temp = (char*)malloc(token_len + 1);
-        if (!temp)
-        {
-            cstr_unlock(obj);
-            return false;
-        }
-
-        memcpy(temp, obj->data + token_start, token_len);
-        temp[token_len] = '\0';
-
-        if (!cstr_create_from_chars(token, temp))
-        {
-            free(temp);
-            cstr_unlock(obj);
-            return false;
-        }
-
-        free(temp);
+        token->data = data + token_start;
+        token->length = token_end - token_start;
 
         *start_pos = (token_end < len) ? token_end + 1 : len;
 
-        cstr_unlock(obj);
-
         return true;
     }
 
     /**
-     * @brief Advanced tokenization with zones/escaping
-     * @param obj          Source CString
-     * @param token        Output token
+     * @brief Locate next token in a character range with zones/escaping
+     * @param data         Source characters
+     * @param len          Number of characters in data
      * @param delimiters   Separator characters
      * @param zone_pairs   Zone delimiter pairs (e.g., "\"\"''")
      * @param escape_chars Escape characters
      * @param start_pos    Starting/ending position (updated)
+     * @param token        Output view into data
      * @return true if token found
-     *
-     * @code
-     * size_t pos = 0;
-     * CString str, token;
-     * cstr_create_from_chars(&str, "Hello, \"my world\"!");
-     * while (cstr_tokenize_ex(&str, &token, " ", "\"\"", "\\", &pos))
-     *     printf("Token: %s\n", cstr_data(&token));
-     * @endcode
+     * @note Unsynchronized; shared by cstr_tokenize_ex() and the array/range tokenizers
      */
-    bool cstr_tokenize_ex(_In_ CString* obj, _Inout_ CString* token, _In_ const char* delimiters, _In_ const char* zone_pairs, _In_ const char* escape_chars, _Inout_ size_t* start_pos)
+    bool cstr_scan_token_ex(_In_reads_(len) const char* data, _In_ size_t len, _In_ const char* delimiters, _In_ const char* zone_pairs, _In_ const char* escape_chars, _Inout_ size_t* start_pos, _Out_ CStringView* token)
     {
-        if (!obj || !delimiters || !start_pos || *start_pos >= obj->length)
+        if (!data || !delimiters || !start_pos || !token || *start_pos >= len)
             return false;
 
-        cstr_lock(obj);
-
-        size_t len = obj->length;
         size_t pos = *start_pos;
 
-        while (pos < len && strchr(delimiters, obj->data[pos]) != NULL)
+        while (pos < len && strchr(delimiters, data[pos]) != NULL)
             pos++;
 
         if (pos >= len)
         {
             *start_pos = pos;
-            cstr_unlock(obj);
             return false;
         }
 
@@ -1186,7 +2421,7 @@ extern "C"
 
         for (; pos < len; pos++)
         {
-            char c = obj->data[pos];
+            char c = data[pos];
 
             if (escape)
             {
@@ -1232,32 +2467,104 @@ extern "C"
 
         token_end = (pos == len) ? len : token_end;
 
-        size_t token_len = token_end - token_start;
-        char* temp = (char*)malloc(token_len + 1);
-        if (!temp)
+        token->data = data + token_start;
+        token->length = token_end - token_start;
+
+        *start_pos = (token_end < len) ? token_end + 1 : len;
+
+        return true;
+    }
+
+    /**
+     * @brief Extract token using delimiters
+     * @param obj        Source CString
+     * @param token      Output token
+     * @param delimiters Separator characters
+     * @param start_pos  Starting/ending position (updated)
+     * @return true if token found
+     * @note token is allocated with obj's allocator
+     */
+    bool cstr_tokenize(_In_ CString* obj, _Inout_ CString* token, _In_ const char* delimiters, _Inout_ size_t* start_pos)
+    {
+        if (!obj || !delimiters || !start_pos || *start_pos >= obj->length)
+            return false;
+
+        cstr_lock(obj);
+
+        CStringView view;
+        size_t pos = *start_pos;
+
+        if (!cstr_scan_token(obj->data, obj->length, delimiters, &pos, &view))
+        {
+            *start_pos = pos;
+            cstr_unlock(obj);
+            return false;
+        }
+
+        if (!cstr_create_from_buffer_ex(token, (const uint8_t*)view.data, view.length, cstr_buffer_allocator(obj->data)))
         {
             cstr_unlock(obj);
             return false;
         }
 
-        memcpy(temp, obj->data + token_start, token_len);
-        temp[token_len] = '\0';
+        *start_pos = pos;
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Advanced tokenization with zones/escaping
+     * @param obj          Source CString
+     * @param token        Output token
+     * @param delimiters   Separator characters
+     * @param zone_pairs   Zone delimiter pairs (e.g., "\"\"''")
+     * @param escape_chars Escape characters
+     * @param start_pos    Starting/ending position (updated)
+     * @return true if token found
+     * @note token is allocated with obj's allocator
+     *
+     * @code
+     * size_t pos = 0;
+     * CString str, token;
+     * cstr_create_from_chars(&str, "Hello, \"my world\"!");
+     * while (cstr_tokenize_ex(&str, &token, " ", "\"\"", "\\", &pos))
+     *     printf("Token: %s\n", cstr_data(&token));
+     * @endcode
+     */
+    bool cstr_tokenize_ex(_In_ CString* obj, _Inout_ CString* token, _In_ const char* delimiters, _In_ const char* zone_pairs, _In_ const char* escape_chars, _Inout_ size_t* start_pos)
+    {
+        if (!obj || !delimiters || !start_pos || *start_pos >= obj->length)
+            return false;
+
+        cstr_lock(obj);
+
+        CStringView view;
+        size_t pos = *start_pos;
+
+        if (!cstr_scan_token_ex(obj->data, obj->length, delimiters, zone_pairs, escape_chars, &pos, &view))
+        {
+            *start_pos = pos;
+            cstr_unlock(obj);
+            return false;
+        }
 
-        if (!cstr_create_from_chars(token, temp))
+        if (!cstr_create_from_buffer_ex(token, (const uint8_t*)view.data, view.length, cstr_buffer_allocator(obj->data)))
         {
-            free(temp);
             cstr_unlock(obj);
             return false;
         }
 
-        free(temp);
-        *start_pos = (token_end < len) ? token_end + 1 : len;
+        *start_pos = pos;
 
         cstr_unlock(obj);
 
         return true;
     }
 
+#endif // CSTR_IMPLEMENT_CORE
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,763 @@
+#pragma once
+
+/**
+ * @file cstr.hpp
+ * @brief C++ layer over cstr.h.
+ *
+ * Requires C++17 (C++20 adds std::span views). Everything is header-only
+ * and forwards to the C kernels. Strings can draw their buffers from a
+ * std::pmr::memory_resource through CStringAllocator.
+ */
+
+#ifndef CSTR_HPP
+#define CSTR_HPP
+
+#include "cstr.h"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <string_view>
+#include <type_traits>
+
+#if (defined(_MSVC_LANG) ? _MSVC_LANG : __cplusplus) >= 202002L && __has_include(<span>)
+#include <span>
+#define CSTR_HAVE_SPAN 1  ///< std::span views are available
+#endif
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define CSTR_HAVE_PMR 1   ///< std::pmr memory resources are available
+#endif
+
+namespace cstr
+{
+    /**
+     * @brief Concatenation operand referring to a character range
+     */
+    struct ConcatLeaf
+    {
+        static constexpr size_t count = 1;  ///< Ranges produced
+
+        CStringView view;  ///< Referenced characters
+
+        /**
+         * @brief Store this operand's range
+         * @param out Output cursor (advanced)
+         */
+        void collect(CStringView*& out) const noexcept
+        {
+            *out++ = view;
+        }
+    };
+
+    /**
+     * @brief Concatenation operand holding a single character
+     */
+    struct ConcatChar
+    {
+        static constexpr size_t count = 1;  ///< Ranges produced
+
+        char value;  ///< Character
+
+        /**
+         * @brief Store this operand's range
+         * @param out Output cursor (advanced)
+         */
+        void collect(CStringView*& out) const noexcept
+        {
+            *out++ = CStringView{ &value, 1 };
+        }
+    };
+
+    /**
+     * @brief Lazy concatenation of two operands
+     *
+     * Building the expression copies nothing. Materializing it sums the
+     * lengths, allocates once, and copies each operand once.
+     *
+     * @warning Operands are referenced, not copied: materialize the
+     *          expression before any of them is modified or destroyed
+     */
+    template <class Left, class Right>
+    struct ConcatExpr
+    {
+        static constexpr size_t count = Left::count + Right::count;  ///< Ranges produced
+
+        Left left;    ///< Leading operand
+        Right right;  ///< Trailing operand
+
+        /**
+         * @brief Store all operand ranges in order
+         * @param out Output cursor (advanced)
+         */
+        void collect(CStringView*& out) const noexcept
+        {
+            left.collect(out);
+            right.collect(out);
+        }
+
+        /**
+         * @brief Total length of the concatenation
+         */
+        size_t size() const noexcept
+        {
+            std::array<CStringView, count> parts;
+            CStringView* cursor = parts.data();
+            collect(cursor);
+
+            size_t total = 0;
+            for (const CStringView& part : parts)
+                total += part.length;
+            return total;
+        }
+    };
+
+    template <class T>
+    struct is_concat : std::false_type {};
+
+    template <>
+    struct is_concat<ConcatLeaf> : std::true_type {};
+
+    template <>
+    struct is_concat<ConcatChar> : std::true_type {};
+
+    template <class Left, class Right>
+    struct is_concat<ConcatExpr<Left, Right>> : std::true_type {};
+
+    /**
+     * @brief Wrap a CString as a concatenation operand
+     */
+    inline ConcatLeaf cat(const CString& value) noexcept
+    {
+        return ConcatLeaf{ CStringView{ value.data, value.length } };
+    }
+
+    /**
+     * @brief Wrap a null-terminated string as a concatenation operand (NULL is empty)
+     */
+    inline ConcatLeaf cat(const char* value) noexcept
+    {
+        return ConcatLeaf{ cstr_view_from_chars(value) };
+    }
+
+    /**
+     * @brief Wrap a string view (or std::string) as a concatenation operand
+     */
+    inline ConcatLeaf cat(std::string_view value) noexcept
+    {
+        return ConcatLeaf{ CStringView{ value.data(), value.size() } };
+    }
+
+    /**
+     * @brief Wrap a C view as a concatenation operand
+     */
+    inline ConcatLeaf cat(CStringView value) noexcept
+    {
+        return ConcatLeaf{ value };
+    }
+
+    /**
+     * @brief Wrap a single character as a concatenation operand
+     */
+    template <class T, std::enable_if_t<std::is_same_v<T, char>, int> = 0>
+    ConcatChar cat(T value) noexcept
+    {
+        return ConcatChar{ value };
+    }
+
+    /**
+     * @brief Pass an existing expression through unchanged
+     */
+    template <class T, std::enable_if_t<is_concat<T>::value, int> = 0>
+    const T& cat(const T& value) noexcept
+    {
+        return value;
+    }
+
+    template <class T>
+    using concat_operand_t = std::decay_t<decltype(cat(std::declval<const T&>()))>;
+
+    /**
+     * @brief Types that may start a concatenation with operator+
+     * @note Expressions and cstr::String; plain C strings need cstr::cat() first
+     */
+    template <class T>
+    struct starts_concat : is_concat<T> {};
+
+    /**
+     * @brief Extend an expression with another operand
+     */
+    template <class Left, class Right, std::enable_if_t<starts_concat<Left>::value, int> = 0>
+    ConcatExpr<concat_operand_t<Left>, concat_operand_t<Right>> operator+(const Left& left, const Right& right) noexcept
+    {
+        return { cat(left), cat(right) };
+    }
+
+    /**
+     * @brief Prepend a plain operand to an expression
+     */
+    template <class Left, class Right, std::enable_if_t<!starts_concat<Left>::value && starts_concat<Right>::value, int> = 0>
+    ConcatExpr<concat_operand_t<Left>, concat_operand_t<Right>> operator+(const Left& left, const Right& right) noexcept
+    {
+        return { cat(left), cat(right) };
+    }
+
+    /**
+     * @brief Append a concatenation expression (or single operand) to a CString
+     * @param dest  Destination CString
+     * @param value Expression such as cstr::cat(a) + ", " + b
+     * @return true on success, false on allocation failure
+     * @note Operands may refer to dest itself
+     */
+    template <class T>
+    bool append(CString& dest, const T& value) noexcept
+    {
+        using Operand = concat_operand_t<T>;
+
+        const Operand& expr = cat(value);
+        std::array<CStringView, Operand::count> parts;
+        CStringView* cursor = parts.data();
+        expr.collect(cursor);
+
+        return cstr_append_views(&dest, parts.data(), parts.size());
+    }
+
+    /**
+     * @brief Owning string types that get the comparison operators below
+     */
+    template <class T>
+    struct is_string_type : std::false_type {};
+
+    template <class A, class B>
+    using enable_string_compare_t = std::enable_if_t<
+        (is_string_type<A>::value && std::is_convertible_v<const B&, std::string_view>) ||
+        (!is_string_type<A>::value && std::is_convertible_v<const A&, std::string_view> && is_string_type<B>::value), int>;
+
+    /**
+     * @brief Binary-safe comparison through cstr_view_compare
+     */
+    inline int compare_views(std::string_view a, std::string_view b) noexcept
+    {
+        return cstr_view_compare(CStringView{ a.data(), a.size() }, CStringView{ b.data(), b.size() });
+    }
+
+    template <class A, class B, enable_string_compare_t<A, B> = 0>
+    bool operator==(const A& a, const B& b) noexcept
+    {
+        std::string_view left(a);
+        std::string_view right(b);
+        return left.size() == right.size() && compare_views(left, right) == 0;
+    }
+
+    template <class A, class B, enable_string_compare_t<A, B> = 0>
+    bool operator!=(const A& a, const B& b) noexcept
+    {
+        return !(a == b);
+    }
+
+    template <class A, class B, enable_string_compare_t<A, B> = 0>
+    bool operator<(const A& a, const B& b) noexcept
+    {
+        return compare_views(a, b) < 0;
+    }
+
+    template <class A, class B, enable_string_compare_t<A, B> = 0>
+    bool operator<=(const A& a, const B& b) noexcept
+    {
+        return compare_views(a, b) <= 0;
+    }
+
+    template <class A, class B, enable_string_compare_t<A, B> = 0>
+    bool operator>(const A& a, const B& b) noexcept
+    {
+        return compare_views(a, b) > 0;
+    }
+
+    template <class A, class B, enable_string_compare_t<A, B> = 0>
+    bool operator>=(const A& a, const B& b) noexcept
+    {
+        return compare_views(a, b) >= 0;
+    }
+
+    class String;
+
+    template <>
+    struct starts_concat<String> : std::true_type {};
+
+    template <>
+    struct is_string_type<String> : std::true_type {};
+
+    /**
+     * @brief Transparent hash of string contents (cstr_view_hash)
+     * @note Equal for every string type with the same characters, so containers
+     *       keyed by cstr strings can be probed with std::string_view or
+     *       const char* without building a temporary key
+     */
+    struct string_hash
+    {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view value) const noexcept
+        {
+            return (size_t)cstr_view_hash(CStringView{ value.data(), value.size() });
+        }
+
+        size_t operator()(const char* value) const noexcept
+        {
+            return (*this)(std::string_view(value ? value : ""));
+        }
+    };
+
+    /**
+     * @brief Transparent equality of string contents (length first, then bytes)
+     */
+    struct string_equal
+    {
+        using is_transparent = void;
+
+        bool operator()(std::string_view a, std::string_view b) const noexcept
+        {
+            return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size()) == 0);
+        }
+    };
+
+#ifdef CSTR_HAVE_PMR
+    namespace detail
+    {
+        /**
+         * @brief CStringReallocFn over a std::pmr::memory_resource
+         */
+        inline void* resource_reallocate(void* context, void* data, size_t old_size, size_t new_size) noexcept
+        {
+            std::pmr::memory_resource* resource = static_cast<std::pmr::memory_resource*>(context);
+            void* out = nullptr;
+
+            if (new_size)
+            {
+                try
+                {
+                    out = resource->allocate(new_size, alignof(CStringAllocator));
+                }
+                catch (...)
+                {
+                    return nullptr;
+                }
+
+                if (data)
+                    std::memcpy(out, data, old_size < new_size ? old_size : new_size);
+            }
+
+            if (data)
+                resource->deallocate(data, old_size, alignof(CStringAllocator));
+
+            return out;
+        }
+    }
+
+    /**
+     * @brief Allocator that routes CString buffers through a memory resource
+     * @param resource Resource that outlives every string using the result
+     * @note Pass the result to cstr_create_ex(); with a monotonic_buffer_resource
+     *       frees are no-ops and the strings are released with the arena
+     */
+    inline CStringAllocator resource_allocator(std::pmr::memory_resource* resource) noexcept
+    {
+        return CStringAllocator{ &detail::resource_reallocate, resource };
+    }
+#endif
+
+    /**
+     * @class String
+     * @brief Owning RAII wrapper around CString
+     *
+     * Moving steals the buffer and never allocates or throws. Because of that,
+     * std::vector<String> relocates elements without deep copies. Allocation
+     * failures throw std::bad_alloc. An empty String may own no buffer;
+     * native() allocates one before handing the CString to C code.
+     *
+     * Like std::pmr containers, copies use the C heap, copy assignment keeps
+     * the target's allocator, and moves take the allocator with the buffer.
+     *
+     * @warning Do not move a String while another thread holds its lock
+     */
+    class String
+    {
+    public:
+        /**
+         * @brief Create empty string without allocating
+         */
+        String() noexcept
+            : str_{}
+        {
+        }
+
+        /**
+         * @brief Create from null-terminated string (NULL is empty)
+         */
+        String(const char* value)
+            : String(std::string_view(value ? value : ""))
+        {
+        }
+
+        /**
+         * @brief Create from characters (std::string converts implicitly)
+         */
+        String(std::string_view value)
+            : str_{}
+        {
+            *this += value;
+        }
+
+        /**
+         * @brief Materialize a concatenation expression with one allocation
+         */
+        template <class Left, class Right>
+        String(const ConcatExpr<Left, Right>& expr)
+            : str_{}
+        {
+            *this += expr;
+        }
+
+#ifdef CSTR_HAVE_PMR
+        /**
+         * @brief Create empty string whose buffers come from a memory resource
+         * @note Does not allocate; the resource must outlive the string
+         */
+        explicit String(std::pmr::memory_resource* resource) noexcept
+            : str_{}, allocator_(resource_allocator(resource))
+        {
+        }
+
+        String(std::string_view value, std::pmr::memory_resource* resource)
+            : String(resource)
+        {
+            *this += value;
+        }
+
+        template <class Left, class Right>
+        String(const ConcatExpr<Left, Right>& expr, std::pmr::memory_resource* resource)
+            : String(resource)
+        {
+            *this += expr;
+        }
+#endif
+
+        /**
+         * @brief Take ownership of a C string
+         * @param owned Initialized CString; left empty and unowned
+         */
+        explicit String(CString&& owned) noexcept
+            : str_{}
+        {
+            steal(owned);
+        }
+
+        String(const String& other)
+            : String(other.view())
+        {
+        }
+
+        String(String&& other) noexcept
+            : str_{}, allocator_(other.allocator_)
+        {
+            steal(other.str_);
+        }
+
+        String& operator=(const String& other)
+        {
+            if (this != &other)
+            {
+                String copy(other.view(), *allocator());
+                swap(copy);
+            }
+            return *this;
+        }
+
+        String& operator=(String&& other) noexcept
+        {
+            if (this != &other)
+            {
+                cstr_destroy(&str_);
+                allocator_ = other.allocator_;
+                steal(other.str_);
+            }
+            return *this;
+        }
+
+        ~String()
+        {
+            cstr_destroy(&str_);
+        }
+
+        /**
+         * @brief Pointer to the characters (never NULL)
+         */
+        const char* data() const noexcept
+        {
+            return str_.data ? str_.data : "";
+        }
+
+        /**
+         * @brief Null-terminated contents
+         */
+        const char* c_str() const noexcept
+        {
+            return data();
+        }
+
+        size_t size() const noexcept
+        {
+            return str_.length;
+        }
+
+        size_t length() const noexcept
+        {
+            return str_.length;
+        }
+
+        size_t capacity() const noexcept
+        {
+            return str_.capacity ? str_.capacity - 1 : 0;
+        }
+
+        bool empty() const noexcept
+        {
+            return str_.length == 0;
+        }
+
+        const char* begin() const noexcept
+        {
+            return data();
+        }
+
+        const char* end() const noexcept
+        {
+            return data() + str_.length;
+        }
+
+        /**
+         * @brief Unchecked character access
+         */
+        char operator[](size_t index) const noexcept
+        {
+            return str_.data[index];
+        }
+
+        /**
+         * @brief View of the contents (no copy)
+         */
+        std::string_view view() const noexcept
+        {
+            return std::string_view(data(), str_.length);
+        }
+
+        operator std::string_view() const noexcept
+        {
+            return view();
+        }
+
+        /**
+         * @brief C view of the contents (no copy)
+         */
+        CStringView c_view() const noexcept
+        {
+            return CStringView{ data(), str_.length };
+        }
+
+#ifdef CSTR_HAVE_SPAN
+        /**
+         * @brief Contents as raw bytes (no copy)
+         */
+        std::span<const std::byte> bytes() const noexcept
+        {
+            return std::as_bytes(std::span<const char>(data(), str_.length));
+        }
+
+        operator std::span<const std::byte>() const noexcept
+        {
+            return bytes();
+        }
+#endif
+
+        /**
+         * @brief Underlying CString for use with the C API
+         * @note Allocates the initial buffer of an empty String if needed
+         */
+        CString* native()
+        {
+            if (!str_.data && !cstr_create_ex(&str_, &allocator_))
+                throw std::bad_alloc();
+            return &str_;
+        }
+
+        /**
+         * @brief Give up ownership of the buffer
+         * @return CString the caller must cstr_destroy(); this String becomes empty
+         */
+        CString release() noexcept
+        {
+            CString out = str_;
+            str_ = CString{};
+            return out;
+        }
+
+        /**
+         * @brief Ensure room for a string of given length
+         */
+        void reserve(size_t length)
+        {
+            first_buffer();
+            if (!cstr_reserve(&str_, length))
+                throw std::bad_alloc();
+
+            // A first allocation leaves the buffer unterminated
+            str_.data[str_.length] = '\0';
+        }
+
+        /**
+         * @brief Remove contents, keeping the buffer
+         */
+        void clear() noexcept
+        {
+            if (str_.data)
+                cstr_clear(&str_);
+        }
+
+        void swap(String& other) noexcept
+        {
+            CString temp = str_;
+            str_ = other.str_;
+            other.str_ = temp;
+            cstr_lock_init(&str_.lock);
+            cstr_lock_init(&other.str_.lock);
+
+            CStringAllocator temp_allocator = allocator_;
+            allocator_ = other.allocator_;
+            other.allocator_ = temp_allocator;
+        }
+
+        /**
+         * @brief Append an operand or concatenation expression
+         * @note cstr::String, C strings, string views, characters and expressions are accepted
+         */
+        template <class T>
+        String& operator+=(const T& value)
+        {
+            first_buffer();
+            if (!cstr::append(str_, value))
+                throw std::bad_alloc();
+            return *this;
+        }
+
+        /**
+         * @brief Binary-safe three-way comparison
+         */
+        int compare(std::string_view other) const noexcept
+        {
+            return compare_views(view(), other);
+        }
+
+        /**
+         * @brief Hash of the contents (same as cstr_view_hash)
+         */
+        size_t hash() const noexcept
+        {
+            return (size_t)cstr_view_hash(c_view());
+        }
+
+#ifdef CSTR_HAVE_PMR
+        /**
+         * @brief Memory resource the buffers come from
+         * @return Resource, or nullptr for the C heap
+         */
+        std::pmr::memory_resource* resource() const noexcept
+        {
+            const CStringAllocator* source = allocator();
+            if (source->reallocate != &detail::resource_reallocate)
+                return nullptr;
+            return static_cast<std::pmr::memory_resource*>(source->context);
+        }
+#endif
+
+    private:
+        /**
+         * @brief Copy characters using a given allocator
+         */
+        String(std::string_view value, const CStringAllocator& allocator)
+            : str_{}, allocator_(allocator)
+        {
+            *this += value;
+        }
+
+        /**
+         * @brief Allocator of the current buffer, or the one for the first buffer
+         */
+        const CStringAllocator* allocator() const noexcept
+        {
+            return str_.data ? cstr_buffer_allocator(str_.data) : &allocator_;
+        }
+
+        /**
+         * @brief Allocate an empty buffer from a custom allocator before first use
+         * @note C heap strings skip this: appending to no buffer allocates from the heap
+         */
+        void first_buffer()
+        {
+            if (!str_.data && allocator_.reallocate && !cstr_create_ex(&str_, &allocator_))
+                throw std::bad_alloc();
+        }
+
+        /**
+         * @brief Move buffer out of source, leaving it empty and unowned
+         */
+        void steal(CString& source) noexcept
+        {
+            str_.data = source.data;
+            str_.length = source.length;
+            str_.capacity = source.capacity;
+            cstr_lock_init(&str_.lock);
+
+            source.data = NULL;
+            source.length = 0;
+            source.capacity = 0;
+        }
+
+        CString str_;                   ///< Owned C string
+        CStringAllocator allocator_{};  ///< Allocator for a buffer created while str_ has none
+    };
+
+    static_assert(std::is_nothrow_move_constructible_v<String>, "String must relocate without copying");
+    static_assert(std::is_nothrow_move_assignable_v<String>, "String must relocate without copying");
+
+    /**
+     * @brief Wrap a cstr::String as a concatenation operand
+     */
+    inline ConcatLeaf cat(const String& value) noexcept
+    {
+        return ConcatLeaf{ value.c_view() };
+    }
+
+    inline void swap(String& a, String& b) noexcept
+    {
+        a.swap(b);
+    }
+}
+
+namespace std
+{
+    /**
+     * @brief Hash support so cstr::String works as an unordered container key
+     * @note Transparent: with std::equal_to<cstr::String> below, C++20 unordered
+     *       containers accept std::string_view and const char* lookup keys
+     */
+    template <>
+    struct hash<cstr::String> : cstr::string_hash {};
+
+    template <>
+    struct equal_to<cstr::String> : cstr::string_equal {};
+}
+
+#endif // CSTR_HPP
@@ -0,0 +1,550 @@
+#pragma once
+
+/**
+ * @file cstr_array.h
+ * @brief Contiguous array of strings stored as one blob plus offsets.
+ */
+
+#ifndef CSTR_ARRAY_H
+#define CSTR_ARRAY_H
+
+#include "cstr.h"
+#include "cstr_sort.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @struct CStringArray
+     * @brief Thread-safe contiguous string array
+     *
+     * @var blob             - Element bytes, each element null-terminated
+     * @var blob_size        - Used bytes in blob
+     * @var blob_capacity    - Allocated bytes in blob
+     * @var offsets          - count + 1 element start offsets into blob
+     * @var count            - Number of elements
+     * @var offsets_capacity - Allocated entries in offsets
+     * @var lock             - Recursive lock for thread synchronization
+     *
+     * @note Element i spans [offsets[i], offsets[i + 1] - 1); the byte before
+     *       offsets[i + 1] is its null-terminator.
+     */
+    typedef struct
+    {
+        char* blob;               ///< Element bytes
+        size_t blob_size;         ///< Used blob bytes
+        size_t blob_capacity;     ///< Allocated blob bytes
+        size_t* offsets;          ///< Element start offsets
+        size_t count;             ///< Number of elements
+        size_t offsets_capacity;  ///< Allocated offset entries
+        CStringLock lock;         ///< Thread synchronization primitive
+    }CStringArray;
+
+    CSTR_API bool cstr_array_create(_Inout_ CStringArray* arr);
+    CSTR_API bool cstr_array_destroy(_In_ CStringArray* arr);
+    CSTR_API void cstr_array_lock(_In_ CStringArray* arr);
+    CSTR_API void cstr_array_unlock(_In_ CStringArray* arr);
+    CSTR_API bool cstr_array_reserve(_In_ CStringArray* arr, _In_ size_t count, _In_ size_t bytes);
+    CSTR_API bool cstr_array_push_buffer(_In_ CStringArray* arr, _In_reads_(size) const char* data, _In_ size_t size);
+    CSTR_API bool cstr_array_push_chars(_In_ CStringArray* arr, _In_ const char* data);
+    CSTR_API bool cstr_array_push_view(_In_ CStringArray* arr, _In_ CStringView view);
+    CSTR_API bool cstr_array_push_cstr(_In_ CStringArray* arr, _In_ CString* obj);
+    CSTR_API size_t cstr_array_size(_In_ CStringArray* arr);
+    CSTR_API bool cstr_array_get(_In_ CStringArray* arr, _In_ size_t index, _Out_ CStringView* view);
+    CSTR_API bool cstr_array_next(_In_ CStringArray* arr, _Inout_ size_t* index, _Out_ CStringView* view);
+    CSTR_API bool cstr_array_clear(_In_ CStringArray* arr);
+    CSTR_API bool cstr_array_sort(_In_ CStringArray* arr);
+    CSTR_API size_t cstr_array_tokenize(_In_ CStringArray* arr, _In_ CString* obj, _In_ const char* delimiters);
+    CSTR_API size_t cstr_array_tokenize_ex(_In_ CStringArray* arr, _In_ CString* obj, _In_ const char* delimiters, _In_ const char* zone_pairs, _In_ const char* escape_chars);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_ARRAY)
+
+    /**
+     * @brief Initialize a new empty CStringArray
+     * @param arr Pointer to CStringArray object to initialize
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_array_create(_Inout_ CStringArray* arr)
+    {
+        if (!arr)
+            return false;
+
+        size_t* offsets = (size_t*)malloc(sizeof(size_t));
+        if (offsets == NULL)
+            return false;
+
+        offsets[0] = 0;
+
+        arr->blob = NULL;
+        arr->blob_size = 0;
+        arr->blob_capacity = 0;
+        arr->offsets = offsets;
+        arr->count = 0;
+        arr->offsets_capacity = 1;
+
+        cstr_lock_init(&arr->lock);
+
+        return true;
+    }
+
+    /**
+     * @brief Destroy CStringArray and release resources
+     * @param arr CStringArray to destroy
+     * @return true on success, false for invalid object
+     * @note Securely erases element bytes before freeing
+     */
+    bool cstr_array_destroy(_In_ CStringArray* arr)
+    {
+        if (!arr)
+            return false;
+
+        if (arr->blob)
+        {
+            SecureZeroMemory(arr->blob, arr->blob_capacity);
+            free(arr->blob);
+            arr->blob = NULL;
+        }
+
+        free(arr->offsets);
+        arr->offsets = NULL;
+
+        arr->blob_size = 0;
+        arr->blob_capacity = 0;
+        arr->count = 0;
+        arr->offsets_capacity = 0;
+
+        return true;
+    }
+
+    /**
+     * @brief Acquire exclusive access
+     * @param arr CStringArray object
+     */
+    void cstr_array_lock(_In_ CStringArray* arr)
+    {
+        if (arr)
+            cstr_lock_acquire(&arr->lock);
+    }
+
+    /**
+     * @brief Release exclusive access
+     * @param arr CStringArray object
+     */
+    void cstr_array_unlock(_In_ CStringArray* arr)
+    {
+        if (arr)
+            cstr_lock_release(&arr->lock);
+    }
+
+    /**
+     * @brief Reserve room for additional elements
+     * @param arr   CStringArray object
+     * @param count Number of elements to make room for
+     * @param bytes Total characters of those elements (excluding null-terminators)
+     * @return true on success, false on allocation failure
+     * @note Grows geometrically so repeated pushes are amortized O(1)
+     */
+    bool cstr_array_reserve(_In_ CStringArray* arr, _In_ size_t count, _In_ size_t bytes)
+    {
+        if (!arr)
+            return false;
+
+        cstr_array_lock(arr);
+
+        size_t need_offsets = arr->count + count + 1;
+        if (need_offsets > arr->offsets_capacity)
+        {
+            size_t new_capacity = arr->offsets_capacity * 2;
+            if (new_capacity < need_offsets)
+                new_capacity = need_offsets;
+
+            size_t* new_offsets = (size_t*)realloc(arr->offsets, new_capacity * sizeof(size_t));
+            if (new_offsets == NULL)
+            {
+                cstr_array_unlock(arr);
+                return false;
+            }
+
+            arr->offsets = new_offsets;
+            arr->offsets_capacity = new_capacity;
+        }
+
+        size_t need_blob = arr->blob_size + bytes + count;
+        if (need_blob > arr->blob_capacity)
+        {
+            size_t new_capacity = arr->blob_capacity * 2;
+            if (new_capacity < need_blob)
+                new_capacity = need_blob;
+
+            char* new_blob = (char*)realloc(arr->blob, new_capacity);
+            if (new_blob == NULL)
+            {
+                cstr_array_unlock(arr);
+                return false;
+            }
+
+            arr->blob = new_blob;
+            arr->blob_capacity = new_capacity;
+        }
+
+        cstr_array_unlock(arr);
+
+        return true;
+    }
+
+    /**
+     * @brief Append element from binary buffer
+     * @param arr  CStringArray object
+     * @param data Source bytes (may point into arr itself)
+     * @param size Number of bytes to copy
+     * @return true on success, false on allocation failure
+     * @note Adds null-terminator after element contents
+     */
+    bool cstr_array_push_buffer(_In_ CStringArray* arr, _In_reads_(size) const char* data, _In_ size_t size)
+    {
+        if (!arr || (!data && size))
+            return false;
+
+        cstr_array_lock(arr);
+
+        // Grow the blob into a fresh allocation so data stays readable until it is copied
+        char* old = NULL;
+        size_t old_capacity = 0;
+        size_t need_blob = arr->blob_size + size + 1;
+        if (need_blob > arr->blob_capacity)
+        {
+            size_t new_capacity = arr->blob_capacity * 2;
+            if (new_capacity < need_blob)
+                new_capacity = need_blob;
+
+            char* new_blob = (char*)malloc(new_capacity);
+            if (new_blob == NULL)
+            {
+                cstr_array_unlock(arr);
+                return false;
+            }
+
+            if (arr->blob_size)
+                memcpy(new_blob, arr->blob, arr->blob_size);
+
+            old = arr->blob;
+            old_capacity = arr->blob_capacity;
+            arr->blob = new_blob;
+            arr->blob_capacity = new_capacity;
+        }
+
+        if (!cstr_array_reserve(arr, 1, size))
+        {
+            if (old)
+            {
+                SecureZeroMemory(old, old_capacity);
+                free(old);
+            }
+            cstr_array_unlock(arr);
+            return false;
+        }
+
+        if (size)
+            memcpy(arr->blob + arr->blob_size, data, size);
+        if (old)
+        {
+            SecureZeroMemory(old, old_capacity);
+            free(old);
+        }
+        arr->blob[arr->blob_size + size] = '\0';
+        arr->blob_size += size + 1;
+
+        arr->count++;
+        arr->offsets[arr->count] = arr->blob_size;
+
+        cstr_array_unlock(arr);
+
+        return true;
+    }
+
+    /**
+     * @brief Append element from C string
+     * @param arr  CStringArray object
+     * @param data Null-terminated source string
+     * @return true on success
+     */
+    bool cstr_array_push_chars(_In_ CStringArray* arr, _In_ const char* data)
+    {
+        if (!arr || !data)
+            return false;
+
+        return cstr_array_push_buffer(arr, data, strlen(data));
+    }
+
+    /**
+     * @brief Append element from view
+     * @param arr  CStringArray object
+     * @param view Source characters (may be an element of arr)
+     * @return true on success
+     */
+    bool cstr_array_push_view(_In_ CStringArray* arr, _In_ CStringView view)
+    {
+        return cstr_array_push_buffer(arr, view.data, view.length);
+    }
+
+    /**
+     * @brief Append element from CString
+     * @param arr CStringArray object
+     * @param obj Source CString
+     * @return true on success
+     */
+    bool cstr_array_push_cstr(_In_ CStringArray* arr, _In_ CString* obj)
+    {
+        if (!arr || !obj)
+            return false;
+
+        cstr_lock(obj);
+
+        bool out = cstr_array_push_buffer(arr, obj->data, obj->length);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Get number of elements
+     * @param arr CStringArray object
+     * @return Element count or CSTR_INVALID
+     */
+    size_t cstr_array_size(_In_ CStringArray* arr)
+    {
+        if (!arr)
+            return cstr_invalid;
+
+        cstr_array_lock(arr);
+
+        size_t out = arr->count;
+
+        cstr_array_unlock(arr);
+
+        return out;
+    }
+
+    /**
+     * @brief Get view of element
+     * @param arr   CStringArray object
+     * @param index Element position (0-based)
+     * @param view  Output view (null-terminated)
+     * @return true if index valid, false otherwise
+     * @warning View valid until next modifying operation
+     */
+    bool cstr_array_get(_In_ CStringArray* arr, _In_ size_t index, _Out_ CStringView* view)
+    {
+        if (!arr || !view)
+            return false;
+
+        cstr_array_lock(arr);
+
+        if (index >= arr->count)
+        {
+            cstr_array_unlock(arr);
+            return false;
+        }
+
+        view->data = arr->blob + arr->offsets[index];
+        view->length = arr->offsets[index + 1] - arr->offsets[index] - 1;
+
+        cstr_array_unlock(arr);
+
+        return true;
+    }
+
+    /**
+     * @brief Iterate over elements
+     * @param arr   CStringArray object
+     * @param index Iteration position (start at 0, updated)
+     * @param view  Output view of current element
+     * @return true while an element was produced
+     *
+     * @code
+     * size_t it = 0;
+     * CStringView view;
+     * while (cstr_array_next(&arr, &it, &view))
+     *     printf("%s\n", view.data);
+     * @endcode
+     */
+    bool cstr_array_next(_In_ CStringArray* arr, _Inout_ size_t* index, _Out_ CStringView* view)
+    {
+        if (!index || !cstr_array_get(arr, *index, view))
+            return false;
+
+        (*index)++;
+
+        return true;
+    }
+
+    /**
+     * @brief Remove all elements
+     * @param arr CStringArray object
+     * @return true on success
+     * @note Keeps allocated storage, securely erases used bytes
+     */
+    bool cstr_array_clear(_In_ CStringArray* arr)
+    {
+        if (!arr)
+            return false;
+
+        cstr_array_lock(arr);
+
+        if (arr->blob)
+            SecureZeroMemory(arr->blob, arr->blob_size);
+
+        arr->blob_size = 0;
+        arr->count = 0;
+
+        cstr_array_unlock(arr);
+
+        return true;
+    }
+
+    /**
+     * @brief Sort elements in binary-safe lexicographic order
+     * @param arr CStringArray object
+     * @return true on success, false on allocation failure
+     * @note Sorts views with cstr_sort_views(), then rebuilds the blob in sorted order
+     */
+    bool cstr_array_sort(_In_ CStringArray* arr)
+    {
+        if (!arr)
+            return false;
+
+        cstr_array_lock(arr);
+
+        if (arr->count < 2)
+        {
+            cstr_array_unlock(arr);
+            return true;
+        }
+
+        CStringView* views = (CStringView*)malloc(arr->count * sizeof(CStringView));
+        char* blob = (char*)malloc(arr->blob_capacity);
+        if (!views || !blob)
+        {
+            free(views);
+            free(blob);
+            cstr_array_unlock(arr);
+            return false;
+        }
+
+        for (size_t i = 0; i < arr->count; ++i)
+        {
+            views[i].data = arr->blob + arr->offsets[i];
+            views[i].length = arr->offsets[i + 1] - arr->offsets[i] - 1;
+        }
+
+        if (!cstr_sort_views(views, arr->count))
+        {
+            free(views);
+            free(blob);
+            cstr_array_unlock(arr);
+            return false;
+        }
+
+        size_t offset = 0;
+        for (size_t i = 0; i < arr->count; ++i)
+        {
+            arr->offsets[i] = offset;
+            memcpy(blob + offset, views[i].data, views[i].length + 1);
+            offset += views[i].length + 1;
+        }
+
+        SecureZeroMemory(arr->blob, arr->blob_capacity);
+        free(arr->blob);
+        arr->blob = blob;
+
+        free(views);
+
+        cstr_array_unlock(arr);
+
+        return true;
+    }
+
+    /**
+     * @brief Append all tokens of a CString
+     * @param arr        Destination CStringArray
+     * @param obj        Source CString
+     * @param delimiters Separator characters
+     * @return Number of tokens appended or CSTR_INVALID on failure
+     * @note Same token rules as cstr_tokenize(), without per-token allocations
+     */
+    size_t cstr_array_tokenize(_In_ CStringArray* arr, _In_ CString* obj, _In_ const char* delimiters)
+    {
+        if (!arr || !obj || !delimiters)
+            return cstr_invalid;
+
+        cstr_lock(obj);
+        cstr_array_lock(arr);
+
+        size_t pos = 0;
+        size_t added = 0;
+        CStringView token;
+
+        while (cstr_scan_token(obj->data, obj->length, delimiters, &pos, &token))
+        {
+            if (!cstr_array_push_view(arr, token))
+            {
+                added = cstr_invalid;
+                break;
+            }
+            added++;
+        }
+
+        cstr_array_unlock(arr);
+        cstr_unlock(obj);
+
+        return added;
+    }
+
+    /**
+     * @brief Append all tokens of a CString with zones/escaping
+     * @param arr          Destination CStringArray
+     * @param obj          Source CString
+     * @param delimiters   Separator characters
+     * @param zone_pairs   Zone delimiter pairs (e.g., "\"\"''")
+     * @param escape_chars Escape characters
+     * @return Number of tokens appended or CSTR_INVALID on failure
+     * @note Same token rules as cstr_tokenize_ex(), without per-token allocations
+     */
+    size_t cstr_array_tokenize_ex(_In_ CStringArray* arr, _In_ CString* obj, _In_ const char* delimiters, _In_ const char* zone_pairs, _In_ const char* escape_chars)
+    {
+        if (!arr || !obj || !delimiters)
+            return cstr_invalid;
+
+        cstr_lock(obj);
+        cstr_array_lock(arr);
+
+        size_t pos = 0;
+        size_t added = 0;
+        CStringView token;
+
+        while (cstr_scan_token_ex(obj->data, obj->length, delimiters, zone_pairs, escape_chars, &pos, &token))
+        {
+            if (!cstr_array_push_view(arr, token))
+            {
+                added = cstr_invalid;
+                break;
+            }
+            added++;
+        }
+
+        cstr_array_unlock(arr);
+        cstr_unlock(obj);
+
+        return added;
+    }
+
+#endif // CSTR_IMPLEMENT_ARRAY
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_ARRAY_H
@@ -0,0 +1,1358 @@
+#pragma once
+
+/**
+ * @file cstr_art.h
+ * @brief Adaptive radix tree keyed by string contents.
+ *
+ * Supports exact, prefix and longest-prefix lookup. Writers are serialized
+ * by the tree lock; readers never lock and use optimistic lock coupling
+ * (per-node version words) instead. Replaced nodes are reclaimed by epochs:
+ * each reader announces the tree epoch in its own cache-line slot, and a
+ * node is freed once every announced epoch is newer than its retirement.
+ */
+
+#ifndef CSTR_ART_H
+#define CSTR_ART_H
+
+#include "cstr.h"
+#include "cstr_array.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CSTR_ART_NODE4   0  ///< Node with up to 4 children, sorted keys
+#define CSTR_ART_NODE16  1  ///< Node with up to 16 children, sorted keys, SIMD lookup
+#define CSTR_ART_NODE48  2  ///< Node with up to 48 children, 256-byte index
+#define CSTR_ART_NODE256 3  ///< Node with one slot per byte value
+
+#define CSTR_ART_LOCKED       0x1  ///< Version bit: node is being modified
+#define CSTR_ART_OBSOLETE     0x2  ///< Version bit: node was replaced
+#define CSTR_ART_VERSION_STEP 0x4  ///< Version increment per modification
+
+    /**
+     * @def CSTR_ART_MAX_READERS
+     * @brief Reader slots per tree (concurrent optimistic readers)
+     */
+#ifndef CSTR_ART_MAX_READERS
+#define CSTR_ART_MAX_READERS 64
+#endif
+
+#define CSTR_ART_IS_LEAF(p)  (((uintptr_t)(p)) & 1)
+#define CSTR_ART_LEAF(p)     ((CStringArtLeaf*)((uintptr_t)(p) & ~(uintptr_t)1))
+#define CSTR_ART_TAG_LEAF(p) ((void*)((uintptr_t)(p) | 1))
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define CSTR_ART_READ_FENCE() _ReadWriteBarrier()
+#else
+#define CSTR_ART_READ_FENCE() MemoryBarrier()
+#endif
+
+    /**
+     * @struct CStringArtLeaf
+     * @brief Stored key and its value
+     *
+     * @var value  - User value
+     * @var length - Key length
+     * @var key    - Key bytes (allocated inline, null-terminated)
+     */
+    typedef struct
+    {
+        void* volatile value;  ///< User value
+        size_t length;         ///< Key length
+        uint8_t key[1];        ///< Key bytes
+    }CStringArtLeaf;
+
+    /**
+     * @struct CStringArtNode
+     * @brief Common inner node header
+     *
+     * @var version    - Optimistic lock word (locked/obsolete bits + counter)
+     * @var type       - CSTR_ART_NODE4/16/48/256
+     * @var count      - Number of children
+     * @var prefix_len - Length of compressed path
+     * @var prefix     - Compressed path bytes (points into a leaf key)
+     * @var leaf       - Leaf for the key ending at this node, or NULL
+     *
+     * @note prefix/prefix_len never change after a node is published;
+     *       a prefix split replaces the node with a copy.
+     */
+    typedef struct
+    {
+        volatile LONG64 version;        ///< Optimistic lock word
+        uint8_t type;                   ///< Node kind
+        uint16_t count;                 ///< Number of children
+        uint32_t prefix_len;            ///< Compressed path length
+        const uint8_t* prefix;          ///< Compressed path bytes
+        CStringArtLeaf* volatile leaf;  ///< Key ending here
+    }CStringArtNode;
+
+    typedef struct
+    {
+        CStringArtNode n;
+        uint8_t keys[4];
+        void* volatile children[4];
+    }CStringArtNode4;
+
+    typedef struct
+    {
+        CStringArtNode n;
+        uint8_t keys[16];
+        void* volatile children[16];
+    }CStringArtNode16;
+
+    typedef struct
+    {
+        CStringArtNode n;
+        uint8_t index[256];             ///< Byte -> slot + 1, 0 when absent
+        void* volatile children[48];
+    }CStringArtNode48;
+
+    typedef struct
+    {
+        CStringArtNode n;
+        void* volatile children[256];
+    }CStringArtNode256;
+
+    /**
+     * @struct CStringArtSlot
+     * @brief Per-reader epoch announcement, one cache line each
+     *
+     * @var epoch - Tree epoch seen by the read in progress, 0 while quiescent
+     * @var owner - Nonzero while the slot is claimed by a reader
+     */
+    typedef struct
+    {
+        volatile LONG64 epoch;                              ///< Announced epoch
+        volatile LONG owner;                                ///< Claim flag
+        uint8_t pad[64 - sizeof(LONG64) - sizeof(LONG)];    ///< Keeps slots on separate cache lines
+    }CStringArtSlot;
+
+    /**
+     * @struct CStringArtRetired
+     * @brief Replaced node and the epoch it was retired in
+     */
+    typedef struct
+    {
+        CStringArtNode* node;   ///< Unreachable node
+        LONG64 epoch;           ///< Readers at this epoch or older may still hold node
+    }CStringArtRetired;
+
+    /**
+     * @struct CStringArt
+     * @brief Thread-safe adaptive radix tree
+     *
+     * @var root             - Root node or tagged leaf
+     * @var size             - Number of stored keys
+     * @var epoch            - Reclamation epoch, advanced on every retired node
+     * @var slots            - CSTR_ART_MAX_READERS reader slots
+     * @var retired          - Replaced nodes awaiting reclamation, oldest first
+     * @var retired_count    - Entries in retired
+     * @var retired_capacity - Allocated entries in retired
+     * @var lock             - Writer lock
+     */
+    typedef struct
+    {
+        void* volatile root;           ///< Root node or tagged leaf
+        size_t size;                   ///< Number of keys
+        volatile LONG64 epoch;         ///< Reclamation epoch
+        CStringArtSlot* slots;         ///< Reader slots
+        CStringArtRetired* retired;    ///< Nodes awaiting reclamation
+        size_t retired_count;          ///< Retired entries
+        size_t retired_capacity;       ///< Retired capacity
+        CStringLock lock;              ///< Writer lock
+    }CStringArt;
+
+    /**
+     * @struct CStringArtReader
+     * @brief Registered reader holding a slot for repeated lookups
+     *
+     * @var tree - Tree the reader is registered with
+     * @var slot - Claimed slot, or NULL to claim one per lookup
+     *
+     * @note A reader is used by one thread at a time
+     */
+    typedef struct
+    {
+        CStringArt* tree;       ///< Tree
+        CStringArtSlot* slot;   ///< Claimed slot
+    }CStringArtReader;
+
+    /**
+     * @brief Callback for prefix iteration
+     * @return true to continue, false to stop
+     */
+    typedef bool (*CStringArtCallback)(const char* key, size_t length, void* value, void* ctx);
+
+    CSTR_API bool cstr_art_create(_Inout_ CStringArt* tree);
+    CSTR_API bool cstr_art_destroy(_In_ CStringArt* tree);
+    CSTR_API bool cstr_art_insert(_In_ CStringArt* tree, _In_reads_(length) const char* key, _In_ size_t length, _In_opt_ void* value);
+    CSTR_API bool cstr_art_insert_cstr(_In_ CStringArt* tree, _In_ CString* obj, _In_opt_ void* value);
+    CSTR_API bool cstr_art_insert_array(_In_ CStringArt* tree, _In_ CStringArray* arr, _In_opt_ void* const* values);
+    CSTR_API bool cstr_art_find(_In_ CStringArt* tree, _In_reads_(length) const char* key, _In_ size_t length, _Out_opt_ void** value);
+    CSTR_API bool cstr_art_find_cstr(_In_ CStringArt* tree, _In_ CString* obj, _Out_opt_ void** value);
+    CSTR_API bool cstr_art_longest_prefix(_In_ CStringArt* tree, _In_reads_(length) const char* key, _In_ size_t length, _Out_opt_ void** value, _Out_opt_ size_t* match_len);
+    CSTR_API bool cstr_art_longest_prefix_cstr(_In_ CStringArt* tree, _In_ CString* obj, _Out_opt_ void** value, _Out_opt_ size_t* match_len);
+    CSTR_API bool cstr_art_reader_register(_In_ CStringArt* tree, _Out_ CStringArtReader* reader);
+    CSTR_API bool cstr_art_reader_unregister(_Inout_ CStringArtReader* reader);
+    CSTR_API bool cstr_art_reader_find(_In_ CStringArtReader* reader, _In_reads_(length) const char* key, _In_ size_t length, _Out_opt_ void** value);
+    CSTR_API bool cstr_art_reader_longest_prefix(_In_ CStringArtReader* reader, _In_reads_(length) const char* key, _In_ size_t length, _Out_opt_ void** value, _Out_opt_ size_t* match_len);
+    CSTR_API bool cstr_art_prefix(_In_ CStringArt* tree, _In_reads_(length) const char* prefix, _In_ size_t length, _In_ CStringArtCallback callback, _In_opt_ void* ctx);
+    CSTR_API size_t cstr_art_size(_In_ CStringArt* tree);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_ART)
+
+    /**
+     * @brief Initialize a new empty tree
+     * @param tree Pointer to CStringArt object to initialize
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_art_create(_Inout_ CStringArt* tree)
+    {
+        if (!tree)
+            return false;
+
+        tree->slots = (CStringArtSlot*)calloc(CSTR_ART_MAX_READERS, sizeof(CStringArtSlot));
+        if (!tree->slots)
+            return false;
+
+        tree->root = NULL;
+        tree->size = 0;
+        tree->epoch = 1;
+        tree->retired = NULL;
+        tree->retired_count = 0;
+        tree->retired_capacity = 0;
+
+        cstr_lock_init(&tree->lock);
+
+        return true;
+    }
+
+    /**
+     * @brief Allocation size of node type
+     */
+    CSTR_INLINE size_t cstr_art_node_size(_In_ uint8_t type)
+    {
+        switch (type)
+        {
+        case CSTR_ART_NODE4:   return sizeof(CStringArtNode4);
+        case CSTR_ART_NODE16:  return sizeof(CStringArtNode16);
+        case CSTR_ART_NODE48:  return sizeof(CStringArtNode48);
+        default:               return sizeof(CStringArtNode256);
+        }
+    }
+
+    /**
+     * @brief Allocate zeroed node
+     */
+    CSTR_INLINE CStringArtNode* cstr_art_node_alloc(_In_ uint8_t type)
+    {
+        CStringArtNode* node = (CStringArtNode*)calloc(1, cstr_art_node_size(type));
+        if (node)
+            node->type = type;
+        return node;
+    }
+
+    /**
+     * @brief Allocate leaf with copy of key
+     */
+    CSTR_INLINE CStringArtLeaf* cstr_art_leaf_alloc(_In_reads_(length) const uint8_t* key, _In_ size_t length, _In_opt_ void* value)
+    {
+        CStringArtLeaf* leaf = (CStringArtLeaf*)malloc(sizeof(CStringArtLeaf) + length);
+        if (!leaf)
+            return NULL;
+
+        leaf->value = value;
+        leaf->length = length;
+        if (length)
+            memcpy(leaf->key, key, length);
+        leaf->key[length] = '\0';
+
+        return leaf;
+    }
+
+    /**
+     * @brief Release subtree (nodes and leaves)
+     */
+    CSTR_INLINE void cstr_art_free_subtree(_In_opt_ void* ptr)
+    {
+        if (!ptr)
+            return;
+
+        if (CSTR_ART_IS_LEAF(ptr))
+        {
+            free(CSTR_ART_LEAF(ptr));
+            return;
+        }
+
+        CStringArtNode* node = (CStringArtNode*)ptr;
+        void* volatile* children;
+        size_t slots;
+
+        switch (node->type)
+        {
+        case CSTR_ART_NODE4:  children = ((CStringArtNode4*)node)->children;   slots = node->count; break;
+        case CSTR_ART_NODE16: children = ((CStringArtNode16*)node)->children;  slots = node->count; break;
+        case CSTR_ART_NODE48: children = ((CStringArtNode48*)node)->children;  slots = node->count; break;
+        default:              children = ((CStringArtNode256*)node)->children; slots = 256;         break;
+        }
+
+        for (size_t i = 0; i < slots; ++i)
+            cstr_art_free_subtree(children[i]);
+
+        free(node->leaf);
+        free(node);
+    }
+
+    /**
+     * @brief Oldest epoch an active reader may still be traversing
+     * @return Smallest announced epoch, or the current epoch when all readers are quiescent
+     */
+    CSTR_INLINE LONG64 cstr_art_oldest_epoch(_In_ CStringArt* tree)
+    {
+        LONG64 oldest = tree->epoch;
+
+        for (size_t i = 0; i < CSTR_ART_MAX_READERS; ++i)
+        {
+            LONG64 epoch = tree->slots[i].epoch;
+            if (epoch != 0 && epoch < oldest)
+                oldest = epoch;
+        }
+
+        return oldest;
+    }
+
+    /**
+     * @brief Free retired nodes that no reader can still reach
+     * @param tree Tree whose writer lock is held
+     * @param wait Wait until readers of older epochs finish instead of deferring
+     * @note Never waits for readers that started after the nodes were retired
+     */
+    CSTR_INLINE void cstr_art_reclaim(_Inout_ CStringArt* tree, _In_ bool wait)
+    {
+        if (tree->retired_count == 0)
+            return;
+
+        MemoryBarrier();
+
+        LONG64 oldest = cstr_art_oldest_epoch(tree);
+        if (wait)
+        {
+            while (oldest <= tree->retired[tree->retired_count - 1].epoch)
+            {
+                YieldProcessor();
+                oldest = cstr_art_oldest_epoch(tree);
+            }
+        }
+
+        // Entries are in retirement order, so the reclaimable ones form a prefix
+        size_t freed = 0;
+        while (freed < tree->retired_count && tree->retired[freed].epoch < oldest)
+            free(tree->retired[freed++].node);
+
+        if (freed)
+        {
+            tree->retired_count -= freed;
+            memmove(tree->retired, tree->retired + freed, tree->retired_count * sizeof(CStringArtRetired));
+        }
+    }
+
+    /**
+     * @brief Mark node obsolete and queue it for reclamation
+     * @param tree Tree whose writer lock is held
+     * @param node Node that is no longer reachable from the root
+     */
+    CSTR_INLINE void cstr_art_retire(_Inout_ CStringArt* tree, _In_ CStringArtNode* node)
+    {
+        MemoryBarrier();
+        node->version = node->version | CSTR_ART_OBSOLETE;
+
+        // Readers that announce the new epoch started after node became unreachable
+        LONG64 epoch = InterlockedIncrement64(&tree->epoch) - 1;
+
+        if (tree->retired_count == tree->retired_capacity)
+        {
+            size_t new_capacity = tree->retired_capacity ? tree->retired_capacity * 2 : 16;
+            CStringArtRetired* retired = (CStringArtRetired*)realloc(tree->retired, new_capacity * sizeof(CStringArtRetired));
+            if (!retired)
+            {
+                // No room to defer: wait out readers of this epoch and free now
+                cstr_art_reclaim(tree, true);
+                while (cstr_art_oldest_epoch(tree) <= epoch)
+                    YieldProcessor();
+                free(node);
+                return;
+            }
+            tree->retired = retired;
+            tree->retired_capacity = new_capacity;
+        }
+
+        tree->retired[tree->retired_count].node = node;
+        tree->retired[tree->retired_count].epoch = epoch;
+        tree->retired_count++;
+    }
+
+    /**
+     * @brief Destroy tree and release all nodes, leaves and retired nodes
+     * @param tree CStringArt to destroy
+     * @return true on success
+     * @warning No reader may be active; registered readers become invalid
+     */
+    bool cstr_art_destroy(_In_ CStringArt* tree)
+    {
+        if (!tree)
+            return false;
+
+        cstr_art_free_subtree(tree->root);
+        tree->root = NULL;
+
+        for (size_t i = 0; i < tree->retired_count; ++i)
+            free(tree->retired[i].node);
+        free(tree->retired);
+        free(tree->slots);
+
+        tree->slots = NULL;
+
+        tree->retired = NULL;
+        tree->retired_count = 0;
+        tree->retired_capacity = 0;
+        tree->size = 0;
+
+        return true;
+    }
+
+    /**
+     * @brief Get slot holding child for byte
+     * @param node  Inner node
+     * @param byte  Key byte
+     * @return Pointer to child slot or NULL if absent
+     * @note Node16 compares all keys at once with SSE2 when available
+     */
+    CSTR_INLINE void* volatile* cstr_art_find_child(_In_ CStringArtNode* node, _In_ uint8_t byte)
+    {
+        switch (node->type)
+        {
+        case CSTR_ART_NODE4:
+        {
+            CStringArtNode4* n = (CStringArtNode4*)node;
+            for (unsigned i = 0; i < n->n.count && i < 4; ++i)
+                if (n->keys[i] == byte)
+                    return &n->children[i];
+            return NULL;
+        }
+        case CSTR_ART_NODE16:
+        {
+            CStringArtNode16* n = (CStringArtNode16*)node;
+            unsigned count = n->n.count < 16 ? n->n.count : 16;
+#ifdef CSTR_HAVE_SSE2
+            __m128i cmp = _mm_cmpeq_epi8(_mm_set1_epi8((char)byte), _mm_loadu_si128((const __m128i*)n->keys));
+            uint32_t mask = (uint32_t)_mm_movemask_epi8(cmp) & ((1u << count) - 1);
+            return mask ? &n->children[cstr_ctz32(mask)] : NULL;
+#else
+            for (unsigned i = 0; i < count; ++i)
+                if (n->keys[i] == byte)
+                    return &n->children[i];
+            return NULL;
+#endif
+        }
+        case CSTR_ART_NODE48:
+        {
+            CStringArtNode48* n = (CStringArtNode48*)node;
+            uint8_t slot = n->index[byte];
+            return (slot && slot <= 48) ? &n->children[slot - 1] : NULL;
+        }
+        default:
+        {
+            CStringArtNode256* n = (CStringArtNode256*)node;
+            return n->children[byte] ? &n->children[byte] : NULL;
+        }
+        }
+    }
+
+    /**
+     * @brief Check whether node can take another child in place
+     */
+    CSTR_INLINE bool cstr_art_has_room(_In_ CStringArtNode* node)
+    {
+        switch (node->type)
+        {
+        case CSTR_ART_NODE4:  return node->count < 4;
+        case CSTR_ART_NODE16: return node->count < 16;
+        case CSTR_ART_NODE48: return node->count < 48;
+        default:              return true;
+        }
+    }
+
+    /**
+     * @brief Add child to node with room (caller handles versioning)
+     */
+    CSTR_INLINE void cstr_art_add_child(_Inout_ CStringArtNode* node, _In_ uint8_t byte, _In_ void* child)
+    {
+        switch (node->type)
+        {
+        case CSTR_ART_NODE4:
+        case CSTR_ART_NODE16:
+        {
+            uint8_t* keys = node->type == CSTR_ART_NODE4 ? ((CStringArtNode4*)node)->keys : ((CStringArtNode16*)node)->keys;
+            void* volatile* children = node->type == CSTR_ART_NODE4 ? ((CStringArtNode4*)node)->children : ((CStringArtNode16*)node)->children;
+
+            unsigned pos = 0;
+            while (pos < node->count && keys[pos] < byte)
+                pos++;
+
+            for (unsigned i = node->count; i > pos; --i)
+            {
+                keys[i] = keys[i - 1];
+                children[i] = children[i - 1];
+            }
+
+            keys[pos] = byte;
+            children[pos] = child;
+            node->count++;
+            break;
+        }
+        case CSTR_ART_NODE48:
+        {
+            CStringArtNode48* n = (CStringArtNode48*)node;
+            // Slots are never freed, so the next free slot is count
+            n->children[n->n.count] = child;
+            n->index[byte] = (uint8_t)(n->n.count + 1);
+            n->n.count++;
+            break;
+        }
+        default:
+            ((CStringArtNode256*)node)->children[byte] = child;
+            node->count++;
+            break;
+        }
+    }
+
+    /**
+     * @brief Copy node into the next larger node type
+     * @return New unpublished node or NULL on allocation failure
+     */
+    CSTR_INLINE CStringArtNode* cstr_art_grow(_In_ CStringArtNode* node)
+    {
+        CStringArtNode* grown = cstr_art_node_alloc((uint8_t)(node->type + 1));
+        if (!grown)
+            return NULL;
+
+        grown->prefix = node->prefix;
+        grown->prefix_len = node->prefix_len;
+        grown->leaf = node->leaf;
+
+        switch (node->type)
+        {
+        case CSTR_ART_NODE4:
+        {
+            CStringArtNode4* from = (CStringArtNode4*)node;
+            for (unsigned i = 0; i < from->n.count; ++i)
+                cstr_art_add_child(grown, from->keys[i], from->children[i]);
+            break;
+        }
+        case CSTR_ART_NODE16:
+        {
+            CStringArtNode16* from = (CStringArtNode16*)node;
+            for (unsigned i = 0; i < from->n.count; ++i)
+                cstr_art_add_child(grown, from->keys[i], from->children[i]);
+            break;
+        }
+        default:
+        {
+            CStringArtNode48* from = (CStringArtNode48*)node;
+            for (unsigned b = 0; b < 256; ++b)
+                if (from->index[b])
+                    cstr_art_add_child(grown, (uint8_t)b, from->children[from->index[b] - 1]);
+            break;
+        }
+        }
+
+        return grown;
+    }
+
+    /**
+     * @brief Begin in-place modification of a published node
+     */
+    CSTR_INLINE void cstr_art_write_begin(_Inout_ CStringArtNode* node)
+    {
+        node->version = node->version | CSTR_ART_LOCKED;
+        MemoryBarrier();
+    }
+
+    /**
+     * @brief End in-place modification of a published node
+     */
+    CSTR_INLINE void cstr_art_write_end(_Inout_ CStringArtNode* node)
+    {
+        MemoryBarrier();
+        node->version = (node->version + CSTR_ART_VERSION_STEP) & ~(LONG64)CSTR_ART_LOCKED;
+    }
+
+    /**
+     * @brief Publish fully built node or leaf into a slot
+     */
+    CSTR_INLINE void cstr_art_publish(_Inout_ void* volatile* slot, _In_ void* ptr)
+    {
+        MemoryBarrier();
+        *slot = ptr;
+    }
+
+    /**
+     * @brief Insert or update key (writer lock held)
+     * @return true on success, false on allocation failure
+     */
+    CSTR_INLINE bool cstr_art_insert_locked(_Inout_ CStringArt* tree, _In_reads_(length) const uint8_t* key, _In_ size_t length, _In_opt_ void* value)
+    {
+        void* volatile* ref = &tree->root;
+        size_t depth = 0;
+
+        for (;;)
+        {
+            void* ptr = *ref;
+
+            if (ptr == NULL)
+            {
+                CStringArtLeaf* leaf = cstr_art_leaf_alloc(key, length, value);
+                if (!leaf)
+                    return false;
+                cstr_art_publish(ref, CSTR_ART_TAG_LEAF(leaf));
+                tree->size++;
+                return true;
+            }
+
+            if (CSTR_ART_IS_LEAF(ptr))
+            {
+                CStringArtLeaf* old = CSTR_ART_LEAF(ptr);
+                if (old->length == length && memcmp(old->key, key, length) == 0)
+                {
+                    old->value = value;
+                    return true;
+                }
+
+                CStringArtLeaf* leaf = cstr_art_leaf_alloc(key, length, value);
+                CStringArtNode* node = cstr_art_node_alloc(CSTR_ART_NODE4);
+                if (!leaf || !node)
+                {
+                    free(leaf);
+                    free(node);
+                    return false;
+                }
+
+                size_t limit = (old->length < length ? old->length : length) - depth;
+                size_t common = 0;
+                while (common < limit && old->key[depth + common] == key[depth + common])
+                    common++;
+
+                node->prefix = leaf->key + depth;
+                node->prefix_len = (uint32_t)common;
+
+                size_t split = depth + common;
+                if (old->length == split)
+                    node->leaf = old;
+                else
+                    cstr_art_add_child(node, old->key[split], ptr);
+                if (length == split)
+                    node->leaf = leaf;
+                else
+                    cstr_art_add_child(node, key[split], CSTR_ART_TAG_LEAF(leaf));
+
+                cstr_art_publish(ref, node);
+                tree->size++;
+                return true;
+            }
+
+            CStringArtNode* node = (CStringArtNode*)ptr;
+
+            size_t limit = length - depth < node->prefix_len ? length - depth : node->prefix_len;
+            size_t match = 0;
+            while (match < limit && node->prefix[match] == key[depth + match])
+                match++;
+
+            if (match < node->prefix_len)
+            {
+                // Split compressed path: new parent + copy of node with shorter prefix
+                CStringArtLeaf* leaf = cstr_art_leaf_alloc(key, length, value);
+                CStringArtNode* parent = cstr_art_node_alloc(CSTR_ART_NODE4);
+                CStringArtNode* copy = (CStringArtNode*)malloc(cstr_art_node_size(node->type));
+                if (!leaf || !parent || !copy)
+                {
+                    free(leaf);
+                    free(parent);
+                    free(copy);
+                    return false;
+                }
+
+                memcpy(copy, node, cstr_art_node_size(node->type));
+                copy->version = 0;
+                copy->prefix = node->prefix + match + 1;
+                copy->prefix_len = node->prefix_len - (uint32_t)match - 1;
+
+                parent->prefix = node->prefix;
+                parent->prefix_len = (uint32_t)match;
+                cstr_art_add_child(parent, node->prefix[match], copy);
+                if (depth + match == length)
+                    parent->leaf = leaf;
+                else
+                    cstr_art_add_child(parent, key[depth + match], CSTR_ART_TAG_LEAF(leaf));
+
+                cstr_art_publish(ref, parent);
+                cstr_art_retire(tree, node);
+                tree->size++;
+                return true;
+            }
+
+            depth += node->prefix_len;
+
+            if (depth == length)
+            {
+                if (node->leaf)
+                {
+                    node->leaf->value = value;
+                    return true;
+                }
+
+                CStringArtLeaf* leaf = cstr_art_leaf_alloc(key, length, value);
+                if (!leaf)
+                    return false;
+
+                cstr_art_write_begin(node);
+                node->leaf = leaf;
+                cstr_art_write_end(node);
+                tree->size++;
+                return true;
+            }
+
+            void* volatile* child = cstr_art_find_child(node, key[depth]);
+            if (child)
+            {
+                ref = child;
+                depth++;
+                continue;
+            }
+
+            CStringArtLeaf* leaf = cstr_art_leaf_alloc(key, length, value);
+            if (!leaf)
+                return false;
+
+            if (cstr_art_has_room(node))
+            {
+                cstr_art_write_begin(node);
+                cstr_art_add_child(node, key[depth], CSTR_ART_TAG_LEAF(leaf));
+                cstr_art_write_end(node);
+            }
+            else
+            {
+                CStringArtNode* grown = cstr_art_grow(node);
+                if (!grown)
+                {
+                    free(leaf);
+                    return false;
+                }
+                cstr_art_add_child(grown, key[depth], CSTR_ART_TAG_LEAF(leaf));
+                cstr_art_publish(ref, grown);
+                cstr_art_retire(tree, node);
+            }
+
+            tree->size++;
+            return true;
+        }
+    }
+
+    /**
+     * @brief Insert or update key
+     * @param tree   CStringArt object
+     * @param key    Key bytes
+     * @param length Key length
+     * @param value  Value to associate
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_art_insert(_In_ CStringArt* tree, _In_reads_(length) const char* key, _In_ size_t length, _In_opt_ void* value)
+    {
+        if (!tree || (!key && length))
+            return false;
+
+        cstr_lock_acquire(&tree->lock);
+
+        bool out = cstr_art_insert_locked(tree, (const uint8_t*)key, length, value);
+        cstr_art_reclaim(tree, false);
+
+        cstr_lock_release(&tree->lock);
+
+        return out;
+    }
+
+    /**
+     * @brief Insert or update CString key
+     * @param tree  CStringArt object
+     * @param obj   Key
+     * @param value Value to associate
+     * @return true on success
+     */
+    bool cstr_art_insert_cstr(_In_ CStringArt* tree, _In_ CString* obj, _In_opt_ void* value)
+    {
+        if (!tree || !obj)
+            return false;
+
+        cstr_lock(obj);
+
+        bool out = cstr_art_insert(tree, obj->data, obj->length, value);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Bulk load all elements of a CStringArray
+     * @param tree   CStringArt object
+     * @param arr    Keys
+     * @param values Value per element, or NULL to store the element index
+     * @return true on success, false on allocation failure
+     * @note Takes the writer lock once for the whole load
+     */
+    bool cstr_art_insert_array(_In_ CStringArt* tree, _In_ CStringArray* arr, _In_opt_ void* const* values)
+    {
+        if (!tree || !arr)
+            return false;
+
+        cstr_array_lock(arr);
+        cstr_lock_acquire(&tree->lock);
+
+        bool out = true;
+        for (size_t i = 0; i < arr->count && out; ++i)
+        {
+            const uint8_t* key = (const uint8_t*)arr->blob + arr->offsets[i];
+            size_t length = arr->offsets[i + 1] - arr->offsets[i] - 1;
+            void* value = values ? values[i] : (void*)(uintptr_t)i;
+
+            out = cstr_art_insert_locked(tree, key, length, value);
+        }
+
+        cstr_art_reclaim(tree, false);
+
+        cstr_lock_release(&tree->lock);
+        cstr_array_unlock(arr);
+
+        return out;
+    }
+
+    /**
+     * @brief Wait until node is not being modified
+     * @return Version to validate against, or CSTR_ART_OBSOLETE if replaced
+     */
+    CSTR_INLINE LONG64 cstr_art_read_begin(_In_ CStringArtNode* node)
+    {
+        for (;;)
+        {
+            LONG64 version = node->version;
+            if (version & CSTR_ART_OBSOLETE)
+                return CSTR_ART_OBSOLETE;
+            if (!(version & CSTR_ART_LOCKED))
+            {
+                CSTR_ART_READ_FENCE();
+                return version;
+            }
+            YieldProcessor();
+        }
+    }
+
+    /**
+     * @brief Check that node did not change since cstr_art_read_begin()
+     */
+    CSTR_INLINE bool cstr_art_read_validate(_In_ CStringArtNode* node, _In_ LONG64 version)
+    {
+        CSTR_ART_READ_FENCE();
+        return node->version == version;
+    }
+
+    /**
+     * @brief Claim a free reader slot
+     * @return Slot, or NULL if all CSTR_ART_MAX_READERS slots are taken
+     * @note Probing starts at a per-thread position so concurrent readers
+     *       usually claim different slots on the first try
+     */
+    CSTR_INLINE CStringArtSlot* cstr_art_slot_claim(_In_ CStringArt* tree)
+    {
+        size_t start = (size_t)GetCurrentThreadId();
+
+        for (size_t i = 0; i < CSTR_ART_MAX_READERS; ++i)
+        {
+            CStringArtSlot* slot = &tree->slots[(start + i) % CSTR_ART_MAX_READERS];
+            if (slot->owner == 0 && InterlockedCompareExchange(&slot->owner, 1, 0) == 0)
+                return slot;
+        }
+
+        return NULL;
+    }
+
+    /**
+     * @brief Optimistic lookup shared by exact and longest-prefix queries
+     * @param tree    CStringArt object
+     * @param slot    Claimed reader slot, or NULL when the writer lock is held
+     * @param key     Key bytes
+     * @param length  Key length
+     * @param exact   Output leaf equal to key, or NULL
+     * @param longest Output leaf with longest key that prefixes key, or NULL
+     * @note Lock-free for readers; restarts when a visited node changes
+     */
+    CSTR_INLINE void cstr_art_search(_In_ CStringArt* tree, _In_opt_ CStringArtSlot* slot, _In_reads_(length) const uint8_t* key, _In_ size_t length, _Out_ CStringArtLeaf** exact, _Out_ CStringArtLeaf** longest)
+    {
+        // Full barrier: the announcement is visible before any node is read
+        if (slot)
+            InterlockedExchange64(&slot->epoch, tree->epoch);
+
+    restart:
+        *exact = NULL;
+        *longest = NULL;
+
+        void* ptr = tree->root;
+        size_t depth = 0;
+
+        if (ptr && CSTR_ART_IS_LEAF(ptr))
+        {
+            CStringArtLeaf* leaf = CSTR_ART_LEAF(ptr);
+            if (leaf->length <= length && memcmp(leaf->key, key, leaf->length) == 0)
+            {
+                *longest = leaf;
+                if (leaf->length == length)
+                    *exact = leaf;
+            }
+        }
+        else if (ptr)
+        {
+            CStringArtNode* node = (CStringArtNode*)ptr;
+            LONG64 version = cstr_art_read_begin(node);
+            if (version == CSTR_ART_OBSOLETE)
+                goto restart;
+
+            for (;;)
+            {
+                size_t prefix_len = node->prefix_len;
+                if (prefix_len > length - depth || memcmp(node->prefix, key + depth, prefix_len) != 0)
+                {
+                    if (!cstr_art_read_validate(node, version))
+                        goto restart;
+                    break;
+                }
+
+                depth += prefix_len;
+
+                CStringArtLeaf* here = node->leaf;
+                void* child = NULL;
+                if (depth < length)
+                {
+                    void* volatile* slot = cstr_art_find_child(node, key[depth]);
+                    child = slot ? *slot : NULL;
+                }
+
+                if (!cstr_art_read_validate(node, version))
+                    goto restart;
+
+                if (here)
+                {
+                    *longest = here;
+                    if (depth == length)
+                        *exact = here;
+                }
+
+                if (depth == length || !child)
+                    break;
+
+                if (CSTR_ART_IS_LEAF(child))
+                {
+                    CStringArtLeaf* leaf = CSTR_ART_LEAF(child);
+                    if (leaf->length <= length && memcmp(leaf->key, key, leaf->length) == 0)
+                    {
+                        *longest = leaf;
+                        if (leaf->length == length)
+                            *exact = leaf;
+                    }
+                    break;
+                }
+
+                CStringArtNode* next = (CStringArtNode*)child;
+                LONG64 next_version = cstr_art_read_begin(next);
+                if (next_version == CSTR_ART_OBSOLETE || !cstr_art_read_validate(node, version))
+                    goto restart;
+
+                node = next;
+                version = next_version;
+                depth++;
+            }
+        }
+
+        if (slot)
+        {
+            CSTR_ART_READ_FENCE();
+            slot->epoch = 0;
+        }
+    }
+
+    /**
+     * @brief Run cstr_art_search() with the reader's slot or a transient one
+     * @note Falls back to the writer lock when every slot is taken
+     */
+    CSTR_INLINE void cstr_art_lookup(_In_ CStringArtReader* reader, _In_reads_(length) const uint8_t* key, _In_ size_t length, _Out_ CStringArtLeaf** exact, _Out_ CStringArtLeaf** longest)
+    {
+        CStringArt* tree = reader->tree;
+
+        if (reader->slot)
+        {
+            cstr_art_search(tree, reader->slot, key, length, exact, longest);
+            return;
+        }
+
+        CStringArtSlot* slot = cstr_art_slot_claim(tree);
+        if (slot)
+        {
+            cstr_art_search(tree, slot, key, length, exact, longest);
+            InterlockedExchange(&slot->owner, 0);
+            return;
+        }
+
+        cstr_lock_acquire(&tree->lock);
+        cstr_art_search(tree, NULL, key, length, exact, longest);
+        cstr_lock_release(&tree->lock);
+    }
+
+    /**
+     * @brief Register a reader for repeated lookups
+     * @param tree   CStringArt object
+     * @param reader Receives the reader
+     * @return true if a slot was claimed
+     * @note On failure the reader is still usable and claims a slot per lookup.
+     *       Release the slot with cstr_art_reader_unregister()
+     */
+    bool cstr_art_reader_register(_In_ CStringArt* tree, _Out_ CStringArtReader* reader)
+    {
+        if (!reader)
+            return false;
+
+        reader->tree = tree;
+        reader->slot = tree ? cstr_art_slot_claim(tree) : NULL;
+
+        return reader->slot != NULL;
+    }
+
+    /**
+     * @brief Release the slot of a registered reader
+     * @param reader Reader from cstr_art_reader_register()
+     * @return true if a slot was released
+     */
+    bool cstr_art_reader_unregister(_Inout_ CStringArtReader* reader)
+    {
+        if (!reader || !reader->slot)
+            return false;
+
+        InterlockedExchange(&reader->slot->owner, 0);
+        reader->slot = NULL;
+
+        return true;
+    }
+
+    /**
+     * @brief Exact lookup through a registered reader
+     * @param reader Reader from cstr_art_reader_register()
+     * @param key    Key bytes
+     * @param length Key length
+     * @param value  Output value (may be NULL)
+     * @return true if key present
+     */
+    bool cstr_art_reader_find(_In_ CStringArtReader* reader, _In_reads_(length) const char* key, _In_ size_t length, _Out_opt_ void** value)
+    {
+        if (!reader || !reader->tree || (!key && length))
+            return false;
+
+        CStringArtLeaf* exact;
+        CStringArtLeaf* longest;
+        cstr_art_lookup(reader, (const uint8_t*)key, length, &exact, &longest);
+
+        if (!exact)
+            return false;
+
+        if (value)
+            *value = exact->value;
+
+        return true;
+    }
+
+    /**
+     * @brief Longest-prefix lookup through a registered reader
+     * @param reader    Reader from cstr_art_reader_register()
+     * @param key       Query bytes
+     * @param length    Query length
+     * @param value     Output value (may be NULL)
+     * @param match_len Output length of matched key (may be NULL)
+     * @return true if any stored key prefixes the query
+     */
+    bool cstr_art_reader_longest_prefix(_In_ CStringArtReader* reader, _In_reads_(length) const char* key, _In_ size_t length, _Out_opt_ void** value, _Out_opt_ size_t* match_len)
+    {
+        if (!reader || !reader->tree || (!key && length))
+            return false;
+
+        CStringArtLeaf* exact;
+        CStringArtLeaf* longest;
+        cstr_art_lookup(reader, (const uint8_t*)key, length, &exact, &longest);
+
+        if (!longest)
+            return false;
+
+        if (value)
+            *value = longest->value;
+        if (match_len)
+            *match_len = longest->length;
+
+        return true;
+    }
+
+    /**
+     * @brief Exact lookup
+     * @param tree   CStringArt object
+     * @param key    Key bytes
+     * @param length Key length
+     * @param value  Output value (may be NULL)
+     * @return true if key present
+     * @note Claims a reader slot for the call; use cstr_art_reader_find() in hot loops
+     */
+    bool cstr_art_find(_In_ CStringArt* tree, _In_reads_(length) const char* key, _In_ size_t length, _Out_opt_ void** value)
+    {
+        CStringArtReader reader = { tree, NULL };
+
+        return cstr_art_reader_find(&reader, key, length, value);
+    }
+
+    /**
+     * @brief Exact lookup by CString
+     * @param tree  CStringArt object
+     * @param obj   Key
+     * @param value Output value (may be NULL)
+     * @return true if key present
+     */
+    bool cstr_art_find_cstr(_In_ CStringArt* tree, _In_ CString* obj, _Out_opt_ void** value)
+    {
+        if (!tree || !obj)
+            return false;
+
+        cstr_lock(obj);
+
+        bool out = cstr_art_find(tree, obj->data, obj->length, value);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Longest stored key that is a prefix of the query
+     * @param tree      CStringArt object
+     * @param key       Query bytes
+     * @param length    Query length
+     * @param value     Output value (may be NULL)
+     * @param match_len Output length of matched key (may be NULL)
+     * @return true if any stored key prefixes the query
+     *
+     * @code
+     * // routes "/", "/api", "/api/users"
+     * cstr_art_longest_prefix(&routes, "/api/users/42", 13, &handler, &len); // len == 10
+     * @endcode
+     */
+    bool cstr_art_longest_prefix(_In_ CStringArt* tree, _In_reads_(length) const char* key, _In_ size_t length, _Out_opt_ void** value, _Out_opt_ size_t* match_len)
+    {
+        CStringArtReader reader = { tree, NULL };
+
+        return cstr_art_reader_longest_prefix(&reader, key, length, value, match_len);
+    }
+
+    /**
+     * @brief Longest-prefix lookup by CString
+     * @param tree      CStringArt object
+     * @param obj       Query
+     * @param value     Output value (may be NULL)
+     * @param match_len Output length of matched key (may be NULL)
+     * @return true if any stored key prefixes the query
+     */
+    bool cstr_art_longest_prefix_cstr(_In_ CStringArt* tree, _In_ CString* obj, _Out_opt_ void** value, _Out_opt_ size_t* match_len)
+    {
+        if (!tree || !obj)
+            return false;
+
+        cstr_lock(obj);
+
+        bool out = cstr_art_longest_prefix(tree, obj->data, obj->length, value, match_len);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Append a leaf to a growable list
+     * @return false on allocation failure
+     */
+    CSTR_INLINE bool cstr_art_collect_leaf(_In_ CStringArtLeaf* leaf, _Inout_ CStringArtLeaf*** leaves, _Inout_ size_t* count, _Inout_ size_t* capacity)
+    {
+        if (*count == *capacity)
+        {
+            size_t new_capacity = *capacity ? *capacity * 2 : 16;
+            CStringArtLeaf** grown = (CStringArtLeaf**)realloc(*leaves, new_capacity * sizeof(CStringArtLeaf*));
+            if (!grown)
+                return false;
+
+            *leaves = grown;
+            *capacity = new_capacity;
+        }
+
+        (*leaves)[(*count)++] = leaf;
+
+        return true;
+    }
+
+    /**
+     * @brief Collect the leaves of a subtree in key order
+     * @return false on allocation failure
+     * @note Caller holds the writer lock
+     */
+    CSTR_INLINE bool cstr_art_collect(_In_opt_ void* ptr, _Inout_ CStringArtLeaf*** leaves, _Inout_ size_t* count, _Inout_ size_t* capacity)
+    {
+        if (!ptr)
+            return true;
+
+        if (CSTR_ART_IS_LEAF(ptr))
+            return cstr_art_collect_leaf(CSTR_ART_LEAF(ptr), leaves, count, capacity);
+
+        CStringArtNode* node = (CStringArtNode*)ptr;
+
+        if (node->leaf && !cstr_art_collect_leaf(node->leaf, leaves, count, capacity))
+            return false;
+
+        switch (node->type)
+        {
+        case CSTR_ART_NODE4:
+            for (unsigned i = 0; i < node->count; ++i)
+                if (!cstr_art_collect(((CStringArtNode4*)node)->children[i], leaves, count, capacity))
+                    return false;
+            break;
+        case CSTR_ART_NODE16:
+            for (unsigned i = 0; i < node->count; ++i)
+                if (!cstr_art_collect(((CStringArtNode16*)node)->children[i], leaves, count, capacity))
+                    return false;
+            break;
+        case CSTR_ART_NODE48:
+        {
+            CStringArtNode48* n = (CStringArtNode48*)node;
+            for (unsigned b = 0; b < 256; ++b)
+                if (n->index[b] && !cstr_art_collect(n->children[n->index[b] - 1], leaves, count, capacity))
+                    return false;
+            break;
+        }
+        default:
+            for (unsigned b = 0; b < 256; ++b)
+                if (!cstr_art_collect(((CStringArtNode256*)node)->children[b], leaves, count, capacity))
+                    return false;
+            break;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Visit all keys starting with prefix, in key order
+     * @param tree     CStringArt object
+     * @param prefix   Prefix bytes
+     * @param length   Prefix length
+     * @param callback Called per key; return false to stop
+     * @param ctx      User context passed to callback
+     * @return true on success, false on invalid arguments or allocation failure
+     * @note Matching keys are collected under the writer lock and the callback
+     *       runs after it is released, so callbacks may insert into the tree.
+     *       Keys inserted during the iteration are not visited. Leaves are
+     *       only freed by cstr_art_destroy(), which must not run concurrently
+     */
+    bool cstr_art_prefix(_In_ CStringArt* tree, _In_reads_(length) const char* prefix, _In_ size_t length, _In_ CStringArtCallback callback, _In_opt_ void* ctx)
+    {
+        if (!tree || !callback || (!prefix && length))
+            return false;
+
+        const uint8_t* key = (const uint8_t*)prefix;
+
+        cstr_lock_acquire(&tree->lock);
+
+        void* ptr = tree->root;
+        size_t depth = 0;
+
+        while (ptr && !CSTR_ART_IS_LEAF(ptr))
+        {
+            CStringArtNode* node = (CStringArtNode*)ptr;
+
+            size_t remaining = length - depth;
+            size_t limit = remaining < node->prefix_len ? remaining : node->prefix_len;
+            if (memcmp(node->prefix, key + depth, limit) != 0)
+            {
+                ptr = NULL;
+                break;
+            }
+
+            // Prefix ends inside or right after this node's path: whole subtree matches
+            if (remaining <= node->prefix_len)
+                break;
+
+            depth += node->prefix_len;
+
+            void* volatile* child = cstr_art_find_child(node, key[depth]);
+            ptr = child ? *child : NULL;
+            depth++;
+        }
+
+        if (ptr && CSTR_ART_IS_LEAF(ptr))
+        {
+            CStringArtLeaf* leaf = CSTR_ART_LEAF(ptr);
+            if (leaf->length < length || memcmp(leaf->key, key, length) != 0)
+                ptr = NULL;
+        }
+
+        CStringArtLeaf** leaves = NULL;
+        size_t count = 0;
+        size_t capacity = 0;
+        bool out = cstr_art_collect(ptr, &leaves, &count, &capacity);
+
+        cstr_lock_release(&tree->lock);
+
+        if (out)
+        {
+            for (size_t i = 0; i < count; ++i)
+                if (!callback((const char*)leaves[i]->key, leaves[i]->length, leaves[i]->value, ctx))
+                    break;
+        }
+
+        free(leaves);
+
+        return out;
+    }
+
+    /**
+     * @brief Get number of stored keys
+     * @param tree CStringArt object
+     * @return Key count or CSTR_INVALID
+     */
+    size_t cstr_art_size(_In_ CStringArt* tree)
+    {
+        if (!tree)
+            return cstr_invalid;
+
+        cstr_lock_acquire(&tree->lock);
+
+        size_t out = tree->size;
+
+        cstr_lock_release(&tree->lock);
+
+        return out;
+    }
+
+#endif // CSTR_IMPLEMENT_ART
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_ART_H
@@ -0,0 +1,571 @@
+#pragma once
+
+/**
+ * @file cstr_basic.hpp
+ * @brief Policy-based string template sharing the cstr.h kernels.
+ *
+ * basic_cstring<LockPolicy, Allocator> replaces the fixed CStringLock and
+ * malloc of CString with template parameters. Search, comparison and
+ * hashing call the same view kernels as the C API. Empty policies take
+ * no space, and null_lock operations inline to nothing.
+ */
+
+#ifndef CSTR_BASIC_HPP
+#define CSTR_BASIC_HPP
+
+#include "cstr.hpp"
+
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+
+namespace cstr
+{
+    /**
+     * @brief Lock policy for strings confined to one thread (no synchronization)
+     */
+    struct null_lock
+    {
+        void lock() noexcept {}
+        void unlock() noexcept {}
+        void lock_shared() noexcept {}
+        void unlock_shared() noexcept {}
+    };
+
+    /**
+     * @brief Lock policy using the recursive CStringLock of the C API
+     */
+    struct c_lock
+    {
+        CStringLock state = {};  ///< Lock word
+
+        void lock() noexcept
+        {
+            cstr_lock_acquire(&state);
+        }
+
+        void unlock() noexcept
+        {
+            cstr_lock_release(&state);
+        }
+    };
+
+    using mutex_lock = std::mutex;         ///< Exclusive lock for shared strings
+    using rw_lock = std::shared_mutex;     ///< Reader/writer lock for read-mostly strings
+
+    namespace detail
+    {
+        /**
+         * @brief Storage slot that takes no space for empty policy types
+         */
+        template <class T, int Tag, bool Empty = std::is_empty_v<T> && !std::is_final_v<T>>
+        struct policy_slot : private T
+        {
+            policy_slot() = default;
+
+            explicit policy_slot(const T& value)
+                : T(value)
+            {
+            }
+
+            T& get() noexcept
+            {
+                return *this;
+            }
+
+            const T& get() const noexcept
+            {
+                return *this;
+            }
+        };
+
+        template <class T, int Tag>
+        struct policy_slot<T, Tag, false>
+        {
+            policy_slot() = default;
+
+            explicit policy_slot(const T& value)
+                : value(value)
+            {
+            }
+
+            T& get() noexcept
+            {
+                return value;
+            }
+
+            const T& get() const noexcept
+            {
+                return value;
+            }
+
+            T value;  ///< Stored policy
+        };
+
+        template <class Lock, class = void>
+        struct has_shared_lock : std::false_type {};
+
+        template <class Lock>
+        struct has_shared_lock<Lock, std::void_t<decltype(std::declval<Lock&>().lock_shared())>> : std::true_type {};
+
+        /**
+         * @brief Scoped read lock; falls back to exclusive locking when the policy has no shared mode
+         */
+        template <class Lock>
+        class read_guard
+        {
+        public:
+            explicit read_guard(Lock& lock) noexcept
+                : lock_(lock)
+            {
+                if constexpr (has_shared_lock<Lock>::value)
+                    lock_.lock_shared();
+                else
+                    lock_.lock();
+            }
+
+            ~read_guard()
+            {
+                if constexpr (has_shared_lock<Lock>::value)
+                    lock_.unlock_shared();
+                else
+                    lock_.unlock();
+            }
+
+            read_guard(const read_guard&) = delete;
+            read_guard& operator=(const read_guard&) = delete;
+
+        private:
+            Lock& lock_;  ///< Held lock
+        };
+
+        /**
+         * @brief Scoped exclusive lock
+         */
+        template <class Lock>
+        class write_guard
+        {
+        public:
+            explicit write_guard(Lock& lock) noexcept
+                : lock_(lock)
+            {
+                lock_.lock();
+            }
+
+            ~write_guard()
+            {
+                lock_.unlock();
+            }
+
+            write_guard(const write_guard&) = delete;
+            write_guard& operator=(const write_guard&) = delete;
+
+        private:
+            Lock& lock_;  ///< Held lock
+        };
+    }
+
+    /**
+     * @class basic_cstring
+     * @brief String with pluggable synchronization and allocation
+     * @tparam LockPolicy Type with lock()/unlock() and optionally lock_shared()/unlock_shared()
+     * @tparam Allocator  Standard allocator for char
+     *
+     * Reads take the shared lock and writes the exclusive one. Pointers and
+     * views returned by data()/view() are valid until the next modification,
+     * as with cstr_view().
+     */
+    template <class LockPolicy = null_lock, class Allocator = std::allocator<char>>
+    class basic_cstring : private detail::policy_slot<LockPolicy, 0>, private detail::policy_slot<Allocator, 1>
+    {
+        using lock_slot = detail::policy_slot<LockPolicy, 0>;
+        using alloc_slot = detail::policy_slot<Allocator, 1>;
+        using traits = std::allocator_traits<Allocator>;
+
+        static_assert(std::is_same_v<typename traits::value_type, char>, "Allocator must allocate char");
+
+    public:
+        using lock_policy = LockPolicy;
+        using allocator_type = Allocator;
+        using value_type = char;
+        using size_type = size_t;
+
+        basic_cstring() noexcept(noexcept(Allocator()))
+            : basic_cstring(Allocator())
+        {
+        }
+
+        explicit basic_cstring(const Allocator& alloc) noexcept
+            : lock_slot(), alloc_slot(alloc), data_(nullptr), length_(0), capacity_(0)
+        {
+        }
+
+        basic_cstring(std::string_view value, const Allocator& alloc = Allocator())
+            : basic_cstring(alloc)
+        {
+            *this += value;
+        }
+
+        basic_cstring(const char* value, const Allocator& alloc = Allocator())
+            : basic_cstring(std::string_view(value ? value : ""), alloc)
+        {
+        }
+
+        /**
+         * @brief Materialize a concatenation expression with one allocation
+         */
+        template <class Left, class Right>
+        basic_cstring(const ConcatExpr<Left, Right>& expr, const Allocator& alloc = Allocator())
+            : basic_cstring(alloc)
+        {
+            *this += expr;
+        }
+
+        basic_cstring(const basic_cstring& other)
+            : basic_cstring(other.view(), traits::select_on_container_copy_construction(other.get_allocator()))
+        {
+        }
+
+        basic_cstring(basic_cstring&& other) noexcept
+            : lock_slot(), alloc_slot(std::move(other.alloc())), data_(other.data_), length_(other.length_), capacity_(other.capacity_)
+        {
+            other.data_ = nullptr;
+            other.length_ = 0;
+            other.capacity_ = 0;
+        }
+
+        basic_cstring& operator=(const basic_cstring& other)
+        {
+            if (this != &other)
+            {
+                if constexpr (traits::propagate_on_container_copy_assignment::value)
+                {
+                    if (alloc() != other.alloc())
+                    {
+                        release();
+                        alloc() = other.alloc();
+                    }
+                }
+
+                CStringView part = other.c_view();
+                detail::write_guard<LockPolicy> guard(lock());
+                length_ = 0;
+                append_views(&part, 1);
+            }
+            return *this;
+        }
+
+        basic_cstring& operator=(basic_cstring&& other) noexcept(traits::propagate_on_container_move_assignment::value || traits::is_always_equal::value)
+        {
+            if (this == &other)
+                return *this;
+
+            if constexpr (!traits::propagate_on_container_move_assignment::value && !traits::is_always_equal::value)
+            {
+                // Buffers of unequal allocators cannot change hands: copy instead
+                if (alloc() != other.alloc())
+                    return *this = static_cast<const basic_cstring&>(other);
+            }
+
+            release();
+
+            if constexpr (traits::propagate_on_container_move_assignment::value)
+                alloc() = std::move(other.alloc());
+
+            data_ = other.data_;
+            length_ = other.length_;
+            capacity_ = other.capacity_;
+
+            other.data_ = nullptr;
+            other.length_ = 0;
+            other.capacity_ = 0;
+
+            return *this;
+        }
+
+        ~basic_cstring()
+        {
+            release();
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return alloc();
+        }
+
+        size_type size() const noexcept
+        {
+            detail::read_guard<LockPolicy> guard(lock());
+            return length_;
+        }
+
+        size_type length() const noexcept
+        {
+            return size();
+        }
+
+        size_type capacity() const noexcept
+        {
+            detail::read_guard<LockPolicy> guard(lock());
+            return capacity_ ? capacity_ - 1 : 0;
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        /**
+         * @brief Pointer to the characters (never NULL)
+         */
+        const char* data() const noexcept
+        {
+            detail::read_guard<LockPolicy> guard(lock());
+            return data_ ? data_ : "";
+        }
+
+        const char* c_str() const noexcept
+        {
+            return data();
+        }
+
+        std::string_view view() const noexcept
+        {
+            detail::read_guard<LockPolicy> guard(lock());
+            return std::string_view(data_ ? data_ : "", length_);
+        }
+
+        operator std::string_view() const noexcept
+        {
+            return view();
+        }
+
+        CStringView c_view() const noexcept
+        {
+            std::string_view out = view();
+            return CStringView{ out.data(), out.size() };
+        }
+
+        /**
+         * @brief Ensure room for a string of given length
+         */
+        void reserve(size_type length)
+        {
+            detail::write_guard<LockPolicy> guard(lock());
+            if (length + 1 > capacity_)
+            {
+                size_t old_capacity = 0;
+                char* old = grow(length - length_, &old_capacity);
+                if (old)
+                    traits::deallocate(alloc(), old, old_capacity);
+            }
+        }
+
+        void clear() noexcept
+        {
+            detail::write_guard<LockPolicy> guard(lock());
+            length_ = 0;
+            if (data_)
+                data_[0] = '\0';
+        }
+
+        void push_back(char value)
+        {
+            CStringView part{ &value, 1 };
+            detail::write_guard<LockPolicy> guard(lock());
+            append_views(&part, 1);
+        }
+
+        /**
+         * @brief Append an operand or concatenation expression
+         */
+        template <class T>
+        basic_cstring& operator+=(const T& value)
+        {
+            using Operand = concat_operand_t<T>;
+
+            const Operand& expr = cat(value);
+            std::array<CStringView, Operand::count> parts;
+            CStringView* cursor = parts.data();
+            expr.collect(cursor);
+
+            detail::write_guard<LockPolicy> guard(lock());
+            append_views(parts.data(), parts.size());
+            return *this;
+        }
+
+        /**
+         * @brief Find substring (cstr_view_find)
+         * @return Starting index or CSTR_INVALID
+         */
+        size_type find(std::string_view needle, size_type start = 0) const noexcept
+        {
+            detail::read_guard<LockPolicy> guard(lock());
+            if (start > length_)
+                return cstr_invalid;
+
+            size_t index = cstr_view_find(CStringView{ data_ + start, length_ - start }, CStringView{ needle.data(), needle.size() });
+            return index == cstr_invalid ? cstr_invalid : start + index;
+        }
+
+        bool contains(std::string_view needle) const noexcept
+        {
+            return find(needle) != cstr_invalid;
+        }
+
+        /**
+         * @brief Binary-safe three-way comparison (cstr_view_compare)
+         */
+        int compare(std::string_view other) const noexcept
+        {
+            detail::read_guard<LockPolicy> guard(lock());
+            return cstr_view_compare(CStringView{ data_ ? data_ : "", length_ }, CStringView{ other.data(), other.size() });
+        }
+
+        /**
+         * @brief Hash of the contents (cstr_view_hash)
+         */
+        size_t hash() const noexcept
+        {
+            detail::read_guard<LockPolicy> guard(lock());
+            return (size_t)cstr_view_hash(CStringView{ data_ ? data_ : "", length_ });
+        }
+
+    private:
+        LockPolicy& lock() const noexcept
+        {
+            return const_cast<LockPolicy&>(static_cast<const lock_slot*>(this)->get());
+        }
+
+        Allocator& alloc() noexcept
+        {
+            return static_cast<alloc_slot*>(this)->get();
+        }
+
+        const Allocator& alloc() const noexcept
+        {
+            return static_cast<const alloc_slot*>(this)->get();
+        }
+
+        /**
+         * @brief Free the buffer (caller holds the lock or owns the object exclusively)
+         */
+        void release() noexcept
+        {
+            if (data_)
+                traits::deallocate(alloc(), data_, capacity_);
+
+            data_ = nullptr;
+            length_ = 0;
+            capacity_ = 0;
+        }
+
+        /**
+         * @brief Move to a larger buffer with room for added more characters
+         * @param added        Characters about to be appended
+         * @param old_capacity Receives the size of the returned old buffer
+         * @return Previous buffer (nullptr if none); the caller deallocates it
+         * @note Grows like cstr_reserve(); the lock must be held
+         */
+        char* grow(size_type added, size_t* old_capacity)
+        {
+            if (added > cstr_invalid - 2 - length_)
+                throw std::length_error("basic_cstring too long");
+
+            size_t capacity = capacity_ + capacity_ / 2;
+            if (capacity < length_ + added + 1)
+                capacity = length_ + added + 1;
+
+            char* data = traits::allocate(alloc(), capacity);
+            if (length_)
+                std::memcpy(data, data_, length_);
+            data[length_] = '\0';
+
+            char* old = data_;
+            *old_capacity = capacity_;
+
+            data_ = data;
+            capacity_ = capacity;
+
+            return old;
+        }
+
+        /**
+         * @brief Append ranges with at most one allocation (lock must be held)
+         * @note Ranges may point into this string: the old buffer outlives the copy
+         */
+        void append_views(const CStringView* parts, size_t count)
+        {
+            size_t total = 0;
+            for (size_t i = 0; i < count; ++i)
+                total += parts[i].length;
+
+            if (total == 0 && data_)
+            {
+                data_[length_] = '\0';
+                return;
+            }
+
+            size_t old_capacity = 0;
+            char* old = length_ + total + 1 > capacity_ ? grow(total, &old_capacity) : nullptr;
+
+            char* out = data_ + length_;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (parts[i].length)
+                    std::memcpy(out, parts[i].data, parts[i].length);
+                out += parts[i].length;
+            }
+
+            if (old)
+                traits::deallocate(alloc(), old, old_capacity);
+
+            length_ += total;
+            data_[length_] = '\0';
+        }
+
+        char* data_;             ///< Characters, or nullptr before the first allocation
+        size_t length_;          ///< Length without terminator
+        size_t capacity_;        ///< Allocated size including terminator
+    };
+
+    template <class LockPolicy, class Allocator>
+    struct starts_concat<basic_cstring<LockPolicy, Allocator>> : std::true_type {};
+
+    template <class LockPolicy, class Allocator>
+    struct is_string_type<basic_cstring<LockPolicy, Allocator>> : std::true_type {};
+
+    /**
+     * @brief Wrap a basic_cstring as a concatenation operand
+     */
+    template <class LockPolicy, class Allocator>
+    ConcatLeaf cat(const basic_cstring<LockPolicy, Allocator>& value) noexcept
+    {
+        return ConcatLeaf{ value.c_view() };
+    }
+
+    using local_string = basic_cstring<null_lock>;    ///< Single-thread string, no locking
+    using shared_string = basic_cstring<mutex_lock>;  ///< Exclusive-locked string
+    using rw_string = basic_cstring<rw_lock>;         ///< Reader/writer-locked string
+
+#ifdef CSTR_HAVE_PMR
+    /// Single-thread string allocated from a std::pmr::memory_resource
+    using pmr_string = basic_cstring<null_lock, std::pmr::polymorphic_allocator<char>>;
+#endif
+}
+
+namespace std
+{
+    /**
+     * @brief Hash support for basic_cstring keys (transparent, like std::hash<cstr::String>)
+     */
+    template <class LockPolicy, class Allocator>
+    struct hash<cstr::basic_cstring<LockPolicy, Allocator>> : cstr::string_hash {};
+
+    template <class LockPolicy, class Allocator>
+    struct equal_to<cstr::basic_cstring<LockPolicy, Allocator>> : cstr::string_equal {};
+}
+
+#endif // CSTR_BASIC_HPP
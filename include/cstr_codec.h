@@ -0,0 +1,624 @@
+#pragma once
+
+/**
+ * @file cstr_codec.h
+ * @brief Base64 (RFC 4648) and hex encoding straight into CString storage.
+ *
+ * Output sizes are computed exactly, reserved once, and written in place.
+ * Base64 uses pshufb lookup kernels (AVX2, SSSE3) and hex uses SSE2 when
+ * available; every kernel has a scalar fallback for the tail.
+ * Decoders are strict: no whitespace, padding required, unused bits zero.
+ */
+
+#ifndef CSTR_CODEC_H
+#define CSTR_CODEC_H
+
+#include "cstr.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief Base64 alphabet
+     */
+    static const char cstr_base64_chars[65] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    CSTR_API size_t cstr_base64_encoded_size(_In_ size_t size);
+    CSTR_API void cstr_base64_encode(_Out_ char* out, _In_reads_(size) const uint8_t* data, _In_ size_t size);
+    CSTR_API size_t cstr_base64_decode(_Out_ uint8_t* out, _In_reads_(length) const char* text, _In_ size_t length);
+    CSTR_API bool cstr_append_base64(_In_ CString* obj, _In_reads_(size) const void* data, _In_ size_t size);
+    CSTR_API bool cstr_decode_base64(_In_ CString* obj, _In_reads_(length) const char* text, _In_ size_t length);
+    CSTR_API void cstr_hex_encode(_Out_ char* out, _In_reads_(size) const uint8_t* data, _In_ size_t size, _In_ bool uppercase);
+    CSTR_API bool cstr_hex_decode(_Out_ uint8_t* out, _In_reads_(length) const char* text, _In_ size_t length);
+    CSTR_API bool cstr_append_hex(_In_ CString* obj, _In_reads_(size) const void* data, _In_ size_t size, _In_ bool uppercase);
+    CSTR_API bool cstr_decode_hex(_In_ CString* obj, _In_reads_(length) const char* text, _In_ size_t length);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_CODEC)
+
+    /**
+     * @brief Map byte to 6-bit base64 value (0xFF = invalid)
+     */
+    CSTR_INLINE uint8_t cstr_base64_value(_In_ uint8_t c)
+    {
+        if (c >= 'A' && c <= 'Z')
+            return (uint8_t)(c - 'A');
+        if (c >= 'a' && c <= 'z')
+            return (uint8_t)(c - 'a' + 26);
+        if (c >= '0' && c <= '9')
+            return (uint8_t)(c - '0' + 52);
+        if (c == '+')
+            return 62;
+        if (c == '/')
+            return 63;
+        return 0xFF;
+    }
+
+    /**
+     * @brief Number of characters base64 produces for size bytes
+     * @return Encoded length or CSTR_INVALID on overflow
+     */
+    size_t cstr_base64_encoded_size(_In_ size_t size)
+    {
+        if (size > (cstr_invalid - 1) / 4 * 3)
+            return cstr_invalid;
+
+        return (size + 2) / 3 * 4;
+    }
+
+#ifdef CSTR_HAVE_SSSE3
+    /**
+     * @brief Split 12 input bytes (in 3-byte groups) into 16 six-bit indices
+     */
+    CSTR_INLINE CSTR_TARGET("ssse3") __m128i cstr_base64_unpack_ssse3(_In_ __m128i in)
+    {
+        in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+        __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+        __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+        __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+        return _mm_or_si128(t1, t3);
+    }
+
+    /**
+     * @brief Translate 16 six-bit indices to base64 characters
+     */
+    CSTR_INLINE CSTR_TARGET("ssse3") __m128i cstr_base64_ascii_ssse3(_In_ __m128i indices)
+    {
+        __m128i reduced = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        reduced = _mm_or_si128(reduced, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+        const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+        return _mm_add_epi8(_mm_shuffle_epi8(offsets, reduced), indices);
+    }
+
+    /**
+     * @brief Translate and validate 16 base64 characters
+     * @param in    Characters
+     * @param valid Cleared when any character is outside the alphabet
+     * @return Six-bit values
+     */
+    CSTR_INLINE CSTR_TARGET("ssse3") __m128i cstr_base64_values_ssse3(_In_ __m128i in, _Inout_ bool* valid)
+    {
+        const __m128i nibble = _mm_set1_epi8(0x0f);
+        const __m128i shifts = _mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        // Per low nibble: bit set for every high nibble that forms a valid character
+        const __m128i masks = _mm_setr_epi8((char)0xa8, (char)0xf8, (char)0xf8, (char)0xf8, (char)0xf8, (char)0xf8, (char)0xf8, (char)0xf8,
+                                            (char)0xf8, (char)0xf8, (char)0xf0, 0x54, 0x50, 0x50, 0x50, 0x54);
+        const __m128i bits = _mm_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80, 0, 0, 0, 0, 0, 0, 0, 0);
+
+        __m128i high = _mm_and_si128(_mm_srli_epi32(in, 4), nibble);
+        __m128i low = _mm_and_si128(in, nibble);
+
+        // '/' shares its high nibble with '+' but needs +16 instead of +19
+        __m128i shift = _mm_add_epi8(_mm_shuffle_epi8(shifts, high), _mm_and_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('/')), _mm_set1_epi8(-3)));
+        __m128i allowed = _mm_and_si128(_mm_shuffle_epi8(masks, low), _mm_shuffle_epi8(bits, high));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(allowed, _mm_setzero_si128())))
+            *valid = false;
+
+        return _mm_add_epi8(in, shift);
+    }
+
+    /**
+     * @brief Pack 16 six-bit values into 12 bytes (low 12 bytes of result)
+     */
+    CSTR_INLINE CSTR_TARGET("ssse3") __m128i cstr_base64_pack_ssse3(_In_ __m128i values)
+    {
+        __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+        return _mm_shuffle_epi8(quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    }
+
+    /**
+     * @brief SSSE3 base64 encoding of whole 12-byte blocks
+     * @return Bytes consumed (a multiple of 12); out receives 4 characters per 3 bytes
+     */
+    CSTR_INLINE CSTR_TARGET("ssse3") size_t cstr_base64_encode_ssse3(_Out_ char* out, _In_reads_(size) const uint8_t* data, _In_ size_t size)
+    {
+        size_t i = 0;
+
+        // Each step reads 16 bytes and consumes 12
+        for (; i + 16 <= size; i += 12)
+        {
+            __m128i in = _mm_loadu_si128((const __m128i*)(data + i));
+            _mm_storeu_si128((__m128i*)out, cstr_base64_ascii_ssse3(cstr_base64_unpack_ssse3(in)));
+            out += 16;
+        }
+
+        return i;
+    }
+
+    /**
+     * @brief SSSE3 base64 decoding of whole 16-character blocks
+     * @param valid Cleared when a character is outside the alphabet
+     * @return Characters consumed (a multiple of 16); out receives 3 bytes per 4 characters
+     * @note Each step stores 16 bytes, 12 of them valid; the caller keeps the final quantum
+     *       out of length so the extra bytes are overwritten by the scalar path
+     */
+    CSTR_INLINE CSTR_TARGET("ssse3") size_t cstr_base64_decode_ssse3(_Out_ uint8_t* out, _In_reads_(length) const uint8_t* in, _In_ size_t length, _Inout_ bool* valid)
+    {
+        size_t i = 0;
+
+        for (; i + 16 <= length; i += 16)
+        {
+            __m128i values = cstr_base64_values_ssse3(_mm_loadu_si128((const __m128i*)(in + i)), valid);
+            if (!*valid)
+                break;
+            _mm_storeu_si128((__m128i*)out, cstr_base64_pack_ssse3(values));
+            out += 12;
+        }
+
+        return i;
+    }
+#endif
+
+#ifdef CSTR_HAVE_AVX2
+    /**
+     * @brief AVX2 counterpart of cstr_base64_unpack_ssse3 (24 bytes, 12 per lane)
+     */
+    CSTR_INLINE CSTR_TARGET("avx2") __m256i cstr_base64_unpack_avx2(_In_ __m256i in)
+    {
+        in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                                     10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+        __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+        __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+        __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+
+        return _mm256_or_si256(t1, t3);
+    }
+
+    /**
+     * @brief AVX2 counterpart of cstr_base64_ascii_ssse3
+     */
+    CSTR_INLINE CSTR_TARGET("avx2") __m256i cstr_base64_ascii_avx2(_In_ __m256i indices)
+    {
+        __m256i reduced = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        reduced = _mm256_or_si256(reduced, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+        const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                 '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                                 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                                 '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+        return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, reduced), indices);
+    }
+
+    /**
+     * @brief AVX2 counterpart of cstr_base64_encode_ssse3 (24-byte blocks)
+     */
+    CSTR_INLINE CSTR_TARGET("avx2") size_t cstr_base64_encode_avx2(_Out_ char* out, _In_reads_(size) const uint8_t* data, _In_ size_t size)
+    {
+        size_t i = 0;
+
+        // Each step reads 28 bytes (two overlapping 16-byte loads) and consumes 24
+        for (; i + 28 <= size; i += 24)
+        {
+            __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(data + i))),
+                                                 _mm_loadu_si128((const __m128i*)(data + i + 12)), 1);
+            _mm256_storeu_si256((__m256i*)out, cstr_base64_ascii_avx2(cstr_base64_unpack_avx2(in)));
+            out += 32;
+        }
+
+        return i;
+    }
+#endif
+
+    /**
+     * @brief Encode bytes as base64 into a caller-sized buffer
+     * @param out  Receives exactly cstr_base64_encoded_size(size) characters
+     * @param data Input bytes
+     * @param size Input length
+     */
+    void cstr_base64_encode(_Out_ char* out, _In_reads_(size) const uint8_t* data, _In_ size_t size)
+    {
+        size_t i = 0;
+
+#ifdef CSTR_HAVE_AVX2
+        if (cstr_cpu_level() >= CSTR_CPU_AVX2)
+            i = cstr_base64_encode_avx2(out, data, size);
+#endif
+
+#ifdef CSTR_HAVE_SSSE3
+        if (cstr_cpu_level() >= CSTR_CPU_SSSE3)
+            i += cstr_base64_encode_ssse3(out + i / 3 * 4, data + i, size - i);
+#endif
+
+        out += i / 3 * 4;
+
+        for (; i + 3 <= size; i += 3)
+        {
+            uint32_t v = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1] << 8) | data[i + 2];
+            out[0] = cstr_base64_chars[(v >> 18) & 63];
+            out[1] = cstr_base64_chars[(v >> 12) & 63];
+            out[2] = cstr_base64_chars[(v >> 6) & 63];
+            out[3] = cstr_base64_chars[v & 63];
+            out += 4;
+        }
+
+        if (i < size)
+        {
+            uint32_t v = (uint32_t)data[i] << 16;
+            if (i + 1 < size)
+                v |= (uint32_t)data[i + 1] << 8;
+
+            out[0] = cstr_base64_chars[(v >> 18) & 63];
+            out[1] = cstr_base64_chars[(v >> 12) & 63];
+            out[2] = i + 1 < size ? cstr_base64_chars[(v >> 6) & 63] : '=';
+            out[3] = '=';
+        }
+    }
+
+    /**
+     * @brief Decode base64 into a caller-sized buffer
+     * @param out    Receives the decoded bytes
+     * @param text   Base64 characters (length a multiple of 4)
+     * @param length Character count
+     * @return Decoded size, or CSTR_INVALID on malformed input
+     */
+    size_t cstr_base64_decode(_Out_ uint8_t* out, _In_reads_(length) const char* text, _In_ size_t length)
+    {
+        if (length % 4)
+            return cstr_invalid;
+
+        if (length == 0)
+            return 0;
+
+        const uint8_t* in = (const uint8_t*)text;
+        size_t padding = in[length - 1] != '=' ? 0 : in[length - 2] == '=' ? 2 : 1;
+        size_t body = length - 4;
+        size_t i = 0;
+        uint8_t* start = out;
+
+#ifdef CSTR_HAVE_SSSE3
+        // The final quantum is always left to the scalar path
+        if (cstr_cpu_level() >= CSTR_CPU_SSSE3)
+        {
+            bool valid = true;
+            i = cstr_base64_decode_ssse3(out, in, body, &valid);
+            if (!valid)
+                return cstr_invalid;
+            out += i / 4 * 3;
+        }
+#endif
+
+        for (; i < body; i += 4)
+        {
+            uint8_t a = cstr_base64_value(in[i]);
+            uint8_t b = cstr_base64_value(in[i + 1]);
+            uint8_t c = cstr_base64_value(in[i + 2]);
+            uint8_t d = cstr_base64_value(in[i + 3]);
+            if ((a | b | c | d) & 0x80)
+                return cstr_invalid;
+
+            uint32_t v = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | d;
+            out[0] = (uint8_t)(v >> 16);
+            out[1] = (uint8_t)(v >> 8);
+            out[2] = (uint8_t)v;
+            out += 3;
+        }
+
+        // Final quantum: '=' only at the end, unused bits must be zero
+        uint8_t a = cstr_base64_value(in[body]);
+        uint8_t b = cstr_base64_value(in[body + 1]);
+        uint8_t c = padding >= 2 ? 0 : cstr_base64_value(in[body + 2]);
+        uint8_t d = padding >= 1 ? 0 : cstr_base64_value(in[body + 3]);
+        if ((a | b | c | d) & 0x80)
+            return cstr_invalid;
+
+        uint32_t v = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | d;
+        if ((padding == 2 && (v & 0xFFFF)) || (padding == 1 && (v & 0xFF)))
+            return cstr_invalid;
+
+        out[0] = (uint8_t)(v >> 16);
+        if (padding < 2)
+            out[1] = (uint8_t)(v >> 8);
+        if (padding < 1)
+            out[2] = (uint8_t)v;
+        out += 3 - padding;
+
+        return (size_t)(out - start);
+    }
+
+    /**
+     * @brief Append base64 encoding of binary data
+     * @param obj  Destination CString
+     * @param data Input bytes
+     * @param size Input length
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_append_base64(_In_ CString* obj, _In_reads_(size) const void* data, _In_ size_t size)
+    {
+        if (!obj || (!data && size))
+            return false;
+
+        size_t encoded = cstr_base64_encoded_size(size);
+        if (encoded == cstr_invalid)
+            return false;
+
+        cstr_lock(obj);
+
+        if (encoded > cstr_invalid - 1 - obj->length || !cstr_reserve(obj, obj->length + encoded))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        cstr_base64_encode(obj->data + obj->length, (const uint8_t*)data, size);
+        obj->length += encoded;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Append bytes decoded from base64
+     * @param obj    Destination CString
+     * @param text   Base64 characters
+     * @param length Character count
+     * @return true on success, false on malformed input or allocation failure
+     * @note On failure the destination is left unchanged
+     */
+    bool cstr_decode_base64(_In_ CString* obj, _In_reads_(length) const char* text, _In_ size_t length)
+    {
+        if (!obj || (!text && length))
+            return false;
+
+        if (length % 4)
+            return false;
+
+        // Worst case before padding is known; the kernels may write 4 bytes past the last quantum
+        size_t room = length / 4 * 3 + 4;
+
+        cstr_lock(obj);
+
+        if (!cstr_reserve(obj, obj->length + room))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        size_t decoded = cstr_base64_decode((uint8_t*)obj->data + obj->length, text, length);
+        if (decoded == cstr_invalid)
+        {
+            obj->data[obj->length] = '\0';
+            cstr_unlock(obj);
+            return false;
+        }
+
+        obj->length += decoded;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Encode bytes as hex into a caller-sized buffer
+     * @param out       Receives exactly 2 * size characters
+     * @param data      Input bytes
+     * @param size      Input length
+     * @param uppercase Use 'A'-'F' instead of 'a'-'f'
+     */
+    void cstr_hex_encode(_Out_ char* out, _In_reads_(size) const uint8_t* data, _In_ size_t size, _In_ bool uppercase)
+    {
+        const char* digits = uppercase ? "0123456789ABCDEF" : "0123456789abcdef";
+        size_t i = 0;
+
+#ifdef CSTR_HAVE_SSE2
+        const __m128i nibble = _mm_set1_epi8(0x0f);
+        const __m128i nine = _mm_set1_epi8(9);
+        const __m128i zero = _mm_set1_epi8('0');
+        const __m128i letter = _mm_set1_epi8(uppercase ? 'A' - '0' - 10 : 'a' - '0' - 10);
+        size_t simd_limit = cstr_cpu_level() >= CSTR_CPU_SSE2 ? size : 0;
+
+        for (; i + 16 <= simd_limit; i += 16)
+        {
+            __m128i in = _mm_loadu_si128((const __m128i*)(data + i));
+            __m128i high = _mm_and_si128(_mm_srli_epi16(in, 4), nibble);
+            __m128i low = _mm_and_si128(in, nibble);
+
+            high = _mm_add_epi8(_mm_add_epi8(high, zero), _mm_and_si128(_mm_cmpgt_epi8(high, nine), letter));
+            low = _mm_add_epi8(_mm_add_epi8(low, zero), _mm_and_si128(_mm_cmpgt_epi8(low, nine), letter));
+
+            _mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(high, low));
+            _mm_storeu_si128((__m128i*)(out + 16), _mm_unpackhi_epi8(high, low));
+            out += 32;
+        }
+#endif
+
+        for (; i < size; ++i)
+        {
+            *out++ = digits[data[i] >> 4];
+            *out++ = digits[data[i] & 15];
+        }
+    }
+
+#ifdef CSTR_HAVE_SSE2
+    /**
+     * @brief Convert 16 hex characters to nibbles
+     * @param valid Cleared when any character is not a hex digit
+     */
+    CSTR_INLINE __m128i cstr_hex_nibbles_sse2(_In_ __m128i in, _Inout_ bool* valid)
+    {
+        __m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+        __m128i alpha = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+        // Unsigned range checks: x <= limit  <=>  min(x, limit) == x
+        __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+        __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+
+        if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xFFFF)
+            *valid = false;
+
+        return _mm_or_si128(_mm_and_si128(is_digit, digit), _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+    }
+#endif
+
+    /**
+     * @brief Decode hex characters into a caller-sized buffer
+     * @param out    Receives length / 2 bytes
+     * @param text   Hex characters (either case)
+     * @param length Character count (even)
+     * @return true on success, false on malformed input
+     */
+    bool cstr_hex_decode(_Out_ uint8_t* out, _In_reads_(length) const char* text, _In_ size_t length)
+    {
+        if (length % 2)
+            return false;
+
+        const uint8_t* in = (const uint8_t*)text;
+        size_t i = 0;
+
+#ifdef CSTR_HAVE_SSE2
+        bool valid = true;
+        size_t simd_limit = cstr_cpu_level() >= CSTR_CPU_SSE2 ? length : 0;
+
+        for (; i + 32 <= simd_limit; i += 32)
+        {
+            __m128i a = cstr_hex_nibbles_sse2(_mm_loadu_si128((const __m128i*)(in + i)), &valid);
+            __m128i b = cstr_hex_nibbles_sse2(_mm_loadu_si128((const __m128i*)(in + i + 16)), &valid);
+            if (!valid)
+                return false;
+
+            // Each 16-bit lane holds (high, low) nibbles; fold to high << 4 | low
+            __m128i mask = _mm_set1_epi16(0x00ff);
+            a = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(a, mask), 4), _mm_srli_epi16(a, 8));
+            b = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b, mask), 4), _mm_srli_epi16(b, 8));
+
+            _mm_storeu_si128((__m128i*)out, _mm_packus_epi16(a, b));
+            out += 16;
+        }
+#endif
+
+        for (; i < length; i += 2)
+        {
+            uint8_t v[2];
+            for (int k = 0; k < 2; ++k)
+            {
+                uint8_t c = in[i + k];
+                if (c >= '0' && c <= '9')
+                    v[k] = (uint8_t)(c - '0');
+                else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+                    v[k] = (uint8_t)((c | 0x20) - 'a' + 10);
+                else
+                    return false;
+            }
+            *out++ = (uint8_t)((v[0] << 4) | v[1]);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Append hex encoding of binary data
+     * @param obj       Destination CString
+     * @param data      Input bytes
+     * @param size      Input length
+     * @param uppercase Use 'A'-'F' instead of 'a'-'f'
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_append_hex(_In_ CString* obj, _In_reads_(size) const void* data, _In_ size_t size, _In_ bool uppercase)
+    {
+        if (!obj || (!data && size))
+            return false;
+
+        if (size > (cstr_invalid - 1) / 2)
+            return false;
+
+        cstr_lock(obj);
+
+        if (size * 2 > cstr_invalid - 1 - obj->length || !cstr_reserve(obj, obj->length + size * 2))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        cstr_hex_encode(obj->data + obj->length, (const uint8_t*)data, size, uppercase);
+        obj->length += size * 2;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Append bytes decoded from hex
+     * @param obj    Destination CString
+     * @param text   Hex characters (either case)
+     * @param length Character count
+     * @return true on success, false on malformed input or allocation failure
+     * @note On failure the destination is left unchanged
+     */
+    bool cstr_decode_hex(_In_ CString* obj, _In_reads_(length) const char* text, _In_ size_t length)
+    {
+        if (!obj || (!text && length))
+            return false;
+
+        if (length % 2)
+            return false;
+
+        cstr_lock(obj);
+
+        if (!cstr_reserve(obj, obj->length + length / 2))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        if (!cstr_hex_decode((uint8_t*)obj->data + obj->length, text, length))
+        {
+            obj->data[obj->length] = '\0';
+            cstr_unlock(obj);
+            return false;
+        }
+
+        obj->length += length / 2;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+#endif // CSTR_IMPLEMENT_CODEC
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_CODEC_H
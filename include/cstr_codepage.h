@@ -0,0 +1,345 @@
+#pragma once
+
+/**
+ * @file cstr_codepage.h
+ * @brief Built-in single-byte code pages (windows-1251/1252, KOI8-R, ISO-8859-x).
+ *
+ * The tables are compiled in, so conversions do not depend on the OS and
+ * give the same result on every platform. Code pages are selected per call
+ * by their Windows identifier (1251, 1252, 20866, 28591-28606).
+ * Bytes below 0x80 are ASCII in every page and are copied 16 at a time.
+ * Undefined bytes decode to U+FFFD. Characters a page cannot represent
+ * encode to CSTR_CODEPAGE_DEFAULT_CHAR.
+ */
+
+#ifndef CSTR_CODEPAGE_H
+#define CSTR_CODEPAGE_H
+
+#include "cstr.h"
+
+/**
+ * @def CSTR_CODEPAGE_DEFAULT_CHAR
+ * @brief Substitute byte for characters missing from the target code page
+ */
+#ifndef CSTR_CODEPAGE_DEFAULT_CHAR
+#define CSTR_CODEPAGE_DEFAULT_CHAR '?'
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @struct CStringCodePage
+     * @brief Conversion tables of one single-byte code page
+     *
+     * @var cp            - Windows code page identifier
+     * @var name          - Display name
+     * @var reverse_count - Number of used entries in reverse_code/reverse_byte
+     * @var high          - Code point of bytes 0x80-0xFF (0 = undefined)
+     * @var reverse_code  - Defined code points in ascending order
+     * @var reverse_byte  - Byte for each entry of reverse_code
+     */
+    typedef struct
+    {
+        size_t cp;                  ///< Code page identifier
+        const char* name;           ///< Display name
+        size_t reverse_count;       ///< Defined high bytes
+        uint16_t high[128];         ///< Byte -> code point
+        uint16_t reverse_code[128]; ///< Sorted code points
+        uint8_t reverse_byte[128];  ///< Code point -> byte
+    }CStringCodePage;
+
+#ifdef __cplusplus
+}
+#endif
+
+#include "cstr_codepage_tables.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    CSTR_API bool cstr_append_from_codepage(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ size_t cp);
+    CSTR_API bool cstr_append_to_codepage(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ size_t cp);
+    CSTR_API wchar_t* cstr_codepage_to_wchars(_In_ const char* str, _In_ size_t cp);
+    CSTR_API bool cstr_append_wchars_codepage(_In_ CString* obj, _In_ const wchar_t* data, _In_ size_t cp);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_CODEPAGE)
+
+    /**
+     * @brief Look up built-in tables for a code page
+     * @param cp Windows code page identifier
+     * @return Tables, or NULL if the code page is not built in
+     */
+    CSTR_INLINE const CStringCodePage* cstr_codepage_find(_In_ size_t cp)
+    {
+        for (size_t i = 0; i < sizeof(cstr_codepages) / sizeof(cstr_codepages[0]); ++i)
+        {
+            if (cstr_codepages[i].cp == cp)
+                return &cstr_codepages[i];
+        }
+
+        return NULL;
+    }
+
+    /**
+     * @brief Decode one code page byte
+     * @return Code point (U+FFFD for undefined bytes)
+     */
+    CSTR_INLINE uint32_t cstr_codepage_decode_char(_In_ const CStringCodePage* page, _In_ uint8_t c)
+    {
+        if (c < 0x80)
+            return c;
+
+        return page->high[c - 0x80] ? page->high[c - 0x80] : 0xFFFD;
+    }
+
+    /**
+     * @brief Encode one code point to a code page byte
+     * @return Byte, or CSTR_CODEPAGE_DEFAULT_CHAR if the page lacks the character
+     */
+    CSTR_INLINE uint8_t cstr_codepage_encode_char(_In_ const CStringCodePage* page, _In_ uint32_t code)
+    {
+        if (code < 0x80)
+            return (uint8_t)code;
+
+        size_t lo = 0;
+        size_t hi = page->reverse_count;
+
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (page->reverse_code[mid] < code)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        if (lo < page->reverse_count && page->reverse_code[lo] == code)
+            return page->reverse_byte[lo];
+
+        return CSTR_CODEPAGE_DEFAULT_CHAR;
+    }
+
+    /**
+     * @brief Number of UTF-8 bytes for a BMP code point
+     */
+    CSTR_INLINE size_t cstr_codepage_utf8_length(_In_ uint32_t code)
+    {
+        return code < 0x80 ? 1 : code < 0x800 ? 2 : 3;
+    }
+
+    /**
+     * @brief Append code page text converted to UTF-8
+     * @param obj  Destination CString
+     * @param data Text in the given code page
+     * @param size Input length
+     * @param cp   Source code page identifier
+     * @return true on success, false on unknown code page or allocation failure
+     */
+    bool cstr_append_from_codepage(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ size_t cp)
+    {
+        if (!obj || (!data && size))
+            return false;
+
+        const CStringCodePage* page = cstr_codepage_find(cp);
+        if (!page || size > cstr_invalid / 3)
+            return false;
+
+        const uint8_t* in = (const uint8_t*)data;
+
+        // Sizing pass: only high bytes can grow
+        size_t converted = size;
+        for (size_t i = 0; (i += cstr_ascii_run(in + i, size - i)) < size; ++i)
+            converted += cstr_codepage_utf8_length(cstr_codepage_decode_char(page, in[i])) - 1;
+
+        cstr_lock(obj);
+
+        if (converted > cstr_invalid - 1 - obj->length || !cstr_reserve(obj, obj->length + converted))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        char* out = obj->data + obj->length;
+        size_t i = 0;
+
+        while (i < size)
+        {
+            size_t run = cstr_ascii_run(in + i, size - i);
+            memcpy(out, in + i, run);
+            out += run;
+            i += run;
+
+            for (; i < size && in[i] >= 0x80; ++i)
+                out += cstr_utf8_encode(out, cstr_codepage_decode_char(page, in[i]));
+        }
+
+        obj->length += converted;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Append UTF-8 text converted to a code page
+     * @param obj  Destination CString
+     * @param data UTF-8 text
+     * @param size Input length
+     * @param cp   Target code page identifier
+     * @return true on success, false on unknown code page or allocation failure
+     * @note Malformed UTF-8 and unmappable characters become CSTR_CODEPAGE_DEFAULT_CHAR
+     */
+    bool cstr_append_to_codepage(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ size_t cp)
+    {
+        if (!obj || (!data && size))
+            return false;
+
+        const CStringCodePage* page = cstr_codepage_find(cp);
+        if (!page)
+            return false;
+
+        cstr_lock(obj);
+
+        // Output never exceeds input: one byte per UTF-8 sequence
+        if (!cstr_reserve(obj, obj->length + size))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        const uint8_t* in = (const uint8_t*)data;
+        char* start = obj->data + obj->length;
+        char* out = start;
+        size_t i = 0;
+
+        while (i < size)
+        {
+            size_t run = cstr_ascii_run(in + i, size - i);
+            memcpy(out, in + i, run);
+            out += run;
+            i += run;
+
+            while (i < size && in[i] >= 0x80)
+            {
+                uint32_t code;
+                i += cstr_utf8_next(in + i, size - i, &code);
+                *out++ = (char)cstr_codepage_encode_char(page, code);
+            }
+        }
+
+        obj->length += (size_t)(out - start);
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Convert code page text to a wide string
+     * @param str Null-terminated text in the given code page
+     * @param cp  Source code page identifier
+     * @return New allocated wide string or NULL on failure
+     * @note Deterministic counterpart of cstr_chars2wchars() for built-in pages
+     * @warning Caller must free result with free()
+     */
+    wchar_t* cstr_codepage_to_wchars(_In_ const char* str, _In_ size_t cp)
+    {
+        const CStringCodePage* page = cstr_codepage_find(cp);
+        if (!str || !page)
+            return NULL;
+
+        size_t size = strlen(str);
+        wchar_t* buf = (wchar_t*)malloc((size + 1) * sizeof(wchar_t));
+        if (!buf)
+            return NULL;
+
+        const uint8_t* in = (const uint8_t*)str;
+        size_t i = 0;
+
+#ifdef CSTR_HAVE_SSE2
+        if (sizeof(wchar_t) == 2)
+        {
+            // Widen ASCII blocks by interleaving with zero bytes
+            for (; i + 16 <= size; i += 16)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+                if (_mm_movemask_epi8(v))
+                    break;
+
+                _mm_storeu_si128((__m128i*)(buf + i), _mm_unpacklo_epi8(v, _mm_setzero_si128()));
+                _mm_storeu_si128((__m128i*)(buf + i + 8), _mm_unpackhi_epi8(v, _mm_setzero_si128()));
+            }
+        }
+#endif
+
+        for (; i < size; ++i)
+            buf[i] = (wchar_t)cstr_codepage_decode_char(page, in[i]);
+
+        buf[size] = L'\0';
+
+        return buf;
+    }
+
+    /**
+     * @brief Append wide string converted to a code page
+     * @param obj  Destination CString
+     * @param data Null-terminated wide string (UTF-16 or UTF-32)
+     * @param cp   Target code page identifier
+     * @return true on success, false on unknown code page or allocation failure
+     * @note Deterministic counterpart of cstr_append_wchars() for built-in pages.
+     *       Unmappable characters (and each surrogate pair) become CSTR_CODEPAGE_DEFAULT_CHAR.
+     */
+    bool cstr_append_wchars_codepage(_In_ CString* obj, _In_ const wchar_t* data, _In_ size_t cp)
+    {
+        if (!obj || !data)
+            return false;
+
+        const CStringCodePage* page = cstr_codepage_find(cp);
+        if (!page)
+            return false;
+
+        size_t size = wcslen(data);
+
+        cstr_lock(obj);
+
+        if (size > cstr_invalid - 1 - obj->length || !cstr_reserve(obj, obj->length + size))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        char* start = obj->data + obj->length;
+        char* out = start;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+            uint32_t code = (uint32_t)data[i];
+
+            if (code >= 0xD800 && code <= 0xDBFF && i + 1 < size && (uint32_t)data[i + 1] >= 0xDC00 && (uint32_t)data[i + 1] <= 0xDFFF)
+                ++i;
+
+            *out++ = (char)cstr_codepage_encode_char(page, code);
+        }
+
+        obj->length += (size_t)(out - start);
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+#endif // CSTR_IMPLEMENT_CODEPAGE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_CODEPAGE_H
@@ -0,0 +1,444 @@
+#pragma once
+
+/**
+ * @file cstr_distance.h
+ * @brief Bit-parallel Levenshtein distance (Myers / Hyyrö).
+ *
+ * The shorter string becomes a set of bit masks, one bit per position, and
+ * each byte of the other string advances a whole DP column with a handful of
+ * word operations. Strings longer than 64 bytes use 64-bit blocks with carries
+ * between them. Bounded queries stop as soon as the bound can no longer be met.
+ */
+
+#ifndef CSTR_DISTANCE_H
+#define CSTR_DISTANCE_H
+
+#include "cstr.h"
+#include "cstr_array.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    CSTR_API size_t cstr_edit_distance_bounded(_In_reads_(a_size) const char* a, _In_ size_t a_size, _In_reads_(b_size) const char* b, _In_ size_t b_size, _In_ size_t bound);
+    CSTR_API size_t cstr_edit_distance(_In_ CString* obj, _In_ CString* obj2);
+    CSTR_API bool cstr_within_distance(_In_ CString* obj, _In_ CString* obj2, _In_ size_t max_distance);
+    CSTR_API size_t cstr_array_edit_distance(_In_ CStringArray* arr, _In_reads_(length) const char* query, _In_ size_t length, _In_ size_t max_distance, _Out_ size_t* distances);
+    CSTR_API size_t cstr_array_edit_distance_cstr(_In_ CStringArray* arr, _In_ CString* query, _In_ size_t max_distance, _Out_ size_t* distances);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_DISTANCE)
+
+    /**
+     * @brief Single-word Myers kernel (pattern length 1..64)
+     * @param peq      Match mask per byte
+     * @param m        Pattern length
+     * @param text     Text bytes
+     * @param n        Text length
+     * @param bound    Maximum distance of interest
+     * @return Distance, or CSTR_INVALID once it must exceed bound
+     */
+    CSTR_INLINE size_t cstr_distance_word(_In_reads_(256) const uint64_t* peq, _In_ size_t m, _In_reads_(n) const uint8_t* text, _In_ size_t n, _In_ size_t bound)
+    {
+        uint64_t pv = ~(uint64_t)0;
+        uint64_t mv = 0;
+        uint64_t high = (uint64_t)1 << (m - 1);
+        size_t score = m;
+
+        for (size_t j = 0; j < n; ++j)
+        {
+            uint64_t eq = peq[text[j]];
+            uint64_t xv = eq | mv;
+            uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+            uint64_t ph = mv | ~(xh | pv);
+            uint64_t mh = pv & xh;
+
+            if (ph & high)
+                score++;
+            else if (mh & high)
+                score--;
+
+            // The remaining n - j - 1 columns can lower the score by one each at most
+            if (bound != cstr_invalid && score > bound + (n - j - 1))
+                return cstr_invalid;
+
+            ph = (ph << 1) | 1;
+            mh <<= 1;
+            pv = mh | ~(xv | ph);
+            mv = ph & xv;
+        }
+
+        return score;
+    }
+
+    /**
+     * @brief Multi-word Myers kernel (pattern longer than 64)
+     * @param peq   words * 256 match masks, word-major
+     * @param words Number of 64-bit blocks
+     * @param m     Pattern length
+     * @param text  Text bytes
+     * @param n     Text length
+     * @param bound Maximum distance of interest
+     * @param pv    Scratch of words entries
+     * @param mv    Scratch of words entries
+     * @return Distance, or CSTR_INVALID once it must exceed bound
+     */
+    CSTR_INLINE size_t cstr_distance_blocks(_In_ const uint64_t* peq, _In_ size_t words, _In_ size_t m, _In_reads_(n) const uint8_t* text, _In_ size_t n, _In_ size_t bound, _Out_writes_(words) uint64_t* pv, _Out_writes_(words) uint64_t* mv)
+    {
+        const uint64_t top = (uint64_t)1 << 63;
+        const uint64_t high = (uint64_t)1 << ((m - 1) & 63);
+        size_t score = m;
+
+        for (size_t w = 0; w < words; ++w)
+        {
+            pv[w] = ~(uint64_t)0;
+            mv[w] = 0;
+        }
+
+        for (size_t j = 0; j < n; ++j)
+        {
+            const uint64_t* column = peq + (size_t)text[j];
+            int carry = 1;
+
+            for (size_t w = 0; w < words; ++w)
+            {
+                uint64_t eq = column[w * 256];
+                uint64_t p = pv[w];
+                uint64_t q = mv[w];
+
+                uint64_t xv = eq | q;
+                if (carry < 0)
+                    eq |= 1;
+                uint64_t xh = (((eq & p) + p) ^ p) | eq;
+                uint64_t ph = q | ~(xh | p);
+                uint64_t mh = p & xh;
+
+                if (w + 1 == words)
+                {
+                    if (ph & high)
+                        score++;
+                    else if (mh & high)
+                        score--;
+                }
+
+                int out = (ph & top) ? 1 : ((mh & top) ? -1 : 0);
+
+                ph <<= 1;
+                mh <<= 1;
+                if (carry < 0)
+                    mh |= 1;
+                else if (carry > 0)
+                    ph |= 1;
+
+                pv[w] = mh | ~(xv | ph);
+                mv[w] = ph & xv;
+                carry = out;
+            }
+
+            if (bound != cstr_invalid && score > bound + (n - j - 1))
+                return cstr_invalid;
+        }
+
+        return score;
+    }
+
+    /**
+     * @brief Fill match masks for pattern
+     * @param peq     words * 256 masks, word-major
+     * @param pattern Pattern bytes
+     * @param m       Pattern length
+     */
+    CSTR_INLINE void cstr_distance_masks(_Out_ uint64_t* peq, _In_reads_(m) const uint8_t* pattern, _In_ size_t m)
+    {
+        size_t words = (m + 63) / 64;
+        memset(peq, 0, words * 256 * sizeof(uint64_t));
+
+        for (size_t i = 0; i < m; ++i)
+            peq[(i / 64) * 256 + pattern[i]] |= (uint64_t)1 << (i & 63);
+    }
+
+    /**
+     * @brief Bounded Levenshtein distance between two buffers
+     * @param a      First buffer
+     * @param a_size First length
+     * @param b      Second buffer
+     * @param b_size Second length
+     * @param bound  Maximum distance of interest (CSTR_INVALID for none)
+     * @return Distance, or CSTR_INVALID if it exceeds bound or on allocation failure
+     */
+    size_t cstr_edit_distance_bounded(_In_reads_(a_size) const char* a, _In_ size_t a_size, _In_reads_(b_size) const char* b, _In_ size_t b_size, _In_ size_t bound)
+    {
+        const uint8_t* x = (const uint8_t*)a;
+        const uint8_t* y = (const uint8_t*)b;
+
+        // Common prefix and suffix never change the distance
+        while (a_size && b_size && *x == *y)
+        {
+            x++;
+            y++;
+            a_size--;
+            b_size--;
+        }
+        while (a_size && b_size && x[a_size - 1] == y[b_size - 1])
+        {
+            a_size--;
+            b_size--;
+        }
+
+        // The shorter string becomes the bit-vector pattern
+        if (a_size > b_size)
+        {
+            const uint8_t* t = x;
+            x = y;
+            y = t;
+            size_t s = a_size;
+            a_size = b_size;
+            b_size = s;
+        }
+
+        if (b_size - a_size > bound)
+            return cstr_invalid;
+
+        if (a_size == 0)
+            return b_size;
+
+        if (a_size <= 64)
+        {
+            uint64_t peq[256];
+            cstr_distance_masks(peq, x, a_size);
+            return cstr_distance_word(peq, a_size, y, b_size, bound);
+        }
+
+        size_t words = (a_size + 63) / 64;
+        uint64_t* peq = (uint64_t*)malloc((words * 256 + words * 2) * sizeof(uint64_t));
+        if (!peq)
+            return cstr_invalid;
+
+        cstr_distance_masks(peq, x, a_size);
+        size_t out = cstr_distance_blocks(peq, words, a_size, y, b_size, bound, peq + words * 256, peq + words * 257);
+
+        free(peq);
+
+        return out;
+    }
+
+    /**
+     * @brief Levenshtein distance between two CStrings
+     * @param obj  First CString
+     * @param obj2 Second CString
+     * @return Number of single-byte insertions, deletions and substitutions,
+     *         or CSTR_INVALID on failure
+     */
+    size_t cstr_edit_distance(_In_ CString* obj, _In_ CString* obj2)
+    {
+        if (!obj || !obj2)
+            return cstr_invalid;
+
+        cstr_lock(obj);
+        cstr_lock(obj2);
+
+        size_t out = cstr_edit_distance_bounded(obj->data, obj->length, obj2->data, obj2->length, cstr_invalid);
+
+        cstr_unlock(obj2);
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Check whether two CStrings are within an edit distance
+     * @param obj          First CString
+     * @param obj2         Second CString
+     * @param max_distance Largest accepted distance
+     * @return true if the distance is at most max_distance
+     * @note Stops as soon as the bound cannot be met
+     */
+    bool cstr_within_distance(_In_ CString* obj, _In_ CString* obj2, _In_ size_t max_distance)
+    {
+        if (!obj || !obj2)
+            return false;
+
+        cstr_lock(obj);
+        cstr_lock(obj2);
+
+        size_t out = cstr_edit_distance_bounded(obj->data, obj->length, obj2->data, obj2->length, max_distance);
+
+        cstr_unlock(obj2);
+        cstr_unlock(obj);
+
+        return out != cstr_invalid;
+    }
+
+#ifdef CSTR_HAVE_SSE2
+    /**
+     * @brief Single-word Myers kernel over two texts at once (one per SSE2 lane)
+     * @param peq   Match mask per byte
+     * @param m     Pattern length (1..64)
+     * @param t0    First text
+     * @param n0    First text length
+     * @param t1    Second text
+     * @param n1    Second text length
+     * @param bound Maximum distance of interest
+     * @param out   Receives both distances (CSTR_INVALID beyond bound)
+     */
+    CSTR_INLINE void cstr_distance_word_x2(_In_reads_(256) const uint64_t* peq, _In_ size_t m, _In_reads_(n0) const uint8_t* t0, _In_ size_t n0, _In_reads_(n1) const uint8_t* t1, _In_ size_t n1, _In_ size_t bound, _Out_writes_(2) size_t* out)
+    {
+        const __m128i ones = _mm_set1_epi32(-1);
+        const __m128i low = _mm_set_epi64x(1, 1);
+        const __m128i shift = _mm_cvtsi32_si128((int)(m - 1));
+
+        __m128i pv = ones;
+        __m128i mv = _mm_setzero_si128();
+        __m128i score = _mm_set_epi64x((long long)m, (long long)m);
+
+        size_t n = n0 > n1 ? n0 : n1;
+        size_t j = 0;
+
+        for (; j < n; ++j)
+        {
+            __m128i eq = _mm_set_epi64x((long long)(j < n1 ? peq[t1[j]] : 0), (long long)(j < n0 ? peq[t0[j]] : 0));
+            __m128i active = _mm_set_epi64x(j < n1 ? -1 : 0, j < n0 ? -1 : 0);
+
+            __m128i xv = _mm_or_si128(eq, mv);
+            __m128i sum = _mm_add_epi64(_mm_and_si128(eq, pv), pv);
+            __m128i xh = _mm_or_si128(_mm_xor_si128(sum, pv), eq);
+            __m128i ph = _mm_or_si128(mv, _mm_xor_si128(_mm_or_si128(xh, pv), ones));
+            __m128i mh = _mm_and_si128(pv, xh);
+
+            __m128i delta = _mm_sub_epi64(_mm_and_si128(_mm_srl_epi64(ph, shift), low), _mm_and_si128(_mm_srl_epi64(mh, shift), low));
+            score = _mm_add_epi64(score, _mm_and_si128(delta, active));
+
+            ph = _mm_or_si128(_mm_slli_epi64(ph, 1), low);
+            mh = _mm_slli_epi64(mh, 1);
+            __m128i next_pv = _mm_or_si128(mh, _mm_xor_si128(_mm_or_si128(xv, ph), ones));
+            __m128i next_mv = _mm_and_si128(ph, xv);
+
+            // Finished lanes keep their state
+            pv = _mm_or_si128(_mm_and_si128(active, next_pv), _mm_andnot_si128(active, pv));
+            mv = _mm_or_si128(_mm_and_si128(active, next_mv), _mm_andnot_si128(active, mv));
+
+            if ((j & 7) == 7 && bound != cstr_invalid)
+            {
+                uint64_t s[2];
+                _mm_storeu_si128((__m128i*)s, score);
+                bool dead0 = s[0] > bound + (j + 1 < n0 ? n0 - j - 1 : 0);
+                bool dead1 = s[1] > bound + (j + 1 < n1 ? n1 - j - 1 : 0);
+                if (dead0 && dead1)
+                    break;
+            }
+        }
+
+        uint64_t s[2];
+        _mm_storeu_si128((__m128i*)s, score);
+
+        size_t done0 = j < n0 ? n0 - j : 0;
+        size_t done1 = j < n1 ? n1 - j : 0;
+        out[0] = (done0 || s[0] > bound) ? cstr_invalid : (size_t)s[0];
+        out[1] = (done1 || s[1] > bound) ? cstr_invalid : (size_t)s[1];
+    }
+#endif
+
+    /**
+     * @brief Edit distance from a query to every element of a CStringArray
+     * @param arr          CStringArray of candidates
+     * @param query        Query bytes
+     * @param length       Query length
+     * @param max_distance Largest distance of interest (CSTR_INVALID for none)
+     * @param distances    Receives one distance per element (CSTR_INVALID beyond max_distance)
+     * @return Number of elements within max_distance, or CSTR_INVALID on failure
+     * @note Match masks of the query are built once. Queries up to 64 bytes are
+     *       run against two candidates at a time in SSE2 lanes
+     */
+    size_t cstr_array_edit_distance(_In_ CStringArray* arr, _In_reads_(length) const char* query, _In_ size_t length, _In_ size_t max_distance, _Out_ size_t* distances)
+    {
+        if (!arr || !distances || (!query && length))
+            return cstr_invalid;
+
+        const uint8_t* q = (const uint8_t*)query;
+        size_t words = (length + 63) / 64;
+        uint64_t* peq = NULL;
+
+        if (length)
+        {
+            peq = (uint64_t*)malloc((words * 256 + words * 2) * sizeof(uint64_t));
+            if (!peq)
+                return cstr_invalid;
+            cstr_distance_masks(peq, q, length);
+        }
+
+        cstr_array_lock(arr);
+
+        size_t found = 0;
+        size_t i = 0;
+
+#ifdef CSTR_HAVE_SSE2
+        if (length && length <= 64)
+        {
+            for (; i + 2 <= arr->count; i += 2)
+            {
+                const uint8_t* t0 = (const uint8_t*)arr->blob + arr->offsets[i];
+                const uint8_t* t1 = (const uint8_t*)arr->blob + arr->offsets[i + 1];
+                size_t n0 = arr->offsets[i + 1] - arr->offsets[i] - 1;
+                size_t n1 = arr->offsets[i + 2] - arr->offsets[i + 1] - 1;
+
+                cstr_distance_word_x2(peq, length, t0, n0, t1, n1, max_distance, distances + i);
+                found += (distances[i] != cstr_invalid) + (distances[i + 1] != cstr_invalid);
+            }
+        }
+#endif
+
+        for (; i < arr->count; ++i)
+        {
+            const uint8_t* text = (const uint8_t*)arr->blob + arr->offsets[i];
+            size_t n = arr->offsets[i + 1] - arr->offsets[i] - 1;
+            size_t d;
+
+            if (!length)
+                d = n <= max_distance ? n : cstr_invalid;
+            else if ((n > length ? n - length : length - n) > max_distance)
+                d = cstr_invalid;
+            else if (length <= 64)
+                d = cstr_distance_word(peq, length, text, n, max_distance);
+            else
+                d = cstr_distance_blocks(peq, words, length, text, n, max_distance, peq + words * 256, peq + words * 257);
+
+            distances[i] = d;
+            found += d != cstr_invalid;
+        }
+
+        cstr_array_unlock(arr);
+
+        free(peq);
+
+        return found;
+    }
+
+    /**
+     * @brief Edit distance from a CString query to every element of a CStringArray
+     * @param arr          CStringArray of candidates
+     * @param query        Query
+     * @param max_distance Largest distance of interest (CSTR_INVALID for none)
+     * @param distances    Receives one distance per element (CSTR_INVALID beyond max_distance)
+     * @return Number of elements within max_distance, or CSTR_INVALID on failure
+     */
+    size_t cstr_array_edit_distance_cstr(_In_ CStringArray* arr, _In_ CString* query, _In_ size_t max_distance, _Out_ size_t* distances)
+    {
+        if (!query)
+            return cstr_invalid;
+
+        cstr_lock(query);
+
+        size_t out = cstr_array_edit_distance(arr, query->data, query->length, max_distance, distances);
+
+        cstr_unlock(query);
+
+        return out;
+    }
+
+#endif // CSTR_IMPLEMENT_DISTANCE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_DISTANCE_H
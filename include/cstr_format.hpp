@@ -0,0 +1,195 @@
+#pragma once
+
+/**
+ * @file cstr_format.hpp
+ * @brief std::format support for CString storage (C++20, or C++17 with {fmt}).
+ *
+ * cstr::format_to() formats straight into the spare capacity of a CString
+ * or cstr::String. It makes one pass with no intermediate std::string, and
+ * growth follows cstr_reserve(), so n characters cost O(log n)
+ * reallocations. Formatter specializations let the string types appear as
+ * format arguments.
+ *
+ * Uses <format> when the standard library provides it, otherwise {fmt}
+ * (define CSTR_USE_FMT to force {fmt}).
+ */
+
+#ifndef CSTR_FORMAT_HPP
+#define CSTR_FORMAT_HPP
+
+#include "cstr.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <version>
+
+#if !defined(CSTR_USE_FMT) && defined(__cpp_lib_format)
+#include <format>
+#define CSTR_FMT_NAMESPACE std  ///< Namespace of the formatting library
+#elif __has_include(<fmt/format.h>)
+#include <fmt/format.h>
+#ifndef CSTR_USE_FMT
+#define CSTR_USE_FMT 1
+#endif
+#define CSTR_FMT_NAMESPACE fmt  ///< Namespace of the formatting library
+#else
+#error "cstr_format.hpp requires std::format or {fmt}"
+#endif
+
+namespace cstr
+{
+    /**
+     * @class append_iterator
+     * @brief Output iterator that appends characters to a CString
+     *
+     * Characters go straight into spare capacity. The buffer grows through
+     * cstr_reserve() when full. The terminator is not maintained per
+     * character: call finish() (format_to() does) once writing is done.
+     * Throws std::bad_alloc when growth fails.
+     */
+    class append_iterator
+    {
+    public:
+        using iterator_category = std::output_iterator_tag;
+        using value_type = void;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = void;
+
+        append_iterator() noexcept = default;
+
+        explicit append_iterator(CString* dest) noexcept
+            : dest_(dest)
+        {
+        }
+
+        append_iterator& operator=(char value)
+        {
+            // Keep one byte free for the terminator
+            if (dest_->length + 1 >= dest_->capacity && !cstr_reserve(dest_, dest_->length + 1))
+                throw std::bad_alloc();
+
+            dest_->data[dest_->length++] = value;
+            return *this;
+        }
+
+        append_iterator& operator*() noexcept
+        {
+            return *this;
+        }
+
+        append_iterator& operator++() noexcept
+        {
+            return *this;
+        }
+
+        append_iterator& operator++(int) noexcept
+        {
+            return *this;
+        }
+
+        /**
+         * @brief Terminate the string after the last written character
+         */
+        void finish() noexcept
+        {
+            if (dest_->data)
+                dest_->data[dest_->length] = '\0';
+        }
+
+    private:
+        CString* dest_ = nullptr;  ///< Destination (locked by the caller)
+    };
+
+    /**
+     * @brief Append formatted text to a CString
+     * @param dest   Destination CString
+     * @param format Format string checked at compile time
+     * @param args   Arguments
+     * @return Number of characters appended
+     * @note On exception (std::bad_alloc, format errors) dest keeps its previous contents
+     * @code
+     * cstr::format_to(str, "{}:{:04x}", name, id);
+     * @endcode
+     */
+    template <class... Args>
+    size_t format_to(CString& dest, CSTR_FMT_NAMESPACE::format_string<Args...> format, Args&&... args)
+    {
+        cstr_lock(&dest);
+
+        size_t start = dest.length;
+        append_iterator out(&dest);
+
+        try
+        {
+            CSTR_FMT_NAMESPACE::format_to(out, format, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            dest.length = start;
+            out.finish();
+            cstr_unlock(&dest);
+            throw;
+        }
+
+        out.finish();
+        size_t added = dest.length - start;
+
+        cstr_unlock(&dest);
+
+        return added;
+    }
+
+    template <class... Args>
+    size_t format_to(String& dest, CSTR_FMT_NAMESPACE::format_string<Args...> format, Args&&... args)
+    {
+        return cstr::format_to(*dest.native(), format, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Format into a new cstr::String
+     */
+    template <class... Args>
+    String format(CSTR_FMT_NAMESPACE::format_string<Args...> format, Args&&... args)
+    {
+        String out;
+        cstr::format_to(out, format, std::forward<Args>(args)...);
+        return out;
+    }
+}
+
+namespace CSTR_FMT_NAMESPACE
+{
+    /**
+     * @brief Format owning string types (cstr::String, cstr::basic_cstring) like std::string_view
+     */
+    template <class T>
+#ifdef CSTR_USE_FMT
+    struct formatter<T, char, std::enable_if_t<cstr::is_string_type<T>::value>> : formatter<std::string_view, char>
+#else
+        requires cstr::is_string_type<T>::value
+    struct formatter<T, char> : formatter<std::string_view, char>
+#endif
+    {
+        template <class FormatContext>
+        auto format(const T& value, FormatContext& ctx) const
+        {
+            return formatter<std::string_view, char>::format(value.view(), ctx);
+        }
+    };
+
+    /**
+     * @brief Format CStringView like std::string_view
+     */
+    template <>
+    struct formatter<CStringView, char> : formatter<std::string_view, char>
+    {
+        template <class FormatContext>
+        auto format(const CStringView& value, FormatContext& ctx) const
+        {
+            return formatter<std::string_view, char>::format(std::string_view(value.data ? value.data : "", value.length), ctx);
+        }
+    };
+}
+
+#endif // CSTR_FORMAT_HPP
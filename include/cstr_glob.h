@@ -0,0 +1,1042 @@
+#pragma once
+
+/**
+ * @file cstr_glob.h
+ * @brief Precompiled glob patterns ('*', '?', [set]) and glob sets.
+ *
+ * A glob is split at its stars into segments. Anchored segments are compared
+ * in place, the others are located leftmost (which is always sufficient for
+ * '*'), so a match runs in linear time. Literal segments are located with
+ * cstr_view_find(), other segments up to 64 items with a bit-parallel
+ * Shift-And scan.
+ *
+ * A glob set picks one literal per pattern, finds all of them in one
+ * Aho-Corasick pass, and verifies only the patterns whose literal occurred.
+ */
+
+#ifndef CSTR_GLOB_H
+#define CSTR_GLOB_H
+
+#include "cstr.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @def CSTR_GLOB_ICASE
+     * @brief Compile flag: ASCII case-insensitive matching
+     */
+#define CSTR_GLOB_ICASE 1
+
+    /**
+     * @def CSTR_GLOB_PATHNAME
+     * @brief Compile flag: '*', '?' and [set] do not match '/'; '**' does
+     */
+#define CSTR_GLOB_PATHNAME 2
+
+    /**
+     * @def CSTR_GLOB_NOESCAPE
+     * @brief Compile flag: '\' is an ordinary character
+     */
+#define CSTR_GLOB_NOESCAPE 4
+
+#define CSTR_GLOB_NONE 0xFFFFFFFFu
+
+    /**
+     * @struct CStringGlobSegment
+     * @brief Run of items between two stars
+     *
+     * @var length     - Number of items (bytes matched)
+     * @var literal    - Item bytes when every item is a single byte, else NULL
+     * @var sets       - Byte set per item, four 64-bit words each
+     * @var masks      - Shift-And masks per byte (length <= 64), else NULL
+     * @var first_byte - First item byte if it is a single byte, else -1
+     * @var cross      - Star before this segment may cross '/'
+     */
+    typedef struct
+    {
+        size_t length;        ///< Items
+        uint8_t* literal;     ///< Literal bytes
+        uint64_t* sets;       ///< Item byte sets
+        uint64_t* masks;      ///< Shift-And masks
+        int first_byte;       ///< Prefilter byte
+        bool cross;           ///< Preceding star crosses '/'
+    }CStringGlobSegment;
+
+    /**
+     * @struct CStringGlob
+     * @brief Compiled glob pattern
+     *
+     * @var segments       - Segments in pattern order
+     * @var segment_count  - Number of segments
+     * @var leading_star   - Pattern starts with '*'
+     * @var trailing_star  - Pattern ends with '*'
+     * @var trailing_cross - Final star may cross '/'
+     * @var min_length     - Shortest matching input
+     * @var flags          - CSTR_GLOB_* flags
+     * @note Immutable after compilation; safe to share between threads
+     */
+    typedef struct
+    {
+        CStringGlobSegment* segments; ///< Segments
+        size_t segment_count;         ///< Segment count
+        bool leading_star;            ///< Unanchored start
+        bool trailing_star;           ///< Unanchored end
+        bool trailing_cross;          ///< Final star crosses '/'
+        size_t min_length;            ///< Sum of segment lengths
+        unsigned flags;               ///< Compile flags
+    }CStringGlob;
+
+    /**
+     * @struct CStringGlobKey
+     * @brief Output entry of the glob set automaton
+     */
+    typedef struct
+    {
+        uint32_t glob;    ///< Pattern index
+        uint32_t next;    ///< Next entry of the same state
+    }CStringGlobKey;
+
+    /**
+     * @struct CStringGlobSet
+     * @brief Many globs matched in one pass
+     *
+     * @var globs          - Compiled patterns
+     * @var count          - Number of patterns
+     * @var capacity       - Allocated patterns
+     * @var always         - Patterns without a literal; always verified
+     * @var always_count   - Number of such patterns
+     * @var next           - Aho-Corasick transitions, state * alphabet + symbol
+     * @var output         - First key entry per state
+     * @var dict           - Nearest suffix state with keys
+     * @var keys           - Key entries
+     * @var state_count    - Automaton states
+     * @var byte_map       - Byte to symbol, case folded
+     * @var alphabet       - Number of symbols
+     * @var built          - Automaton matches the current patterns
+     * @note Immutable after cstr_globset_build(); concurrent matching is safe
+     */
+    typedef struct
+    {
+        CStringGlob* globs;           ///< Patterns
+        size_t count;                 ///< Pattern count
+        size_t capacity;              ///< Allocated patterns
+        uint32_t* always;             ///< Patterns without literal
+        size_t always_count;          ///< Count of such patterns
+        int32_t* next;                ///< Transitions
+        uint32_t* output;             ///< Key list per state
+        uint32_t* dict;               ///< Dictionary suffix links
+        CStringGlobKey* keys;         ///< Key entries
+        size_t state_count;           ///< States
+        uint8_t byte_map[256];        ///< Symbol per byte
+        size_t alphabet;              ///< Symbol count
+        bool built;                   ///< Automaton up to date
+    }CStringGlobSet;
+
+    /**
+     * @brief Callback for glob set matches
+     * @return true to continue, false to stop
+     */
+    typedef bool (*CStringGlobCallback)(size_t index, void* ctx);
+
+    CSTR_API bool cstr_glob_destroy(_In_ CStringGlob* glob);
+    CSTR_API bool cstr_glob_compile(_Out_ CStringGlob* glob, _In_reads_(length) const char* pattern, _In_ size_t length, _In_ unsigned flags);
+    CSTR_API bool cstr_glob_compile_cstr(_Out_ CStringGlob* glob, _In_ CString* pattern, _In_ unsigned flags);
+    CSTR_API bool cstr_glob_match(_In_ const CStringGlob* glob, _In_reads_(length) const char* data, _In_ size_t length);
+    CSTR_API bool cstr_glob_match_cstr(_In_ const CStringGlob* glob, _In_ CString* obj);
+    CSTR_API bool cstr_globset_create(_Out_ CStringGlobSet* set);
+    CSTR_API bool cstr_globset_destroy(_In_ CStringGlobSet* set);
+    CSTR_API size_t cstr_globset_add(_Inout_ CStringGlobSet* set, _In_reads_(length) const char* pattern, _In_ size_t length, _In_ unsigned flags);
+    CSTR_API size_t cstr_globset_add_cstr(_Inout_ CStringGlobSet* set, _In_ CString* pattern, _In_ unsigned flags);
+    CSTR_API bool cstr_globset_build(_Inout_ CStringGlobSet* set);
+    CSTR_API size_t cstr_globset_match(_In_ const CStringGlobSet* set, _In_reads_(length) const char* data, _In_ size_t length, _In_opt_ CStringGlobCallback callback, _In_opt_ void* ctx);
+    CSTR_API size_t cstr_globset_match_cstr(_In_ const CStringGlobSet* set, _In_ CString* obj, _In_opt_ CStringGlobCallback callback, _In_opt_ void* ctx);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_GLOB)
+
+    /**
+     * @brief Release compiled glob
+     * @param glob Glob to destroy
+     * @return true on success
+     */
+    bool cstr_glob_destroy(_In_ CStringGlob* glob)
+    {
+        if (!glob)
+            return false;
+
+        for (size_t i = 0; i < glob->segment_count; ++i)
+        {
+            free(glob->segments[i].literal);
+            free(glob->segments[i].sets);
+            free(glob->segments[i].masks);
+        }
+
+        free(glob->segments);
+        memset(glob, 0, sizeof(*glob));
+
+        return true;
+    }
+
+    /**
+     * @brief Parse one pattern item into a byte set
+     * @param pattern Pattern bytes
+     * @param length  Pattern length
+     * @param pos     Position of the item, advanced past it
+     * @param flags   CSTR_GLOB_* flags
+     * @param set     Receives the matching bytes
+     * @note A '[' without closing ']' is an ordinary character
+     */
+    CSTR_INLINE void cstr_glob_parse_item(_In_reads_(length) const char* pattern, _In_ size_t length, _Inout_ size_t* pos, _In_ unsigned flags, _Out_writes_(4) uint64_t* set)
+    {
+        memset(set, 0, 4 * sizeof(uint64_t));
+
+        uint8_t c = (uint8_t)pattern[(*pos)++];
+
+        if (c == '?')
+        {
+            for (int i = 0; i < 4; ++i)
+                set[i] = ~(uint64_t)0;
+        }
+        else if (c == '[')
+        {
+            size_t p = *pos;
+            bool negate = false;
+
+            if (p < length && (pattern[p] == '!' || pattern[p] == '^'))
+            {
+                negate = true;
+                p++;
+            }
+
+            bool first = true;
+            bool closed = false;
+            while (p < length)
+            {
+                uint8_t lo = (uint8_t)pattern[p];
+                if (lo == ']' && !first)
+                {
+                    closed = true;
+                    p++;
+                    break;
+                }
+                first = false;
+                p++;
+
+                if (lo == '\\' && !(flags & CSTR_GLOB_NOESCAPE) && p < length)
+                    lo = (uint8_t)pattern[p++];
+
+                uint8_t hi = lo;
+                if (p + 1 < length && pattern[p] == '-' && pattern[p + 1] != ']')
+                {
+                    hi = (uint8_t)pattern[p + 1];
+                    p += 2;
+                    if (hi == '\\' && !(flags & CSTR_GLOB_NOESCAPE) && p < length)
+                        hi = (uint8_t)pattern[p++];
+                }
+
+                for (unsigned b = lo; b <= hi; ++b)
+                    set[b >> 6] |= (uint64_t)1 << (b & 63);
+            }
+
+            if (!closed)
+            {
+                memset(set, 0, 4 * sizeof(uint64_t));
+                set['[' >> 6] |= (uint64_t)1 << ('[' & 63);
+            }
+            else
+            {
+                *pos = p;
+                if (flags & CSTR_GLOB_ICASE)
+                {
+                    for (unsigned b = 'A'; b <= 'Z'; ++b)
+                    {
+                        uint64_t both = ((set[b >> 6] >> (b & 63)) | (set[(b | 0x20) >> 6] >> ((b | 0x20) & 63))) & 1;
+                        set[b >> 6] |= both << (b & 63);
+                        set[(b | 0x20) >> 6] |= both << ((b | 0x20) & 63);
+                    }
+                }
+                if (negate)
+                {
+                    for (int i = 0; i < 4; ++i)
+                        set[i] = ~set[i];
+                }
+            }
+        }
+        else
+        {
+            if (c == '\\' && !(flags & CSTR_GLOB_NOESCAPE) && *pos < length)
+                c = (uint8_t)pattern[(*pos)++];
+
+            set[c >> 6] |= (uint64_t)1 << (c & 63);
+            if ((flags & CSTR_GLOB_ICASE) && ((c | 0x20) >= 'a' && (c | 0x20) <= 'z'))
+                set[(c ^ 0x20) >> 6] |= (uint64_t)1 << ((c ^ 0x20) & 63);
+            return;
+        }
+
+        // Wildcards never match a path separator; only a literal '/' does
+        if (flags & CSTR_GLOB_PATHNAME)
+            set['/' >> 6] &= ~((uint64_t)1 << ('/' & 63));
+    }
+
+    /**
+     * @brief Turn collected item sets into a segment
+     * @return true on success, false on allocation failure
+     */
+    CSTR_INLINE bool cstr_glob_finish_segment(_Inout_ CStringGlob* glob, _In_ uint64_t* sets, _In_ size_t length, _In_ bool cross)
+    {
+        CStringGlobSegment* segments = (CStringGlobSegment*)realloc(glob->segments, (glob->segment_count + 1) * sizeof(CStringGlobSegment));
+        if (!segments)
+        {
+            free(sets);
+            return false;
+        }
+        glob->segments = segments;
+
+        CStringGlobSegment* seg = &segments[glob->segment_count++];
+        memset(seg, 0, sizeof(*seg));
+        seg->length = length;
+        seg->sets = sets;
+        seg->cross = cross;
+        seg->first_byte = -1;
+
+        bool literal = true;
+        for (size_t i = 0; i < length; ++i)
+        {
+            const uint64_t* set = sets + i * 4;
+            unsigned bits = cstr_popcount64(set[0]) + cstr_popcount64(set[1]) + cstr_popcount64(set[2]) + cstr_popcount64(set[3]);
+            if (bits != 1)
+            {
+                literal = false;
+                continue;
+            }
+            if (i == 0)
+            {
+                int b = 0;
+                while (!((set[b >> 6] >> (b & 63)) & 1))
+                    b++;
+                seg->first_byte = b;
+            }
+        }
+
+        if (literal)
+        {
+            seg->literal = (uint8_t*)malloc(length);
+            if (!seg->literal)
+                return false;
+            for (size_t i = 0; i < length; ++i)
+            {
+                const uint64_t* set = sets + i * 4;
+                unsigned b = 0;
+                while (!((set[b >> 6] >> (b & 63)) & 1))
+                    b++;
+                seg->literal[i] = (uint8_t)b;
+            }
+        }
+        else if (length <= 64)
+        {
+            seg->masks = (uint64_t*)calloc(256, sizeof(uint64_t));
+            if (!seg->masks)
+                return false;
+            for (size_t i = 0; i < length; ++i)
+            {
+                const uint64_t* set = sets + i * 4;
+                for (unsigned b = 0; b < 256; ++b)
+                {
+                    if ((set[b >> 6] >> (b & 63)) & 1)
+                        seg->masks[b] |= (uint64_t)1 << i;
+                }
+            }
+        }
+
+        glob->min_length += length;
+
+        return true;
+    }
+
+    /**
+     * @brief Compile glob pattern
+     * @param glob    Glob to initialize
+     * @param pattern Pattern bytes
+     * @param length  Pattern length
+     * @param flags   CSTR_GLOB_ICASE, CSTR_GLOB_PATHNAME, CSTR_GLOB_NOESCAPE
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_glob_compile(_Out_ CStringGlob* glob, _In_reads_(length) const char* pattern, _In_ size_t length, _In_ unsigned flags)
+    {
+        if (!glob)
+            return false;
+
+        memset(glob, 0, sizeof(*glob));
+        glob->flags = flags;
+
+        if (!pattern && length)
+            return false;
+
+        uint64_t* sets = NULL;
+        size_t items = 0;
+        size_t capacity = 0;
+        bool cross = false;
+        size_t pos = 0;
+
+        while (pos < length)
+        {
+            if (pattern[pos] == '*')
+            {
+                size_t run = 0;
+                while (pos < length && pattern[pos] == '*')
+                {
+                    run++;
+                    pos++;
+                }
+
+                if (items)
+                {
+                    if (!cstr_glob_finish_segment(glob, sets, items, cross))
+                    {
+                        cstr_glob_destroy(glob);
+                        return false;
+                    }
+                    sets = NULL;
+                    items = 0;
+                    capacity = 0;
+                }
+                else if (!glob->segment_count)
+                    glob->leading_star = true;
+
+                cross = !(flags & CSTR_GLOB_PATHNAME) || run >= 2;
+                glob->trailing_star = pos == length;
+                glob->trailing_cross = cross;
+                continue;
+            }
+
+            if (items == capacity)
+            {
+                capacity = capacity ? capacity * 2 : 8;
+                uint64_t* grown = (uint64_t*)realloc(sets, capacity * 4 * sizeof(uint64_t));
+                if (!grown)
+                {
+                    free(sets);
+                    cstr_glob_destroy(glob);
+                    return false;
+                }
+                sets = grown;
+            }
+
+            cstr_glob_parse_item(pattern, length, &pos, flags, sets + items * 4);
+            items++;
+        }
+
+        if (items && !cstr_glob_finish_segment(glob, sets, items, cross))
+        {
+            cstr_glob_destroy(glob);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Compile glob pattern from CString
+     * @param glob    Glob to initialize
+     * @param pattern Pattern
+     * @param flags   CSTR_GLOB_* flags
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_glob_compile_cstr(_Out_ CStringGlob* glob, _In_ CString* pattern, _In_ unsigned flags)
+    {
+        if (!glob || !pattern)
+            return false;
+
+        cstr_lock(pattern);
+
+        bool out = cstr_glob_compile(glob, pattern->data, pattern->length, flags);
+
+        cstr_unlock(pattern);
+
+        return out;
+    }
+
+    /**
+     * @brief Compare segment against input at fixed position
+     */
+    CSTR_INLINE bool cstr_glob_segment_at(_In_ const CStringGlobSegment* seg, _In_ const uint8_t* data)
+    {
+        if (seg->literal)
+            return memcmp(data, seg->literal, seg->length) == 0;
+
+        for (size_t i = 0; i < seg->length; ++i)
+        {
+            const uint64_t* set = seg->sets + i * 4;
+            if (!((set[data[i] >> 6] >> (data[i] & 63)) & 1))
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Find leftmost occurrence of segment within data[from, limit)
+     * @return Start position or CSTR_INVALID
+     */
+    CSTR_INLINE size_t cstr_glob_segment_find(_In_ const CStringGlobSegment* seg, _In_ const uint8_t* data, _In_ size_t from, _In_ size_t limit)
+    {
+        if (limit < from || limit - from < seg->length)
+            return cstr_invalid;
+
+        if (seg->literal)
+        {
+            CStringView haystack = { (const char*)data + from, limit - from };
+            CStringView needle = { (const char*)seg->literal, seg->length };
+            size_t at = cstr_view_find(haystack, needle);
+            return at == cstr_invalid ? cstr_invalid : from + at;
+        }
+
+        if (seg->masks)
+        {
+            uint64_t state = 0;
+            uint64_t accept = (uint64_t)1 << (seg->length - 1);
+
+            for (size_t i = from; i < limit; ++i)
+            {
+                // Nothing in flight: skip ahead to the next possible first byte
+                if (!state && seg->first_byte >= 0)
+                {
+                    const uint8_t* next = (const uint8_t*)memchr(data + i, seg->first_byte, limit - i);
+                    if (!next)
+                        return cstr_invalid;
+                    i = (size_t)(next - data);
+                }
+
+                state = ((state << 1) | 1) & seg->masks[data[i]];
+                if (state & accept)
+                    return i + 1 - seg->length;
+            }
+
+            return cstr_invalid;
+        }
+
+        for (size_t i = from; i + seg->length <= limit; ++i)
+        {
+            if (cstr_glob_segment_at(seg, data + i))
+                return i;
+        }
+
+        return cstr_invalid;
+    }
+
+    /**
+     * @brief Check that a star gap does not cross '/' when it must not
+     */
+    CSTR_INLINE bool cstr_glob_gap_ok(_In_ const CStringGlob* glob, _In_ bool cross, _In_ const uint8_t* data, _In_ size_t from, _In_ size_t to)
+    {
+        if (cross || !(glob->flags & CSTR_GLOB_PATHNAME) || to <= from)
+            return true;
+
+        return memchr(data + from, '/', to - from) == NULL;
+    }
+
+    /**
+     * @brief Match input against glob
+     * @param glob   Compiled glob
+     * @param data   Input bytes
+     * @param length Input length
+     * @return true if the whole input matches
+     */
+    bool cstr_glob_match(_In_ const CStringGlob* glob, _In_reads_(length) const char* data, _In_ size_t length)
+    {
+        if (!glob || (!data && length))
+            return false;
+
+        const uint8_t* bytes = (const uint8_t*)data;
+        size_t count = glob->segment_count;
+
+        if (length < glob->min_length)
+            return false;
+
+        if (count == 0)
+        {
+            if (!glob->leading_star)
+                return length == 0;
+            return cstr_glob_gap_ok(glob, glob->trailing_cross, bytes, 0, length);
+        }
+
+        size_t first = 0;
+        size_t pos = 0;
+
+        if (!glob->leading_star)
+        {
+            // Anchored literal with no star at all: length check and one compare
+            if (count == 1 && !glob->trailing_star)
+                return length == glob->segments[0].length && cstr_glob_segment_at(&glob->segments[0], bytes);
+
+            if (!cstr_glob_segment_at(&glob->segments[0], bytes))
+                return false;
+            pos = glob->segments[0].length;
+            first = 1;
+        }
+
+        size_t last = glob->trailing_star ? count : count - 1;
+        size_t tail = glob->trailing_star ? 0 : glob->segments[count - 1].length;
+
+        for (size_t i = first; i < last; ++i)
+        {
+            const CStringGlobSegment* seg = &glob->segments[i];
+            size_t at = cstr_glob_segment_find(seg, bytes, pos, length - tail);
+            if (at == cstr_invalid)
+                return false;
+
+            // A later occurrence would only lengthen the gap
+            if (!cstr_glob_gap_ok(glob, seg->cross, bytes, pos, at))
+                return false;
+
+            pos = at + seg->length;
+        }
+
+        if (glob->trailing_star)
+            return cstr_glob_gap_ok(glob, glob->trailing_cross, bytes, pos, length);
+
+        const CStringGlobSegment* seg = &glob->segments[count - 1];
+        size_t at = length - seg->length;
+        if (at < pos)
+            return false;
+
+        return cstr_glob_gap_ok(glob, seg->cross, bytes, pos, at) && cstr_glob_segment_at(seg, bytes + at);
+    }
+
+    /**
+     * @brief Match CString against glob
+     * @param glob Compiled glob
+     * @param obj  CString to test
+     * @return true if the whole string matches
+     */
+    bool cstr_glob_match_cstr(_In_ const CStringGlob* glob, _In_ CString* obj)
+    {
+        if (!obj)
+            return false;
+
+        cstr_lock(obj);
+
+        bool out = cstr_glob_match(glob, obj->data, obj->length);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Initialize empty glob set
+     * @param set Set to initialize
+     * @return true on success
+     */
+    bool cstr_globset_create(_Out_ CStringGlobSet* set)
+    {
+        if (!set)
+            return false;
+
+        memset(set, 0, sizeof(*set));
+
+        return true;
+    }
+
+    /**
+     * @brief Release automaton
+     */
+    CSTR_INLINE void cstr_globset_free_automaton(_Inout_ CStringGlobSet* set)
+    {
+        free(set->always);
+        free(set->next);
+        free(set->output);
+        free(set->dict);
+        free(set->keys);
+
+        set->always = NULL;
+        set->next = NULL;
+        set->output = NULL;
+        set->dict = NULL;
+        set->keys = NULL;
+        set->always_count = 0;
+        set->state_count = 0;
+        set->built = false;
+    }
+
+    /**
+     * @brief Release glob set
+     * @param set Set to destroy
+     * @return true on success
+     */
+    bool cstr_globset_destroy(_In_ CStringGlobSet* set)
+    {
+        if (!set)
+            return false;
+
+        cstr_globset_free_automaton(set);
+
+        for (size_t i = 0; i < set->count; ++i)
+            cstr_glob_destroy(&set->globs[i]);
+
+        free(set->globs);
+        memset(set, 0, sizeof(*set));
+
+        return true;
+    }
+
+    /**
+     * @brief Add pattern to set
+     * @param set     Glob set
+     * @param pattern Pattern bytes
+     * @param length  Pattern length
+     * @param flags   CSTR_GLOB_* flags
+     * @return Pattern index or CSTR_INVALID on failure
+     * @note Invalidates the automaton; call cstr_globset_build() before matching
+     */
+    size_t cstr_globset_add(_Inout_ CStringGlobSet* set, _In_reads_(length) const char* pattern, _In_ size_t length, _In_ unsigned flags)
+    {
+        if (!set || set->count >= CSTR_GLOB_NONE)
+            return cstr_invalid;
+
+        if (set->count == set->capacity)
+        {
+            size_t capacity = set->capacity ? set->capacity * 2 : 16;
+            CStringGlob* globs = (CStringGlob*)realloc(set->globs, capacity * sizeof(CStringGlob));
+            if (!globs)
+                return cstr_invalid;
+            set->globs = globs;
+            set->capacity = capacity;
+        }
+
+        if (!cstr_glob_compile(&set->globs[set->count], pattern, length, flags))
+            return cstr_invalid;
+
+        set->built = false;
+
+        return set->count++;
+    }
+
+    /**
+     * @brief Add CString pattern to set
+     * @param set     Glob set
+     * @param pattern Pattern
+     * @param flags   CSTR_GLOB_* flags
+     * @return Pattern index or CSTR_INVALID on failure
+     */
+    size_t cstr_globset_add_cstr(_Inout_ CStringGlobSet* set, _In_ CString* pattern, _In_ unsigned flags)
+    {
+        if (!pattern)
+            return cstr_invalid;
+
+        cstr_lock(pattern);
+
+        size_t out = cstr_globset_add(set, pattern->data, pattern->length, flags);
+
+        cstr_unlock(pattern);
+
+        return out;
+    }
+
+    /**
+     * @brief Pick the longest literal run of a glob as its prefilter key
+     * @param glob   Compiled glob
+     * @param key    Receives lower-cased key bytes (points into a segment)
+     * @param offset Receives first item of the run
+     * @return Key length (0 if the glob has no literal)
+     */
+    CSTR_INLINE size_t cstr_globset_key(_In_ const CStringGlob* glob, _Out_ const CStringGlobSegment** key, _Out_ size_t* offset)
+    {
+        size_t best = 0;
+        *key = NULL;
+        *offset = 0;
+
+        for (size_t s = 0; s < glob->segment_count; ++s)
+        {
+            const CStringGlobSegment* seg = &glob->segments[s];
+            size_t run = 0;
+
+            for (size_t i = 0; i <= seg->length; ++i)
+            {
+                bool literal = false;
+                if (i < seg->length)
+                {
+                    const uint64_t* set = seg->sets + i * 4;
+                    unsigned bits = cstr_popcount64(set[0]) + cstr_popcount64(set[1]) + cstr_popcount64(set[2]) + cstr_popcount64(set[3]);
+                    literal = bits == 1;
+                    if (bits == 2)
+                    {
+                        // Case pair from CSTR_GLOB_ICASE
+                        unsigned lower = 'a';
+                        while (lower <= 'z' && !((set[lower >> 6] >> (lower & 63)) & 1))
+                            lower++;
+                        literal = lower <= 'z' && ((set[(lower ^ 0x20) >> 6] >> ((lower ^ 0x20) & 63)) & 1);
+                    }
+                }
+
+                if (literal)
+                {
+                    run++;
+                    continue;
+                }
+
+                if (run > best)
+                {
+                    best = run;
+                    *key = seg;
+                    *offset = i - run;
+                }
+                run = 0;
+            }
+        }
+
+        return best;
+    }
+
+    /**
+     * @brief Lower-cased key byte of a literal item
+     */
+    CSTR_INLINE uint8_t cstr_globset_key_byte(_In_ const uint64_t* set)
+    {
+        unsigned b = 0;
+        while (!((set[b >> 6] >> (b & 63)) & 1))
+            b++;
+
+        return (b >= 'A' && b <= 'Z') ? (uint8_t)(b | 0x20) : (uint8_t)b;
+    }
+
+    /**
+     * @brief Build the Aho-Corasick prefilter over all patterns
+     * @param set Glob set
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_globset_build(_Inout_ CStringGlobSet* set)
+    {
+        if (!set)
+            return false;
+
+        cstr_globset_free_automaton(set);
+
+        // Alphabet: one symbol per distinct (case-folded) key byte, 0 for the rest
+        bool used[256];
+        memset(used, 0, sizeof(used));
+        size_t total = 1;
+
+        for (size_t g = 0; g < set->count; ++g)
+        {
+            const CStringGlobSegment* seg;
+            size_t offset;
+            size_t length = cstr_globset_key(&set->globs[g], &seg, &offset);
+            for (size_t i = 0; i < length; ++i)
+                used[cstr_globset_key_byte(seg->sets + (offset + i) * 4)] = true;
+            total += length;
+        }
+
+        memset(set->byte_map, 0, sizeof(set->byte_map));
+        set->alphabet = 1;
+        for (unsigned b = 0; b < 256; ++b)
+        {
+            if (used[b])
+                set->byte_map[b] = (uint8_t)set->alphabet++;
+        }
+        for (unsigned b = 'A'; b <= 'Z'; ++b)
+            set->byte_map[b] = set->byte_map[b | 0x20];
+
+        set->next = (int32_t*)malloc(total * set->alphabet * sizeof(int32_t));
+        set->output = (uint32_t*)malloc(total * sizeof(uint32_t));
+        set->dict = (uint32_t*)malloc(total * sizeof(uint32_t));
+        set->keys = (CStringGlobKey*)malloc((set->count + 1) * sizeof(CStringGlobKey));
+        set->always = (uint32_t*)malloc((set->count + 1) * sizeof(uint32_t));
+        uint32_t* fail = (uint32_t*)malloc(total * sizeof(uint32_t));
+        uint32_t* queue = (uint32_t*)malloc(total * sizeof(uint32_t));
+
+        if (!set->next || !set->output || !set->dict || !set->keys || !set->always || !fail || !queue)
+        {
+            free(fail);
+            free(queue);
+            cstr_globset_free_automaton(set);
+            return false;
+        }
+
+        // Trie
+        set->state_count = 1;
+        for (size_t i = 0; i < set->alphabet; ++i)
+            set->next[i] = -1;
+        set->output[0] = CSTR_GLOB_NONE;
+
+        size_t key_count = 0;
+        for (size_t g = 0; g < set->count; ++g)
+        {
+            const CStringGlobSegment* seg;
+            size_t offset;
+            size_t length = cstr_globset_key(&set->globs[g], &seg, &offset);
+
+            if (!length)
+            {
+                set->always[set->always_count++] = (uint32_t)g;
+                continue;
+            }
+
+            size_t state = 0;
+            for (size_t i = 0; i < length; ++i)
+            {
+                uint8_t symbol = set->byte_map[cstr_globset_key_byte(seg->sets + (offset + i) * 4)];
+                int32_t* edge = &set->next[state * set->alphabet + symbol];
+                if (*edge < 0)
+                {
+                    size_t created = set->state_count++;
+                    for (size_t k = 0; k < set->alphabet; ++k)
+                        set->next[created * set->alphabet + k] = -1;
+                    set->output[created] = CSTR_GLOB_NONE;
+                    *edge = (int32_t)created;
+                }
+                state = (size_t)*edge;
+            }
+
+            set->keys[key_count].glob = (uint32_t)g;
+            set->keys[key_count].next = set->output[state];
+            set->output[state] = (uint32_t)key_count++;
+        }
+
+        // Failure links, folded into a complete transition table (BFS order)
+        size_t head = 0;
+        size_t tail = 0;
+
+        fail[0] = 0;
+        set->dict[0] = CSTR_GLOB_NONE;
+        for (size_t c = 0; c < set->alphabet; ++c)
+        {
+            int32_t child = set->next[c];
+            if (child < 0)
+                set->next[c] = 0;
+            else
+            {
+                fail[child] = 0;
+                set->dict[child] = CSTR_GLOB_NONE;
+                queue[tail++] = (uint32_t)child;
+            }
+        }
+
+        while (head < tail)
+        {
+            uint32_t state = queue[head++];
+            for (size_t c = 0; c < set->alphabet; ++c)
+            {
+                int32_t* edge = &set->next[state * set->alphabet + c];
+                int32_t target = set->next[fail[state] * set->alphabet + c];
+                if (*edge < 0)
+                {
+                    *edge = target;
+                    continue;
+                }
+
+                uint32_t child = (uint32_t)*edge;
+                fail[child] = (uint32_t)target;
+                set->dict[child] = set->output[target] != CSTR_GLOB_NONE ? (uint32_t)target : set->dict[target];
+                queue[tail++] = child;
+            }
+        }
+
+        free(fail);
+        free(queue);
+
+        set->built = true;
+
+        return true;
+    }
+
+    /**
+     * @brief Match input against every pattern in the set
+     * @param set      Built glob set
+     * @param data     Input bytes
+     * @param length   Input length
+     * @param callback Called per matching pattern in index order; return false to stop
+     * @param ctx      User context passed to callback
+     * @return Number of matching patterns reported, or CSTR_INVALID on failure
+     */
+    size_t cstr_globset_match(_In_ const CStringGlobSet* set, _In_reads_(length) const char* data, _In_ size_t length, _In_opt_ CStringGlobCallback callback, _In_opt_ void* ctx)
+    {
+        if (!set || !set->built || (!data && length))
+            return cstr_invalid;
+
+        size_t words = (set->count + 63) / 64;
+        size_t state_words = (set->state_count + 63) / 64;
+        uint64_t* candidates = (uint64_t*)calloc(words + state_words + 1, sizeof(uint64_t));
+        if (!candidates)
+            return cstr_invalid;
+        uint64_t* visited = candidates + words;
+
+        for (size_t i = 0; i < set->always_count; ++i)
+            candidates[set->always[i] >> 6] |= (uint64_t)1 << (set->always[i] & 63);
+
+        const uint8_t* bytes = (const uint8_t*)data;
+        size_t state = 0;
+
+        for (size_t i = 0; i < length; ++i)
+        {
+            state = (size_t)set->next[state * set->alphabet + set->byte_map[bytes[i]]];
+
+            // Report each key state once per scan
+            for (uint32_t s = set->output[state] != CSTR_GLOB_NONE ? (uint32_t)state : set->dict[state]; s != CSTR_GLOB_NONE; s = set->dict[s])
+            {
+                if ((visited[s >> 6] >> (s & 63)) & 1)
+                    break;
+                visited[s >> 6] |= (uint64_t)1 << (s & 63);
+
+                for (uint32_t k = set->output[s]; k != CSTR_GLOB_NONE; k = set->keys[k].next)
+                    candidates[set->keys[k].glob >> 6] |= (uint64_t)1 << (set->keys[k].glob & 63);
+            }
+        }
+
+        size_t found = 0;
+        for (size_t w = 0; w < words; ++w)
+        {
+            uint64_t bits = candidates[w];
+            while (bits)
+            {
+                size_t g = w * 64 + cstr_ctz64(bits);
+                bits &= bits - 1;
+
+                if (!cstr_glob_match(&set->globs[g], data, length))
+                    continue;
+
+                found++;
+                if (callback && !callback(g, ctx))
+                {
+                    free(candidates);
+                    return found;
+                }
+            }
+        }
+
+        free(candidates);
+
+        return found;
+    }
+
+    /**
+     * @brief Match CString against every pattern in the set
+     * @param set      Built glob set
+     * @param obj      CString to test
+     * @param callback Called per matching pattern; return false to stop
+     * @param ctx      User context passed to callback
+     * @return Number of matching patterns reported, or CSTR_INVALID on failure
+     */
+    size_t cstr_globset_match_cstr(_In_ const CStringGlobSet* set, _In_ CString* obj, _In_opt_ CStringGlobCallback callback, _In_opt_ void* ctx)
+    {
+        if (!obj)
+            return cstr_invalid;
+
+        cstr_lock(obj);
+
+        size_t out = cstr_globset_match(set, obj->data, obj->length, callback, ctx);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+#endif // CSTR_IMPLEMENT_GLOB
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_GLOB_H
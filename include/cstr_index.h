@@ -0,0 +1,892 @@
+#pragma once
+
+/**
+ * @file cstr_index.h
+ * @brief Suffix array / FM-index for repeated substring queries on immutable text.
+ *
+ * The suffix array is built with SA-IS in linear time. The optional FM-index
+ * (BWT + two-level occurrence counts + sampled suffix array) answers count in
+ * O(m) and locates without the full suffix array. Indexes can be saved to a
+ * file and memory-mapped back without rebuilding.
+ */
+
+#ifndef CSTR_INDEX_H
+#define CSTR_INDEX_H
+
+#include "cstr.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CSTR_INDEX_SA 0x1  ///< Keep full suffix array (8 bytes per character)
+#define CSTR_INDEX_FM 0x2  ///< Build FM-index (about 3 bytes per character plus samples)
+
+    /**
+     * @def CSTR_INDEX_SAMPLE_RATE
+     * @brief FM-index keeps the suffix array entry of every Nth text position
+     */
+#ifndef CSTR_INDEX_SAMPLE_RATE
+#define CSTR_INDEX_SAMPLE_RATE 32
+#endif
+
+    /**
+     * @def CSTR_INDEX_FIND_LOCATE
+     * @brief cstr_index_find() locates up to this many matches; with more it scans the text
+     */
+#ifndef CSTR_INDEX_FIND_LOCATE
+#define CSTR_INDEX_FIND_LOCATE 16
+#endif
+
+#define CSTR_INDEX_SUPER_SHIFT 16  ///< Rows per occurrence superblock (log2)
+#define CSTR_INDEX_BLOCK_SHIFT 8   ///< Rows per occurrence block (log2)
+
+    /**
+     * @struct CStringIndex
+     * @brief Immutable substring index over a copy of a string
+     *
+     * @var n            - Text length
+     * @var flags        - CSTR_INDEX_SA and/or CSTR_INDEX_FM
+     * @var text         - Indexed text (n bytes + null-terminator)
+     * @var sa           - Suffix array, n + 1 rows (row 0 is the empty suffix) or NULL
+     * @var bwt          - Burrows-Wheeler transform, n + 1 rows, or NULL
+     * @var primary      - BWT row holding the virtual sentinel
+     * @var counts       - counts[c] = first row of suffixes starting with byte c
+     * @var occ_super    - Byte counts before each superblock (256 per superblock)
+     * @var occ_block    - Byte counts before each block, relative to its superblock
+     * @var sample_rate  - Text position sampling rate of the FM-index
+     * @var sample_bits  - Rows whose suffix array entry is sampled
+     * @var sample_rank  - Set bits before each word of sample_bits
+     * @var samples      - Sampled suffix array entries in row order
+     * @var memory       - Owned allocations (NULL entries when mapped)
+     * @var file         - Mapped file handle or NULL
+     * @var mapping      - File mapping handle or NULL
+     * @var view         - Mapped view or NULL
+     *
+     * @note Read-only after creation, so queries need no locking.
+     */
+    typedef struct
+    {
+        uint64_t n;                     ///< Text length
+        uint64_t flags;                 ///< Index parts present
+        const uint8_t* text;            ///< Indexed text
+        const uint64_t* sa;             ///< Suffix array
+        const uint8_t* bwt;             ///< BWT
+        uint64_t primary;               ///< Sentinel row
+        uint64_t counts[257];           ///< Cumulative byte counts (C array)
+        const uint64_t* occ_super;      ///< Superblock counts
+        const uint16_t* occ_block;      ///< Block counts
+        uint64_t sample_rate;           ///< Sampling rate
+        const uint64_t* sample_bits;    ///< Sampled-row bitvector
+        const uint64_t* sample_rank;    ///< Rank directory
+        const uint64_t* samples;        ///< Sampled entries
+        void* memory[8];                ///< Owned allocations
+        HANDLE file;                    ///< Mapped file
+        HANDLE mapping;                 ///< File mapping
+        void* view;                     ///< Mapped view
+    }CStringIndex;
+
+    /**
+     * @struct CStringSaisText
+     * @brief SA-IS input: bytes with virtual sentinel, or reduced integer string
+     */
+    typedef struct
+    {
+        const uint8_t* bytes;   ///< Level 0 text (sentinel appended virtually)
+        const int64_t* ints;    ///< Reduced string of deeper levels
+        int64_t n;              ///< Length including sentinel
+    }CStringSaisText;
+
+    /**
+     * @struct CStringIndexHeader
+     * @brief On-disk header; sections follow, each 8-byte aligned
+     */
+    typedef struct
+    {
+        char magic[8];            ///< "CSTRIDX1"
+        uint64_t n;               ///< Text length
+        uint64_t flags;           ///< Index parts present
+        uint64_t primary;         ///< Sentinel row
+        uint64_t sample_rate;     ///< Sampling rate
+        uint64_t counts[257];     ///< C array
+        uint64_t offsets[8];      ///< File offset of each section
+    }CStringIndexHeader;
+
+    CSTR_API bool cstr_index_destroy(_In_ CStringIndex* idx);
+    CSTR_API bool cstr_index_create_from_buffer(_Out_ CStringIndex* idx, _In_reads_(size) const uint8_t* data, _In_ size_t size, _In_ unsigned flags);
+    CSTR_API bool cstr_index_create(_Out_ CStringIndex* idx, _In_ CString* obj, _In_ unsigned flags);
+    CSTR_API size_t cstr_index_count(_In_ const CStringIndex* idx, _In_reads_(length) const char* pattern, _In_ size_t length);
+    CSTR_API size_t cstr_index_find(_In_ const CStringIndex* idx, _In_reads_(length) const char* pattern, _In_ size_t length);
+    CSTR_API size_t cstr_index_find_all(_In_ const CStringIndex* idx, _In_reads_(length) const char* pattern, _In_ size_t length, _Out_writes_opt_(max) size_t* positions, _In_ size_t max);
+    CSTR_API bool cstr_index_save(_In_ const CStringIndex* idx, _In_ const char* path);
+    CSTR_API bool cstr_index_load(_Out_ CStringIndex* idx, _In_ const char* path);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_INDEX)
+
+    /**
+     * @brief Character of SA-IS input (level 0 maps bytes to 1..256, sentinel 0)
+     */
+    CSTR_INLINE int64_t cstr_sais_chr(_In_ const CStringSaisText* s, _In_ int64_t i)
+    {
+        if (s->bytes)
+            return i == s->n - 1 ? 0 : (int64_t)s->bytes[i] + 1;
+        return s->ints[i];
+    }
+
+#define CSTR_SAIS_TGET(t, i)    (((t)[(i) >> 3] >> ((i) & 7)) & 1)
+#define CSTR_SAIS_TSET(t, i, b) ((b) ? ((t)[(i) >> 3] |= (uint8_t)(1 << ((i) & 7))) : ((t)[(i) >> 3] &= (uint8_t)~(1 << ((i) & 7))))
+#define CSTR_SAIS_LMS(t, i)     ((i) > 0 && CSTR_SAIS_TGET(t, i) && !CSTR_SAIS_TGET(t, (i) - 1))
+
+    /**
+     * @brief Compute bucket heads or tails
+     */
+    CSTR_INLINE void cstr_sais_buckets(_In_ const CStringSaisText* s, _Out_ int64_t* bkt, _In_ int64_t K, _In_ bool end)
+    {
+        int64_t sum = 0;
+
+        for (int64_t i = 0; i <= K; i++)
+            bkt[i] = 0;
+        for (int64_t i = 0; i < s->n; i++)
+            bkt[cstr_sais_chr(s, i)]++;
+        for (int64_t i = 0; i <= K; i++)
+        {
+            sum += bkt[i];
+            bkt[i] = end ? sum : sum - bkt[i];
+        }
+    }
+
+    /**
+     * @brief Induce L-type suffixes from sorted LMS suffixes
+     */
+    CSTR_INLINE void cstr_sais_induce_l(_In_ const uint8_t* t, _Inout_ int64_t* SA, _In_ const CStringSaisText* s, _Inout_ int64_t* bkt, _In_ int64_t K)
+    {
+        cstr_sais_buckets(s, bkt, K, false);
+        for (int64_t i = 0; i < s->n; i++)
+        {
+            int64_t j = SA[i] - 1;
+            if (SA[i] > 0 && !CSTR_SAIS_TGET(t, j))
+                SA[bkt[cstr_sais_chr(s, j)]++] = j;
+        }
+    }
+
+    /**
+     * @brief Induce S-type suffixes from sorted L-type suffixes
+     */
+    CSTR_INLINE void cstr_sais_induce_s(_In_ const uint8_t* t, _Inout_ int64_t* SA, _In_ const CStringSaisText* s, _Inout_ int64_t* bkt, _In_ int64_t K)
+    {
+        cstr_sais_buckets(s, bkt, K, true);
+        for (int64_t i = s->n - 1; i >= 0; i--)
+        {
+            int64_t j = SA[i] - 1;
+            if (SA[i] > 0 && CSTR_SAIS_TGET(t, j))
+                SA[--bkt[cstr_sais_chr(s, j)]] = j;
+        }
+    }
+
+    /**
+     * @brief SA-IS suffix array construction (Nong, Zhang & Chan)
+     * @param s  Input whose last character is a unique smallest sentinel
+     * @param SA Output suffix array of s->n entries
+     * @param K  Largest character value
+     * @return true on success, false on allocation failure
+     */
+    CSTR_INLINE bool cstr_sais(_In_ const CStringSaisText* s, _Out_ int64_t* SA, _In_ int64_t K)
+    {
+        int64_t n = s->n;
+        int64_t i, j;
+
+        if (n == 1)
+        {
+            SA[0] = 0;
+            return true;
+        }
+
+        uint8_t* t = (uint8_t*)calloc((size_t)(n / 8 + 1), 1);
+        int64_t* bkt = (int64_t*)malloc((size_t)(K + 1) * sizeof(int64_t));
+        if (!t || !bkt)
+        {
+            free(t);
+            free(bkt);
+            return false;
+        }
+
+        // Classify S (1) / L (0) types
+        CSTR_SAIS_TSET(t, n - 1, 1);
+        CSTR_SAIS_TSET(t, n - 2, 0);
+        for (i = n - 3; i >= 0; i--)
+        {
+            int64_t a = cstr_sais_chr(s, i);
+            int64_t b = cstr_sais_chr(s, i + 1);
+            CSTR_SAIS_TSET(t, i, (a < b || (a == b && CSTR_SAIS_TGET(t, i + 1))) ? 1 : 0);
+        }
+
+        // Stage 1: sort LMS substrings
+        cstr_sais_buckets(s, bkt, K, true);
+        for (i = 0; i < n; i++)
+            SA[i] = -1;
+        for (i = 1; i < n; i++)
+            if (CSTR_SAIS_LMS(t, i))
+                SA[--bkt[cstr_sais_chr(s, i)]] = i;
+        cstr_sais_induce_l(t, SA, s, bkt, K);
+        cstr_sais_induce_s(t, SA, s, bkt, K);
+
+        // Compact sorted LMS substrings and name them
+        int64_t n1 = 0;
+        for (i = 0; i < n; i++)
+            if (CSTR_SAIS_LMS(t, SA[i]))
+                SA[n1++] = SA[i];
+        for (i = n1; i < n; i++)
+            SA[i] = -1;
+
+        int64_t name = 0;
+        int64_t prev = -1;
+        for (i = 0; i < n1; i++)
+        {
+            int64_t pos = SA[i];
+            bool diff = false;
+            for (int64_t d = 0; d < n; d++)
+            {
+                if (prev == -1 || cstr_sais_chr(s, pos + d) != cstr_sais_chr(s, prev + d) || CSTR_SAIS_TGET(t, pos + d) != CSTR_SAIS_TGET(t, prev + d))
+                {
+                    diff = true;
+                    break;
+                }
+                if (d > 0 && (CSTR_SAIS_LMS(t, pos + d) || CSTR_SAIS_LMS(t, prev + d)))
+                    break;
+            }
+            if (diff)
+            {
+                name++;
+                prev = pos;
+            }
+            SA[n1 + pos / 2] = name - 1;
+        }
+        for (i = n - 1, j = n - 1; i >= n1; i--)
+            if (SA[i] >= 0)
+                SA[j--] = SA[i];
+
+        // Stage 2: sort reduced problem, recursing while names are not unique
+        int64_t* SA1 = SA;
+        int64_t* s1 = SA + n - n1;
+        if (name < n1)
+        {
+            CStringSaisText reduced = { NULL, s1, n1 };
+            if (!cstr_sais(&reduced, SA1, name - 1))
+            {
+                free(t);
+                free(bkt);
+                return false;
+            }
+        }
+        else
+        {
+            for (i = 0; i < n1; i++)
+                SA1[s1[i]] = i;
+        }
+
+        // Stage 3: induce full suffix array from sorted LMS suffixes
+        cstr_sais_buckets(s, bkt, K, true);
+        for (i = 1, j = 0; i < n; i++)
+            if (CSTR_SAIS_LMS(t, i))
+                s1[j++] = i;
+        for (i = 0; i < n1; i++)
+            SA1[i] = s1[SA1[i]];
+        for (i = n1; i < n; i++)
+            SA[i] = -1;
+        for (i = n1 - 1; i >= 0; i--)
+        {
+            j = SA[i];
+            SA[i] = -1;
+            SA[--bkt[cstr_sais_chr(s, j)]] = j;
+        }
+        cstr_sais_induce_l(t, SA, s, bkt, K);
+        cstr_sais_induce_s(t, SA, s, bkt, K);
+
+        free(bkt);
+        free(t);
+
+        return true;
+    }
+
+    /**
+     * @brief Size in bytes of each index section for text length n
+     */
+    CSTR_INLINE void cstr_index_section_sizes(_In_ uint64_t n, _In_ uint64_t flags, _In_ uint64_t sample_rate, _Out_writes_(8) uint64_t* sizes)
+    {
+        uint64_t rows = n + 1;
+        uint64_t words = (rows + 63) / 64;
+
+        sizes[0] = n + 1;
+        sizes[1] = (flags & CSTR_INDEX_SA) ? rows * sizeof(uint64_t) : 0;
+        sizes[2] = (flags & CSTR_INDEX_FM) ? rows : 0;
+        sizes[3] = (flags & CSTR_INDEX_FM) ? ((rows >> CSTR_INDEX_SUPER_SHIFT) + 1) * 256 * sizeof(uint64_t) : 0;
+        sizes[4] = (flags & CSTR_INDEX_FM) ? ((rows >> CSTR_INDEX_BLOCK_SHIFT) + 1) * 256 * sizeof(uint16_t) : 0;
+        sizes[5] = (flags & CSTR_INDEX_FM) ? words * sizeof(uint64_t) : 0;
+        sizes[6] = (flags & CSTR_INDEX_FM) ? words * sizeof(uint64_t) : 0;
+        sizes[7] = (flags & CSTR_INDEX_FM) ? ((n / sample_rate) + 1) * sizeof(uint64_t) : 0;
+    }
+
+    /**
+     * @brief Point index sections at consecutive 8-byte aligned regions
+     */
+    CSTR_INLINE void cstr_index_bind(_Inout_ CStringIndex* idx, _In_ uint8_t* const* sections)
+    {
+        idx->text = sections[0];
+        idx->sa = (const uint64_t*)sections[1];
+        idx->bwt = sections[2];
+        idx->occ_super = (const uint64_t*)sections[3];
+        idx->occ_block = (const uint16_t*)sections[4];
+        idx->sample_bits = (const uint64_t*)sections[5];
+        idx->sample_rank = (const uint64_t*)sections[6];
+        idx->samples = (const uint64_t*)sections[7];
+    }
+
+    /**
+     * @brief Reset index to empty state
+     */
+    CSTR_INLINE void cstr_index_init(_Out_ CStringIndex* idx)
+    {
+        memset(idx, 0, sizeof(*idx));
+    }
+
+    /**
+     * @brief Destroy index and release memory or file mapping
+     * @param idx CStringIndex to destroy
+     * @return true on success
+     */
+    bool cstr_index_destroy(_In_ CStringIndex* idx)
+    {
+        if (!idx)
+            return false;
+
+        for (int i = 0; i < 8; ++i)
+            free(idx->memory[i]);
+
+        if (idx->view)
+            UnmapViewOfFile(idx->view);
+        if (idx->mapping)
+            CloseHandle(idx->mapping);
+        if (idx->file)
+            CloseHandle(idx->file);
+
+        cstr_index_init(idx);
+
+        return true;
+    }
+
+    /**
+     * @brief Build index over a buffer
+     * @param idx   Destination CStringIndex
+     * @param data  Text bytes (copied)
+     * @param size  Text length
+     * @param flags CSTR_INDEX_SA and/or CSTR_INDEX_FM
+     * @return true on success, false on invalid arguments or allocation failure
+     */
+    bool cstr_index_create_from_buffer(_Out_ CStringIndex* idx, _In_reads_(size) const uint8_t* data, _In_ size_t size, _In_ unsigned flags)
+    {
+        if (!idx || (!data && size) || !(flags & (CSTR_INDEX_SA | CSTR_INDEX_FM)))
+            return false;
+
+        cstr_index_init(idx);
+
+        uint64_t n = size;
+        uint64_t rows = n + 1;
+        uint64_t sizes[8];
+        uint8_t* sections[8] = { NULL };
+
+        idx->n = n;
+        idx->flags = flags;
+        idx->sample_rate = CSTR_INDEX_SAMPLE_RATE;
+
+        cstr_index_section_sizes(n, flags, idx->sample_rate, sizes);
+        for (int i = 0; i < 8; ++i)
+        {
+            if (!sizes[i])
+                continue;
+            sections[i] = (uint8_t*)calloc(1, (size_t)sizes[i]);
+            idx->memory[i] = sections[i];
+            if (!sections[i])
+            {
+                cstr_index_destroy(idx);
+                return false;
+            }
+        }
+
+        if (n)
+            memcpy(sections[0], data, (size_t)n);
+        sections[0][n] = '\0';
+
+        // Suffix array is needed for construction even when only FM is kept
+        int64_t* sa = (int64_t*)((flags & CSTR_INDEX_SA) ? sections[1] : malloc((size_t)rows * sizeof(int64_t)));
+        if (!sa)
+        {
+            cstr_index_destroy(idx);
+            return false;
+        }
+
+        CStringSaisText text = { sections[0], NULL, (int64_t)rows };
+        if (!cstr_sais(&text, sa, 256))
+        {
+            if (!(flags & CSTR_INDEX_SA))
+                free(sa);
+            cstr_index_destroy(idx);
+            return false;
+        }
+
+        for (int c = 0; c < 257; ++c)
+            idx->counts[c] = 0;
+
+        if (flags & CSTR_INDEX_FM)
+        {
+            uint8_t* bwt = sections[2];
+            uint64_t* occ_super = (uint64_t*)sections[3];
+            uint16_t* occ_block = (uint16_t*)sections[4];
+            uint64_t* bits = (uint64_t*)sections[5];
+            uint64_t* rank = (uint64_t*)sections[6];
+            uint64_t* samples = (uint64_t*)sections[7];
+            uint64_t running[256] = { 0 };
+            uint64_t super_base[256] = { 0 };
+            uint64_t sampled = 0;
+
+            for (uint64_t r = 0; r <= rows; ++r)
+            {
+                if ((r & ((1u << CSTR_INDEX_SUPER_SHIFT) - 1)) == 0)
+                {
+                    memcpy(occ_super + (r >> CSTR_INDEX_SUPER_SHIFT) * 256, running, sizeof(running));
+                    memcpy(super_base, running, sizeof(running));
+                }
+                if ((r & ((1u << CSTR_INDEX_BLOCK_SHIFT) - 1)) == 0)
+                {
+                    for (int c = 0; c < 256; ++c)
+                        occ_block[(r >> CSTR_INDEX_BLOCK_SHIFT) * 256 + c] = (uint16_t)(running[c] - super_base[c]);
+                }
+                if (r == rows)
+                    break;
+
+                uint64_t pos = (uint64_t)sa[r];
+                if (pos == 0)
+                {
+                    idx->primary = r;
+                    bwt[r] = 0;
+                }
+                else
+                {
+                    bwt[r] = sections[0][pos - 1];
+                    running[bwt[r]]++;
+                }
+
+                if (pos % idx->sample_rate == 0)
+                {
+                    bits[r >> 6] |= (uint64_t)1 << (r & 63);
+                    samples[sampled++] = pos;
+                }
+            }
+
+            uint64_t total = 0;
+            for (uint64_t w = 0; w < (rows + 63) / 64; ++w)
+            {
+                rank[w] = total;
+                total += cstr_popcount64(bits[w]);
+            }
+        }
+
+        // counts[c]: row 0 is the empty suffix, then suffixes grouped by first byte
+        uint64_t histogram[256] = { 0 };
+        for (uint64_t i = 0; i < n; ++i)
+            histogram[sections[0][i]]++;
+        idx->counts[0] = 1;
+        for (int c = 0; c < 256; ++c)
+            idx->counts[c + 1] = idx->counts[c] + histogram[c];
+
+        if (!(flags & CSTR_INDEX_SA))
+            free(sa);
+
+        cstr_index_bind(idx, sections);
+
+        return true;
+    }
+
+    /**
+     * @brief Build index over a CString
+     * @param idx   Destination CStringIndex
+     * @param obj   Source CString (contents are copied)
+     * @param flags CSTR_INDEX_SA and/or CSTR_INDEX_FM
+     * @return true on success
+     */
+    bool cstr_index_create(_Out_ CStringIndex* idx, _In_ CString* obj, _In_ unsigned flags)
+    {
+        if (!idx || !obj)
+            return false;
+
+        cstr_lock(obj);
+
+        bool out = cstr_index_create_from_buffer(idx, (const uint8_t*)obj->data, obj->length, flags);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Count occurrences of byte c in BWT rows [0, row)
+     */
+    CSTR_INLINE uint64_t cstr_index_occ(_In_ const CStringIndex* idx, _In_ uint8_t c, _In_ uint64_t row)
+    {
+        uint64_t count = idx->occ_super[(row >> CSTR_INDEX_SUPER_SHIFT) * 256 + c] + idx->occ_block[(row >> CSTR_INDEX_BLOCK_SHIFT) * 256 + c];
+        uint64_t from = row & ~(uint64_t)((1u << CSTR_INDEX_BLOCK_SHIFT) - 1);
+        uint64_t i = from;
+
+#ifdef CSTR_HAVE_SSE2
+        __m128i needle = _mm_set1_epi8((char)c);
+        for (; i + 16 <= row; i += 16)
+        {
+            __m128i chunk = _mm_loadu_si128((const __m128i*)(idx->bwt + i));
+            count += cstr_popcount64((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+        }
+#endif
+        for (; i < row; ++i)
+            count += idx->bwt[i] == c;
+
+        // The sentinel row stores 0 but is not a character
+        if (c == 0 && idx->primary >= from && idx->primary < row)
+            count--;
+
+        return count;
+    }
+
+    /**
+     * @brief Compare suffix at pos with pattern, limited to pattern length
+     */
+    CSTR_INLINE int cstr_index_compare_suffix(_In_ const CStringIndex* idx, _In_ uint64_t pos, _In_reads_(length) const uint8_t* pattern, _In_ size_t length)
+    {
+        uint64_t avail = idx->n - pos;
+        size_t common = avail < length ? (size_t)avail : length;
+        int cmp = common ? memcmp(idx->text + pos, pattern, common) : 0;
+
+        if (cmp != 0)
+            return cmp;
+
+        return avail < length ? -1 : 0;
+    }
+
+    /**
+     * @brief Suffix array row range [*first, *last) of suffixes starting with pattern
+     */
+    CSTR_INLINE void cstr_index_range(_In_ const CStringIndex* idx, _In_reads_(length) const uint8_t* pattern, _In_ size_t length, _Out_ uint64_t* first, _Out_ uint64_t* last)
+    {
+        if (idx->flags & CSTR_INDEX_FM)
+        {
+            // Backward search: O(length)
+            uint64_t sp = 0;
+            uint64_t ep = idx->n + 1;
+            for (size_t k = length; k-- > 0 && sp < ep;)
+            {
+                uint8_t c = pattern[k];
+                sp = idx->counts[c] + cstr_index_occ(idx, c, sp);
+                ep = idx->counts[c] + cstr_index_occ(idx, c, ep);
+            }
+            *first = sp;
+            *last = sp < ep ? ep : sp;
+            return;
+        }
+
+        // Binary search: O(length * log n)
+        uint64_t lo = 0;
+        uint64_t hi = idx->n + 1;
+        while (lo < hi)
+        {
+            uint64_t mid = lo + (hi - lo) / 2;
+            if (cstr_index_compare_suffix(idx, idx->sa[mid], pattern, length) < 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        *first = lo;
+
+        hi = idx->n + 1;
+        while (lo < hi)
+        {
+            uint64_t mid = lo + (hi - lo) / 2;
+            if (cstr_index_compare_suffix(idx, idx->sa[mid], pattern, length) <= 0)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        *last = lo;
+    }
+
+    /**
+     * @brief Text position of suffix array row
+     */
+    CSTR_INLINE uint64_t cstr_index_locate(_In_ const CStringIndex* idx, _In_ uint64_t row)
+    {
+        if (idx->sa)
+            return idx->sa[row];
+
+        // Walk LF until a sampled row
+        uint64_t steps = 0;
+        for (;;)
+        {
+            uint64_t word = idx->sample_bits[row >> 6];
+            uint64_t bit = (uint64_t)1 << (row & 63);
+            if (word & bit)
+                return idx->samples[idx->sample_rank[row >> 6] + cstr_popcount64(word & (bit - 1))] + steps;
+
+            uint8_t c = idx->bwt[row];
+            row = idx->counts[c] + cstr_index_occ(idx, c, row);
+            steps++;
+        }
+    }
+
+    /**
+     * @brief Count occurrences of pattern
+     * @param idx     CStringIndex object
+     * @param pattern Pattern bytes
+     * @param length  Pattern length
+     * @return Number of (possibly overlapping) occurrences
+     */
+    size_t cstr_index_count(_In_ const CStringIndex* idx, _In_reads_(length) const char* pattern, _In_ size_t length)
+    {
+        if (!idx || !idx->text || (!pattern && length))
+            return 0;
+
+        uint64_t first, last;
+        cstr_index_range(idx, (const uint8_t*)pattern, length, &first, &last);
+
+        return (size_t)(last - first);
+    }
+
+    /**
+     * @brief Find first occurrence of pattern
+     * @param idx     CStringIndex object
+     * @param pattern Pattern bytes
+     * @param length  Pattern length
+     * @return Smallest starting index or CSTR_INVALID
+     * @note Locates each match when there are at most CSTR_INDEX_FIND_LOCATE.
+     *       With more, the leftmost one is found sooner by scanning the text,
+     *       which stops at the first hit
+     */
+    size_t cstr_index_find(_In_ const CStringIndex* idx, _In_reads_(length) const char* pattern, _In_ size_t length)
+    {
+        if (!idx || !idx->text || (!pattern && length))
+            return cstr_invalid;
+
+        uint64_t first, last;
+        cstr_index_range(idx, (const uint8_t*)pattern, length, &first, &last);
+
+        if (last - first > CSTR_INDEX_FIND_LOCATE)
+        {
+            CStringView text = { (const char*)idx->text, (size_t)idx->n };
+            CStringView needle = { pattern, length };
+
+            return cstr_view_find(text, needle);
+        }
+
+        uint64_t best = (uint64_t)cstr_invalid;
+        for (uint64_t row = first; row < last; ++row)
+        {
+            uint64_t pos = cstr_index_locate(idx, row);
+            if (pos < best)
+                best = pos;
+        }
+
+        return (size_t)best;
+    }
+
+    /**
+     * @brief Find all occurrences of pattern
+     * @param idx       CStringIndex object
+     * @param pattern   Pattern bytes
+     * @param length    Pattern length
+     * @param positions Output positions (may be NULL to only count)
+     * @param max       Capacity of positions
+     * @return Total number of occurrences (may exceed max)
+     * @note Positions are in suffix order, not text order
+     */
+    size_t cstr_index_find_all(_In_ const CStringIndex* idx, _In_reads_(length) const char* pattern, _In_ size_t length, _Out_writes_opt_(max) size_t* positions, _In_ size_t max)
+    {
+        if (!idx || !idx->text || (!pattern && length))
+            return 0;
+
+        uint64_t first, last;
+        cstr_index_range(idx, (const uint8_t*)pattern, length, &first, &last);
+
+        if (positions)
+        {
+            for (uint64_t row = first; row < last && row - first < max; ++row)
+                positions[row - first] = (size_t)cstr_index_locate(idx, row);
+        }
+
+        return (size_t)(last - first);
+    }
+
+    /**
+     * @brief Write buffer in chunks WriteFile can take
+     */
+    CSTR_INLINE bool cstr_index_write(_In_ HANDLE file, _In_reads_bytes_(size) const void* data, _In_ uint64_t size)
+    {
+        const uint8_t* p = (const uint8_t*)data;
+
+        while (size)
+        {
+            DWORD chunk = size > 0x40000000 ? 0x40000000 : (DWORD)size;
+            DWORD written = 0;
+            if (!WriteFile(file, p, chunk, &written, NULL) || written != chunk)
+                return false;
+            p += chunk;
+            size -= chunk;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Save index to file
+     * @param idx  CStringIndex object
+     * @param path Destination file path
+     * @return true on success
+     */
+    bool cstr_index_save(_In_ const CStringIndex* idx, _In_ const char* path)
+    {
+        if (!idx || !idx->text || !path)
+            return false;
+
+        CStringIndexHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, "CSTRIDX1", 8);
+        header.n = idx->n;
+        header.flags = idx->flags;
+        header.primary = idx->primary;
+        header.sample_rate = idx->sample_rate;
+        memcpy(header.counts, idx->counts, sizeof(header.counts));
+
+        uint64_t sizes[8];
+        cstr_index_section_sizes(idx->n, idx->flags, idx->sample_rate, sizes);
+
+        uint64_t offset = sizeof(header);
+        for (int i = 0; i < 8; ++i)
+        {
+            header.offsets[i] = offset;
+            offset += (sizes[i] + 7) & ~(uint64_t)7;
+        }
+
+        const void* sections[8] = { idx->text, idx->sa, idx->bwt, idx->occ_super, idx->occ_block, idx->sample_bits, idx->sample_rank, idx->samples };
+
+        HANDLE file = CreateFileA(path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        static const uint8_t padding[8] = { 0 };
+        bool ok = cstr_index_write(file, &header, sizeof(header));
+        for (int i = 0; i < 8 && ok; ++i)
+        {
+            ok = cstr_index_write(file, sections[i], sizes[i]);
+            if (ok && (sizes[i] & 7))
+                ok = cstr_index_write(file, padding, 8 - (sizes[i] & 7));
+        }
+
+        CloseHandle(file);
+
+        return ok;
+    }
+
+    /**
+     * @brief Load index by memory-mapping a saved file
+     * @param idx  Destination CStringIndex
+     * @param path Saved index path
+     * @return true on success, false on I/O error or invalid file
+     * @note No rebuild or copy; pages are loaded on demand
+     * @note The header and section layout are validated; section contents are
+     *       trusted, so only load files written by cstr_index_save()
+     */
+    bool cstr_index_load(_Out_ CStringIndex* idx, _In_ const char* path)
+    {
+        if (!idx || !path)
+            return false;
+
+        cstr_index_init(idx);
+
+        idx->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (idx->file == INVALID_HANDLE_VALUE)
+        {
+            idx->file = NULL;
+            return false;
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(idx->file, &file_size) || (uint64_t)file_size.QuadPart < sizeof(CStringIndexHeader))
+        {
+            cstr_index_destroy(idx);
+            return false;
+        }
+
+        idx->mapping = CreateFileMappingA(idx->file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!idx->mapping)
+        {
+            cstr_index_destroy(idx);
+            return false;
+        }
+
+        idx->view = MapViewOfFile(idx->mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!idx->view)
+        {
+            cstr_index_destroy(idx);
+            return false;
+        }
+
+        const CStringIndexHeader* header = (const CStringIndexHeader*)idx->view;
+        uint64_t size = (uint64_t)file_size.QuadPart;
+        uint64_t flags = header->flags;
+
+        // Every text byte costs one byte of text plus 8 of suffix array and/or 1 of BWT,
+        // so n is bounded by the file size and the section sizes below cannot overflow
+        uint64_t per_byte = 1 + ((flags & CSTR_INDEX_SA) ? sizeof(uint64_t) : 0) + ((flags & CSTR_INDEX_FM) ? 1 : 0);
+
+        bool ok = memcmp(header->magic, "CSTRIDX1", 8) == 0 && header->sample_rate != 0 &&
+            (flags & (CSTR_INDEX_SA | CSTR_INDEX_FM)) && !(flags & ~(uint64_t)(CSTR_INDEX_SA | CSTR_INDEX_FM)) &&
+            header->n < size / per_byte && header->primary <= header->n &&
+            header->counts[0] == 1 && header->counts[256] == header->n + 1;
+
+        for (int c = 0; c < 256 && ok; ++c)
+            ok = header->counts[c] <= header->counts[c + 1];
+
+        if (!ok)
+        {
+            cstr_index_destroy(idx);
+            return false;
+        }
+
+        uint64_t sizes[8];
+        cstr_index_section_sizes(header->n, flags, header->sample_rate, sizes);
+
+        uint8_t* sections[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            uint64_t offset = header->offsets[i];
+            if (offset > size || sizes[i] > size - offset || (sizes[i] && ((offset & 7) || offset < sizeof(CStringIndexHeader))))
+            {
+                cstr_index_destroy(idx);
+                return false;
+            }
+            sections[i] = sizes[i] ? (uint8_t*)idx->view + header->offsets[i] : NULL;
+        }
+
+        idx->n = header->n;
+        idx->flags = flags;
+        idx->primary = header->primary;
+        idx->sample_rate = header->sample_rate;
+        memcpy(idx->counts, header->counts, sizeof(idx->counts));
+
+        cstr_index_bind(idx, sections);
+
+        return true;
+    }
+
+#endif // CSTR_IMPLEMENT_INDEX
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_INDEX_H
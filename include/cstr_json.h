@@ -0,0 +1,364 @@
+#pragma once
+
+/**
+ * @file cstr_json.h
+ * @brief JSON string escaping and unescaping for CString.
+ *
+ * Both directions scan 16 bytes at a time for the bytes JSON treats
+ * specially ('"', '\\' and control characters) and copy clean runs in bulk.
+ * Quotes around the string are left to the caller.
+ */
+
+#ifndef CSTR_JSON_H
+#define CSTR_JSON_H
+
+#include "cstr.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    CSTR_API bool cstr_append_json_escaped(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size);
+    CSTR_API bool cstr_append_json_escaped_cstr(_In_ CString* obj, _In_ CString* obj2);
+    CSTR_API bool cstr_json_unescape(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_JSON)
+
+    /**
+     * @brief Find the first byte that needs JSON escaping
+     * @param data Input bytes
+     * @param size Input length
+     * @return Offset of first '"', '\\' or control byte, or size if none
+     */
+    CSTR_INLINE size_t cstr_json_scan(_In_reads_(size) const char* data, _In_ size_t size)
+    {
+        const uint8_t* in = (const uint8_t*)data;
+        size_t i = 0;
+
+#ifdef CSTR_HAVE_SSE2
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i backslash = _mm_set1_epi8('\\');
+        const __m128i control = _mm_set1_epi8(0x1f);
+
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+            __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash));
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(_mm_min_epu8(v, control), v));
+
+            int mask = _mm_movemask_epi8(hit);
+            if (mask)
+                return i + cstr_ctz32((uint32_t)mask);
+        }
+#endif
+
+        for (; i < size; ++i)
+        {
+            if (in[i] == '"' || in[i] == '\\' || in[i] < 0x20)
+                return i;
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Length of the JSON escape sequence for a special byte
+     */
+    CSTR_INLINE size_t cstr_json_escape_length(_In_ uint8_t c)
+    {
+        switch (c)
+        {
+        case '"':
+        case '\\':
+        case '\b':
+        case '\f':
+        case '\n':
+        case '\r':
+        case '\t':
+            return 2;
+        default:
+            return 6;
+        }
+    }
+
+    /**
+     * @brief Append JSON-escaped text
+     * @param obj  Destination CString
+     * @param data Raw bytes (UTF-8 passes through unchanged)
+     * @param size Input length
+     * @return true on success, false on allocation failure
+     * @note Control bytes without a short form are written as \u00XX
+     */
+    bool cstr_append_json_escaped(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size)
+    {
+        if (!obj || (!data && size))
+            return false;
+
+        if (size > cstr_invalid / 6)
+            return false;
+
+        // Sizing pass: the escaped length is known before anything is written
+        size_t escaped = size;
+        for (size_t i = 0; (i += cstr_json_scan(data + i, size - i)) < size; ++i)
+            escaped += cstr_json_escape_length((uint8_t)data[i]) - 1;
+
+        cstr_lock(obj);
+
+        if (escaped > cstr_invalid - 1 - obj->length || !cstr_reserve(obj, obj->length + escaped))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        static const char digits[] = "0123456789abcdef";
+        char* out = obj->data + obj->length;
+        size_t i = 0;
+
+        while (i < size)
+        {
+            size_t run = cstr_json_scan(data + i, size - i);
+            memcpy(out, data + i, run);
+            out += run;
+            i += run;
+
+            if (i == size)
+                break;
+
+            uint8_t c = (uint8_t)data[i++];
+            *out++ = '\\';
+
+            switch (c)
+            {
+            case '"':
+                *out++ = '"';
+                break;
+            case '\\':
+                *out++ = '\\';
+                break;
+            case '\b':
+                *out++ = 'b';
+                break;
+            case '\f':
+                *out++ = 'f';
+                break;
+            case '\n':
+                *out++ = 'n';
+                break;
+            case '\r':
+                *out++ = 'r';
+                break;
+            case '\t':
+                *out++ = 't';
+                break;
+            default:
+                *out++ = 'u';
+                *out++ = '0';
+                *out++ = '0';
+                *out++ = digits[c >> 4];
+                *out++ = digits[c & 15];
+                break;
+            }
+        }
+
+        obj->length += escaped;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Append JSON-escaped copy of another CString
+     * @param obj  Destination CString
+     * @param obj2 Source CString
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_append_json_escaped_cstr(_In_ CString* obj, _In_ CString* obj2)
+    {
+        if (!obj || !obj2)
+            return false;
+
+        if (obj == obj2)
+        {
+            CString copy;
+            if (!cstr_create_from_cstr(&copy, obj2))
+                return false;
+
+            bool result = cstr_append_json_escaped(obj, copy.data, copy.length);
+            cstr_destroy(&copy);
+            return result;
+        }
+
+        cstr_lock(obj2);
+        bool result = cstr_append_json_escaped(obj, obj2->data, obj2->length);
+        cstr_unlock(obj2);
+
+        return result;
+    }
+
+    /**
+     * @brief Parse four hex digits of a \u escape
+     * @return Code unit, or CSTR_INVALID on a non-hex digit
+     */
+    CSTR_INLINE size_t cstr_json_hex4(_In_reads_(4) const char* data)
+    {
+        size_t value = 0;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            uint8_t c = (uint8_t)data[i];
+            value <<= 4;
+
+            if (c >= '0' && c <= '9')
+                value |= c - '0';
+            else if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+                value |= (c | 0x20) - 'a' + 10;
+            else
+                return cstr_invalid;
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief Append text decoded from a JSON string body
+     * @param obj  Destination CString
+     * @param data Escaped text without the surrounding quotes
+     * @param size Input length
+     * @return true on success, false on malformed input or allocation failure
+     * @note \uXXXX escapes (including surrogate pairs) are written as UTF-8.
+     *       Raw control bytes, bare '"', unknown escapes and unpaired
+     *       surrogates are rejected. On failure the destination is unchanged.
+     */
+    bool cstr_json_unescape(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size)
+    {
+        if (!obj || (!data && size))
+            return false;
+
+        cstr_lock(obj);
+
+        // Every escape is at least as long as what it decodes to
+        if (!cstr_reserve(obj, obj->length + size))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        char* start = obj->data + obj->length;
+        char* out = start;
+        size_t i = 0;
+
+        while (i < size)
+        {
+            size_t run = cstr_json_scan(data + i, size - i);
+            memcpy(out, data + i, run);
+            out += run;
+            i += run;
+
+            if (i == size)
+                break;
+
+            if (data[i] != '\\' || i + 1 == size)
+                goto fail;
+
+            char c = data[i + 1];
+            i += 2;
+
+            switch (c)
+            {
+            case '"':
+            case '\\':
+            case '/':
+                *out++ = c;
+                continue;
+            case 'b':
+                *out++ = '\b';
+                continue;
+            case 'f':
+                *out++ = '\f';
+                continue;
+            case 'n':
+                *out++ = '\n';
+                continue;
+            case 'r':
+                *out++ = '\r';
+                continue;
+            case 't':
+                *out++ = '\t';
+                continue;
+            case 'u':
+                break;
+            default:
+                goto fail;
+            }
+
+            if (size - i < 4)
+                goto fail;
+
+            size_t cp = cstr_json_hex4(data + i);
+            if (cp == cstr_invalid)
+                goto fail;
+            i += 4;
+
+            if (cp >= 0xDC00 && cp <= 0xDFFF)
+                goto fail;
+
+            if (cp >= 0xD800 && cp <= 0xDBFF)
+            {
+                if (size - i < 6 || data[i] != '\\' || data[i + 1] != 'u')
+                    goto fail;
+
+                size_t low = cstr_json_hex4(data + i + 2);
+                if (low == cstr_invalid || low < 0xDC00 || low > 0xDFFF)
+                    goto fail;
+                i += 6;
+
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+            }
+
+            if (cp < 0x80)
+            {
+                *out++ = (char)cp;
+            }
+            else if (cp < 0x800)
+            {
+                *out++ = (char)(0xC0 | (cp >> 6));
+                *out++ = (char)(0x80 | (cp & 0x3F));
+            }
+            else if (cp < 0x10000)
+            {
+                *out++ = (char)(0xE0 | (cp >> 12));
+                *out++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = (char)(0x80 | (cp & 0x3F));
+            }
+            else
+            {
+                *out++ = (char)(0xF0 | (cp >> 18));
+                *out++ = (char)(0x80 | ((cp >> 12) & 0x3F));
+                *out++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = (char)(0x80 | (cp & 0x3F));
+            }
+        }
+
+        obj->length += (size_t)(out - start);
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+
+    fail:
+        obj->data[obj->length] = '\0';
+        cstr_unlock(obj);
+        return false;
+    }
+
+#endif // CSTR_IMPLEMENT_JSON
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_JSON_H
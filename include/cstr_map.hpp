@@ -0,0 +1,527 @@
+#pragma once
+
+/**
+ * @file cstr_map.hpp
+ * @brief Flat open-addressing hash map keyed by cstr::String.
+ *
+ * Layout follows the SwissTable design. Slots form groups of 16, and each
+ * slot has one control byte: empty, deleted, or 7 bits of the key's hash.
+ * A probe compares a whole group of control bytes at once (SSE2), then
+ * checks the stored 64-bit hash and the length before comparing bytes.
+ * Lookups take any string-like key and never allocate. Rehashing reuses
+ * the stored hashes, so keys are never hashed twice.
+ */
+
+#ifndef CSTR_MAP_HPP
+#define CSTR_MAP_HPP
+
+#include "cstr.hpp"
+
+#include <cstring>
+#include <memory>
+#include <utility>
+
+namespace cstr
+{
+    /**
+     * @class flat_map
+     * @brief Hash map from cstr::String to Value with open addressing
+     * @tparam Value Mapped type
+     *
+     * Inserting or erasing invalidates iterators and pointers to values,
+     * as in std::vector. Maximum load factor is 7/8.
+     */
+    template <class Value>
+    class flat_map
+    {
+    public:
+        /**
+         * @brief Stored key/value pair (the key must not be modified)
+         */
+        struct entry
+        {
+            String key;     ///< Owned key
+            Value value;    ///< Mapped value
+        };
+
+        template <bool Const>
+        class basic_iterator
+        {
+            using map_type = std::conditional_t<Const, const flat_map, flat_map>;
+
+        public:
+            using value_type = entry;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<Const, const entry&, entry&>;
+            using pointer = std::conditional_t<Const, const entry*, entry*>;
+            using iterator_category = std::forward_iterator_tag;
+
+            basic_iterator() noexcept = default;
+
+            reference operator*() const noexcept
+            {
+                return map_->slots_[index_];
+            }
+
+            pointer operator->() const noexcept
+            {
+                return &map_->slots_[index_];
+            }
+
+            basic_iterator& operator++() noexcept
+            {
+                ++index_;
+                skip();
+                return *this;
+            }
+
+            basic_iterator operator++(int) noexcept
+            {
+                basic_iterator old = *this;
+                ++*this;
+                return old;
+            }
+
+            friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept
+            {
+                return a.index_ == b.index_;
+            }
+
+            friend bool operator!=(const basic_iterator& a, const basic_iterator& b) noexcept
+            {
+                return a.index_ != b.index_;
+            }
+
+        private:
+            friend class flat_map;
+
+            basic_iterator(map_type* map, size_t index) noexcept
+                : map_(map), index_(index)
+            {
+                skip();
+            }
+
+            void skip() noexcept
+            {
+                while (index_ < map_->capacity_ && map_->ctrl_[index_] < 0)
+                    ++index_;
+            }
+
+            map_type* map_ = nullptr;  ///< Iterated map
+            size_t index_ = 0;         ///< Current slot
+        };
+
+        using iterator = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        flat_map() noexcept = default;
+
+        flat_map(const flat_map& other)
+        {
+            reserve(other.size_);
+            for (const entry& item : other)
+                try_emplace(item.key.view(), item.value);
+        }
+
+        flat_map(flat_map&& other) noexcept
+        {
+            swap(other);
+        }
+
+        flat_map& operator=(const flat_map& other)
+        {
+            if (this != &other)
+            {
+                flat_map copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        flat_map& operator=(flat_map&& other) noexcept
+        {
+            if (this != &other)
+            {
+                flat_map empty;
+                swap(empty);
+                swap(other);
+            }
+            return *this;
+        }
+
+        ~flat_map()
+        {
+            release();
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        /**
+         * @brief Number of slots (a multiple of the group size)
+         */
+        size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(this, 0);
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(this, capacity_);
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator(this, capacity_);
+        }
+
+        /**
+         * @brief Find a value by any string-like key (no allocation)
+         * @return Pointer to the value, or nullptr if absent
+         */
+        Value* find(std::string_view key) noexcept
+        {
+            size_t index = lookup(key, hash_key(key));
+            return index == cstr_invalid ? nullptr : &slots_[index].value;
+        }
+
+        const Value* find(std::string_view key) const noexcept
+        {
+            size_t index = lookup(key, hash_key(key));
+            return index == cstr_invalid ? nullptr : &slots_[index].value;
+        }
+
+        bool contains(std::string_view key) const noexcept
+        {
+            return find(key) != nullptr;
+        }
+
+        /**
+         * @brief Insert key with a value built from args unless it is present
+         * @return Pointer to the value and whether it was inserted
+         * @note The key is copied into a cstr::String only on insertion
+         */
+        template <class... Args>
+        std::pair<Value*, bool> try_emplace(std::string_view key, Args&&... args)
+        {
+            uint64_t hash = hash_key(key);
+
+            size_t index = lookup(key, hash);
+            if (index != cstr_invalid)
+                return { &slots_[index].value, false };
+
+            index = prepare_insert(hash);
+            ::new (static_cast<void*>(&slots_[index])) entry{ String(key), Value(std::forward<Args>(args)...) };
+            commit_insert(index, hash);
+
+            return { &slots_[index].value, true };
+        }
+
+        /**
+         * @brief Insert or overwrite
+         * @return true if the key was inserted, false if assigned
+         */
+        template <class V>
+        bool insert_or_assign(std::string_view key, V&& value)
+        {
+            std::pair<Value*, bool> out = try_emplace(key, std::forward<V>(value));
+            if (!out.second)
+                *out.first = std::forward<V>(value);
+            return out.second;
+        }
+
+        /**
+         * @brief Value for key, default-constructed on first access
+         */
+        Value& operator[](std::string_view key)
+        {
+            return *try_emplace(key).first;
+        }
+
+        /**
+         * @brief Remove key
+         * @return true if the key was present
+         */
+        bool erase(std::string_view key) noexcept
+        {
+            size_t index = lookup(key, hash_key(key));
+            if (index == cstr_invalid)
+                return false;
+
+            slots_[index].~entry();
+            --size_;
+
+            // A group with an empty slot ends every probe through it, so the slot can be empty again
+            if (match_empty(ctrl_ + (index & ~(group_size - 1))))
+            {
+                ctrl_[index] = ctrl_empty;
+                ++growth_left_;
+            }
+            else
+            {
+                ctrl_[index] = ctrl_deleted;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Remove all entries, keeping the slots
+         */
+        void clear() noexcept
+        {
+            destroy_entries();
+            if (capacity_)
+                std::memset(ctrl_, (unsigned char)ctrl_empty, capacity_);
+            size_ = 0;
+            growth_left_ = max_load(capacity_);
+        }
+
+        /**
+         * @brief Make room for count entries without rehashing
+         */
+        void reserve(size_t count)
+        {
+            size_t capacity = group_size;
+            while (max_load(capacity) < count)
+                capacity *= 2;
+
+            if (capacity > capacity_)
+                rehash(capacity);
+        }
+
+        void swap(flat_map& other) noexcept
+        {
+            std::swap(ctrl_, other.ctrl_);
+            std::swap(hashes_, other.hashes_);
+            std::swap(slots_, other.slots_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(size_, other.size_);
+            std::swap(growth_left_, other.growth_left_);
+        }
+
+    private:
+        static constexpr size_t group_size = 16;
+        static constexpr int8_t ctrl_empty = -128;   ///< Never used since the last rehash
+        static constexpr int8_t ctrl_deleted = -2;   ///< Tombstone; probes continue past it
+
+        static size_t max_load(size_t capacity) noexcept
+        {
+            return capacity - capacity / 8;
+        }
+
+        static uint64_t hash_key(std::string_view key) noexcept
+        {
+            return cstr_view_hash(CStringView{ key.data(), key.size() });
+        }
+
+        static int8_t h2(uint64_t hash) noexcept
+        {
+            return (int8_t)(hash & 0x7F);
+        }
+
+        /**
+         * @brief Bit per slot of a group whose control byte equals value
+         */
+        static uint32_t match_byte(const int8_t* group, int8_t value) noexcept
+        {
+#ifdef CSTR_HAVE_SSE2
+            __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+            return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#else
+            uint32_t mask = 0;
+            for (size_t i = 0; i < group_size; ++i)
+                mask |= (uint32_t)(group[i] == value) << i;
+            return mask;
+#endif
+        }
+
+        static uint32_t match_empty(const int8_t* group) noexcept
+        {
+            return match_byte(group, ctrl_empty);
+        }
+
+        /**
+         * @brief Bit per empty or deleted slot (control bytes with the sign bit set)
+         */
+        static uint32_t match_free(const int8_t* group) noexcept
+        {
+#ifdef CSTR_HAVE_SSE2
+            return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+#else
+            uint32_t mask = 0;
+            for (size_t i = 0; i < group_size; ++i)
+                mask |= (uint32_t)(group[i] < 0) << i;
+            return mask;
+#endif
+        }
+
+        /**
+         * @brief Slot index of key, or CSTR_INVALID
+         * @note Groups are visited in triangular order, which covers all of them
+         */
+        size_t lookup(std::string_view key, uint64_t hash) const noexcept
+        {
+            if (!capacity_)
+                return cstr_invalid;
+
+            size_t group_mask = capacity_ / group_size - 1;
+            size_t group = (size_t)(hash >> 7) & group_mask;
+
+            for (size_t step = 1;; ++step)
+            {
+                const int8_t* ctrl = ctrl_ + group * group_size;
+
+                for (uint32_t mask = match_byte(ctrl, h2(hash)); mask; mask &= mask - 1)
+                {
+                    size_t index = group * group_size + cstr_ctz32(mask);
+                    const String& candidate = slots_[index].key;
+
+                    if (hashes_[index] == hash && candidate.size() == key.size() &&
+                        std::memcmp(candidate.data(), key.data(), key.size()) == 0)
+                        return index;
+                }
+
+                if (match_empty(ctrl))
+                    return cstr_invalid;
+
+                group = (group + step) & group_mask;
+            }
+        }
+
+        /**
+         * @brief First empty or deleted slot on the probe sequence of hash
+         */
+        size_t find_free(uint64_t hash) const noexcept
+        {
+            size_t group_mask = capacity_ / group_size - 1;
+            size_t group = (size_t)(hash >> 7) & group_mask;
+
+            for (size_t step = 1;; ++step)
+            {
+                uint32_t mask = match_free(ctrl_ + group * group_size);
+                if (mask)
+                    return group * group_size + cstr_ctz32(mask);
+
+                group = (group + step) & group_mask;
+            }
+        }
+
+        /**
+         * @brief Slot for a new key, growing or purging tombstones when full
+         */
+        size_t prepare_insert(uint64_t hash)
+        {
+            if (capacity_)
+            {
+                size_t index = find_free(hash);
+                if (growth_left_ || ctrl_[index] == ctrl_deleted)
+                    return index;
+            }
+
+            // Mostly tombstones: rehash in place, otherwise double
+            if (capacity_ && size_ < max_load(capacity_) / 2)
+                rehash(capacity_);
+            else
+                rehash(capacity_ ? capacity_ * 2 : group_size);
+
+            return find_free(hash);
+        }
+
+        void commit_insert(size_t index, uint64_t hash) noexcept
+        {
+            if (ctrl_[index] == ctrl_empty)
+                --growth_left_;
+
+            ctrl_[index] = h2(hash);
+            hashes_[index] = hash;
+            ++size_;
+        }
+
+        /**
+         * @brief Move all entries into a table of the given capacity
+         * @note Uses the stored hashes; String moves never throw
+         */
+        void rehash(size_t capacity)
+        {
+            std::unique_ptr<int8_t[]> ctrl(new int8_t[capacity]);
+            std::unique_ptr<uint64_t[]> hashes(new uint64_t[capacity]);
+            entry* slots = std::allocator<entry>().allocate(capacity);
+
+            std::memset(ctrl.get(), (unsigned char)ctrl_empty, capacity);
+
+            flat_map fresh;
+            fresh.ctrl_ = ctrl.release();
+            fresh.hashes_ = hashes.release();
+            fresh.slots_ = slots;
+            fresh.capacity_ = capacity;
+            fresh.growth_left_ = max_load(capacity);
+
+            for (size_t i = 0; i < capacity_; ++i)
+            {
+                if (ctrl_[i] < 0)
+                    continue;
+
+                size_t index = fresh.find_free(hashes_[i]);
+                ::new (static_cast<void*>(&fresh.slots_[index])) entry(std::move(slots_[i]));
+                fresh.commit_insert(index, hashes_[i]);
+            }
+
+            swap(fresh);
+        }
+
+        void destroy_entries() noexcept
+        {
+            for (size_t i = 0; i < capacity_; ++i)
+            {
+                if (ctrl_[i] >= 0)
+                    slots_[i].~entry();
+            }
+        }
+
+        void release() noexcept
+        {
+            if (!capacity_)
+                return;
+
+            destroy_entries();
+
+            delete[] ctrl_;
+            delete[] hashes_;
+            std::allocator<entry>().deallocate(slots_, capacity_);
+
+            ctrl_ = nullptr;
+            hashes_ = nullptr;
+            slots_ = nullptr;
+            capacity_ = 0;
+            size_ = 0;
+            growth_left_ = 0;
+        }
+
+        int8_t* ctrl_ = nullptr;      ///< Control byte per slot
+        uint64_t* hashes_ = nullptr;  ///< Full hash per slot
+        entry* slots_ = nullptr;      ///< Entries (constructed where the control byte is >= 0)
+        size_t capacity_ = 0;         ///< Slot count (power of two, multiple of group_size)
+        size_t size_ = 0;             ///< Live entries
+        size_t growth_left_ = 0;      ///< Empty slots that may still be filled before a rehash
+    };
+}
+
+#endif // CSTR_MAP_HPP
@@ -0,0 +1,737 @@
+#pragma once
+
+/**
+ * @file cstr_ngram.h
+ * @brief Trigram inverted index for substring search across many strings.
+ *
+ * Each document's distinct trigrams point to delta/varint-compressed posting
+ * lists. A search intersects the needle's lists (SSE2 block compare) and
+ * verifies the surviving candidates with cstr_view_find().
+ */
+
+#ifndef CSTR_NGRAM_H
+#define CSTR_NGRAM_H
+
+#include "cstr.h"
+#include "cstr_array.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @def CSTR_NGRAM_COMPACT_RATIO
+     * @brief Dead documents (in percent) that trigger automatic compaction
+     */
+#ifndef CSTR_NGRAM_COMPACT_RATIO
+#define CSTR_NGRAM_COMPACT_RATIO 25
+#endif
+
+    /**
+     * @struct CStringPosting
+     * @brief Compressed sorted list of document ids
+     *
+     * @var data     - LEB128 varints of id deltas
+     * @var size     - Used bytes
+     * @var capacity - Allocated bytes
+     * @var count    - Number of ids
+     * @var last     - Last (largest) id
+     */
+    typedef struct
+    {
+        uint8_t* data;        ///< Encoded deltas
+        size_t size;          ///< Used bytes
+        size_t capacity;      ///< Allocated bytes
+        uint32_t count;       ///< Number of ids
+        uint32_t last;        ///< Largest id
+    }CStringPosting;
+
+    /**
+     * @struct CStringNgramIndex
+     * @brief Thread-safe trigram index over a growing set of documents
+     *
+     * @var texts             - Document contents; document id = element index
+     * @var alive             - Bit per document, set while the document is live
+     * @var alive_words       - Allocated words in alive
+     * @var live              - Number of live documents
+     * @var dead_since_compact - Documents removed since the last compaction
+     * @var keys              - Hash table keys (trigram + 1, 0 = empty)
+     * @var slots             - Hash table values (index into postings)
+     * @var table_capacity    - Hash table size (power of two)
+     * @var postings          - Posting lists
+     * @var posting_count     - Number of posting lists (distinct trigrams)
+     * @var posting_capacity  - Allocated posting lists
+     * @var lock              - Recursive lock for thread synchronization
+     */
+    typedef struct
+    {
+        CStringArray texts;           ///< Document contents
+        uint64_t* alive;              ///< Live-document bitmap
+        size_t alive_words;           ///< Bitmap words
+        size_t live;                  ///< Live documents
+        size_t dead_since_compact;    ///< Removals since last compaction
+        uint32_t* keys;               ///< Trigram table keys
+        uint32_t* slots;              ///< Trigram table values
+        size_t table_capacity;        ///< Table size
+        CStringPosting* postings;     ///< Posting lists
+        size_t posting_count;         ///< Posting lists in use
+        size_t posting_capacity;      ///< Allocated posting lists
+        CStringLock lock;             ///< Thread synchronization primitive
+    }CStringNgramIndex;
+
+    /**
+     * @brief Callback for search results
+     * @return true to continue, false to stop
+     */
+    typedef bool (*CStringNgramCallback)(size_t doc, CStringView text, void* ctx);
+
+    CSTR_API bool cstr_ngram_create(_Inout_ CStringNgramIndex* idx);
+    CSTR_API bool cstr_ngram_destroy(_In_ CStringNgramIndex* idx);
+    CSTR_API size_t cstr_ngram_add_buffer(_In_ CStringNgramIndex* idx, _In_reads_(size) const char* data, _In_ size_t size);
+    CSTR_API size_t cstr_ngram_add(_In_ CStringNgramIndex* idx, _In_ CString* obj);
+    CSTR_API bool cstr_ngram_is_alive(_In_ const CStringNgramIndex* idx, _In_ size_t doc);
+    CSTR_API bool cstr_ngram_compact(_In_ CStringNgramIndex* idx);
+    CSTR_API bool cstr_ngram_remove(_In_ CStringNgramIndex* idx, _In_ size_t doc);
+    CSTR_API size_t cstr_ngram_update(_In_ CStringNgramIndex* idx, _In_ size_t doc, _In_ CString* obj);
+    CSTR_API size_t cstr_ngram_search(_In_ CStringNgramIndex* idx, _In_reads_(length) const char* needle, _In_ size_t length, _In_ CStringNgramCallback callback, _In_opt_ void* ctx);
+    CSTR_API size_t cstr_ngram_search_cstr(_In_ CStringNgramIndex* idx, _In_ CString* obj, _In_ CStringNgramCallback callback, _In_opt_ void* ctx);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_NGRAM)
+
+    /**
+     * @brief Initialize a new empty index
+     * @param idx Pointer to CStringNgramIndex object to initialize
+     * @return true on success, false on allocation failure
+     */
+    bool cstr_ngram_create(_Inout_ CStringNgramIndex* idx)
+    {
+        if (!idx)
+            return false;
+
+        memset(idx, 0, sizeof(*idx));
+
+        if (!cstr_array_create(&idx->texts))
+            return false;
+
+        cstr_lock_init(&idx->lock);
+
+        return true;
+    }
+
+    /**
+     * @brief Release posting lists and trigram table
+     */
+    CSTR_INLINE void cstr_ngram_free_postings(_Inout_ CStringNgramIndex* idx)
+    {
+        for (size_t i = 0; i < idx->posting_count; ++i)
+            free(idx->postings[i].data);
+
+        free(idx->postings);
+        free(idx->keys);
+        free(idx->slots);
+
+        idx->postings = NULL;
+        idx->keys = NULL;
+        idx->slots = NULL;
+        idx->posting_count = 0;
+        idx->posting_capacity = 0;
+        idx->table_capacity = 0;
+    }
+
+    /**
+     * @brief Destroy index and release resources
+     * @param idx CStringNgramIndex to destroy
+     * @return true on success
+     */
+    bool cstr_ngram_destroy(_In_ CStringNgramIndex* idx)
+    {
+        if (!idx)
+            return false;
+
+        cstr_ngram_free_postings(idx);
+        cstr_array_destroy(&idx->texts);
+
+        free(idx->alive);
+        idx->alive = NULL;
+        idx->alive_words = 0;
+        idx->live = 0;
+        idx->dead_since_compact = 0;
+
+        return true;
+    }
+
+    /**
+     * @brief Hash table position of trigram key
+     */
+    CSTR_INLINE size_t cstr_ngram_hash(_In_ uint32_t key, _In_ size_t capacity)
+    {
+        return (size_t)((key * 0x9E3779B1u) ^ (key >> 15)) & (capacity - 1);
+    }
+
+    /**
+     * @brief Find posting list of trigram
+     * @return Posting list or NULL if the trigram never occurred
+     */
+    CSTR_INLINE CStringPosting* cstr_ngram_lookup(_In_ CStringNgramIndex* idx, _In_ uint32_t trigram)
+    {
+        if (!idx->table_capacity)
+            return NULL;
+
+        uint32_t key = trigram + 1;
+        for (size_t i = cstr_ngram_hash(key, idx->table_capacity);; i = (i + 1) & (idx->table_capacity - 1))
+        {
+            if (idx->keys[i] == key)
+                return &idx->postings[idx->slots[i]];
+            if (idx->keys[i] == 0)
+                return NULL;
+        }
+    }
+
+    /**
+     * @brief Find or create posting list of trigram
+     * @return Posting list or NULL on allocation failure
+     */
+    CSTR_INLINE CStringPosting* cstr_ngram_posting(_Inout_ CStringNgramIndex* idx, _In_ uint32_t trigram)
+    {
+        // Keep load factor at or below 1/2
+        if ((idx->posting_count + 1) * 2 > idx->table_capacity)
+        {
+            size_t capacity = idx->table_capacity ? idx->table_capacity * 2 : 1024;
+            uint32_t* keys = (uint32_t*)calloc(capacity, sizeof(uint32_t));
+            uint32_t* slots = (uint32_t*)malloc(capacity * sizeof(uint32_t));
+            if (!keys || !slots)
+            {
+                free(keys);
+                free(slots);
+                return NULL;
+            }
+
+            for (size_t i = 0; i < idx->table_capacity; ++i)
+            {
+                if (!idx->keys[i])
+                    continue;
+                size_t j = cstr_ngram_hash(idx->keys[i], capacity);
+                while (keys[j])
+                    j = (j + 1) & (capacity - 1);
+                keys[j] = idx->keys[i];
+                slots[j] = idx->slots[i];
+            }
+
+            free(idx->keys);
+            free(idx->slots);
+            idx->keys = keys;
+            idx->slots = slots;
+            idx->table_capacity = capacity;
+        }
+
+        uint32_t key = trigram + 1;
+        size_t i = cstr_ngram_hash(key, idx->table_capacity);
+        while (idx->keys[i])
+        {
+            if (idx->keys[i] == key)
+                return &idx->postings[idx->slots[i]];
+            i = (i + 1) & (idx->table_capacity - 1);
+        }
+
+        if (idx->posting_count == idx->posting_capacity)
+        {
+            size_t capacity = idx->posting_capacity ? idx->posting_capacity * 2 : 1024;
+            CStringPosting* postings = (CStringPosting*)realloc(idx->postings, capacity * sizeof(CStringPosting));
+            if (!postings)
+                return NULL;
+            idx->postings = postings;
+            idx->posting_capacity = capacity;
+        }
+
+        CStringPosting* posting = &idx->postings[idx->posting_count];
+        memset(posting, 0, sizeof(*posting));
+
+        idx->keys[i] = key;
+        idx->slots[i] = (uint32_t)idx->posting_count++;
+
+        return posting;
+    }
+
+    /**
+     * @brief Append document id to posting list (ids arrive in increasing order)
+     * @return true on success, false on allocation failure
+     */
+    CSTR_INLINE bool cstr_ngram_posting_append(_Inout_ CStringPosting* posting, _In_ uint32_t doc)
+    {
+        // Same trigram seen earlier in this document
+        if (posting->count && posting->last == doc)
+            return true;
+
+        if (posting->size + 5 > posting->capacity)
+        {
+            size_t capacity = posting->capacity ? posting->capacity * 2 : 16;
+            uint8_t* data = (uint8_t*)realloc(posting->data, capacity);
+            if (!data)
+                return false;
+            posting->data = data;
+            posting->capacity = capacity;
+        }
+
+        uint32_t delta = posting->count ? doc - posting->last : doc;
+        while (delta >= 0x80)
+        {
+            posting->data[posting->size++] = (uint8_t)(delta | 0x80);
+            delta >>= 7;
+        }
+        posting->data[posting->size++] = (uint8_t)delta;
+
+        posting->last = doc;
+        posting->count++;
+
+        return true;
+    }
+
+    /**
+     * @brief Decode posting list into sorted id array
+     * @param posting Posting list
+     * @param out     Output array of posting->count ids
+     */
+    CSTR_INLINE void cstr_ngram_posting_decode(_In_ const CStringPosting* posting, _Out_writes_(posting->count) uint32_t* out)
+    {
+        const uint8_t* p = posting->data;
+        uint32_t doc = 0;
+
+        for (uint32_t i = 0; i < posting->count; ++i)
+        {
+            uint32_t delta = 0;
+            unsigned shift = 0;
+            uint8_t byte;
+            do
+            {
+                byte = *p++;
+                delta |= (uint32_t)(byte & 0x7F) << shift;
+                shift += 7;
+            } while (byte & 0x80);
+
+            doc = i ? doc + delta : delta;
+            out[i] = doc;
+        }
+    }
+
+    /**
+     * @brief Intersect sorted id arrays in place
+     * @param a       First array, receives the intersection
+     * @param a_count Number of ids in a
+     * @param b       Second array
+     * @param b_count Number of ids in b
+     * @return Number of ids kept in a
+     * @note a should be the shorter list; b is probed four ids at a time with SSE2
+     */
+    CSTR_INLINE size_t cstr_ngram_intersect(_Inout_updates_(a_count) uint32_t* a, _In_ size_t a_count, _In_reads_(b_count) const uint32_t* b, _In_ size_t b_count)
+    {
+        size_t out = 0;
+        size_t j = 0;
+
+        for (size_t i = 0; i < a_count; ++i)
+        {
+            uint32_t x = a[i];
+
+#ifdef CSTR_HAVE_SSE2
+            while (j + 4 <= b_count && b[j + 3] < x)
+                j += 4;
+
+            if (j + 4 <= b_count)
+            {
+                __m128i block = _mm_loadu_si128((const __m128i*)(b + j));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(block, _mm_set1_epi32((int)x))))
+                    a[out++] = x;
+                continue;
+            }
+#endif
+            while (j < b_count && b[j] < x)
+                j++;
+
+            if (j == b_count)
+                break;
+
+            if (b[j] == x)
+                a[out++] = x;
+        }
+
+        return out;
+    }
+
+    /**
+     * @brief Add document contents to the index
+     * @param idx  CStringNgramIndex object
+     * @param data Document bytes
+     * @param size Document length
+     * @return Document id or CSTR_INVALID on failure
+     */
+    size_t cstr_ngram_add_buffer(_In_ CStringNgramIndex* idx, _In_reads_(size) const char* data, _In_ size_t size)
+    {
+        if (!idx || (!data && size))
+            return cstr_invalid;
+
+        cstr_lock_acquire(&idx->lock);
+
+        size_t doc = idx->texts.count;
+        if (doc >= 0xFFFFFFFFu)
+        {
+            cstr_lock_release(&idx->lock);
+            return cstr_invalid;
+        }
+
+        if ((doc >> 6) >= idx->alive_words)
+        {
+            size_t words = idx->alive_words ? idx->alive_words * 2 : 64;
+            uint64_t* alive = (uint64_t*)realloc(idx->alive, words * sizeof(uint64_t));
+            if (!alive)
+            {
+                cstr_lock_release(&idx->lock);
+                return cstr_invalid;
+            }
+            memset(alive + idx->alive_words, 0, (words - idx->alive_words) * sizeof(uint64_t));
+            idx->alive = alive;
+            idx->alive_words = words;
+        }
+
+        if (!cstr_array_push_buffer(&idx->texts, data, size))
+        {
+            cstr_lock_release(&idx->lock);
+            return cstr_invalid;
+        }
+
+        const uint8_t* bytes = (const uint8_t*)data;
+        for (size_t i = 0; i + 3 <= size; ++i)
+        {
+            uint32_t trigram = ((uint32_t)bytes[i] << 16) | ((uint32_t)bytes[i + 1] << 8) | bytes[i + 2];
+            CStringPosting* posting = cstr_ngram_posting(idx, trigram);
+            if (!posting || !cstr_ngram_posting_append(posting, (uint32_t)doc))
+            {
+                // Leave the document dead; its partial postings are filtered by the bitmap
+                cstr_lock_release(&idx->lock);
+                return cstr_invalid;
+            }
+        }
+
+        idx->alive[doc >> 6] |= (uint64_t)1 << (doc & 63);
+        idx->live++;
+
+        cstr_lock_release(&idx->lock);
+
+        return doc;
+    }
+
+    /**
+     * @brief Add CString to the index
+     * @param idx CStringNgramIndex object
+     * @param obj Document
+     * @return Document id or CSTR_INVALID on failure
+     */
+    size_t cstr_ngram_add(_In_ CStringNgramIndex* idx, _In_ CString* obj)
+    {
+        if (!idx || !obj)
+            return cstr_invalid;
+
+        cstr_lock(obj);
+
+        size_t out = cstr_ngram_add_buffer(idx, obj->data, obj->length);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Check whether document is live
+     */
+    bool cstr_ngram_is_alive(_In_ const CStringNgramIndex* idx, _In_ size_t doc)
+    {
+        return doc < idx->texts.count && (idx->alive[doc >> 6] >> (doc & 63)) & 1;
+    }
+
+    /**
+     * @brief Drop dead documents from postings and text storage
+     * @param idx CStringNgramIndex object
+     * @return true on success, false on allocation failure
+     * @note Document ids of live documents are preserved. Ids are never reused,
+     *       so each dead document keeps an empty element in texts and a bit in
+     *       alive until the index is destroyed; both grow with every add up to
+     *       the 2^32 document id limit
+     */
+    bool cstr_ngram_compact(_In_ CStringNgramIndex* idx)
+    {
+        if (!idx)
+            return false;
+
+        cstr_lock_acquire(&idx->lock);
+
+        CStringArray texts;
+        if (!cstr_array_create(&texts))
+        {
+            cstr_lock_release(&idx->lock);
+            return false;
+        }
+
+        // Dead documents keep their slot as an empty element so ids stay stable
+        for (size_t doc = 0; doc < idx->texts.count; ++doc)
+        {
+            bool ok;
+            if (cstr_ngram_is_alive(idx, doc))
+                ok = cstr_array_push_buffer(&texts, idx->texts.blob + idx->texts.offsets[doc], idx->texts.offsets[doc + 1] - idx->texts.offsets[doc] - 1);
+            else
+                ok = cstr_array_push_buffer(&texts, "", 0);
+
+            if (!ok)
+            {
+                cstr_array_destroy(&texts);
+                cstr_lock_release(&idx->lock);
+                return false;
+            }
+        }
+
+        for (size_t p = 0; p < idx->posting_count; ++p)
+        {
+            CStringPosting* posting = &idx->postings[p];
+            uint32_t* ids = (uint32_t*)malloc((posting->count + 1) * sizeof(uint32_t));
+            if (!ids)
+            {
+                cstr_array_destroy(&texts);
+                cstr_lock_release(&idx->lock);
+                return false;
+            }
+
+            cstr_ngram_posting_decode(posting, ids);
+
+            uint32_t count = posting->count;
+            posting->size = 0;
+            posting->count = 0;
+            for (uint32_t i = 0; i < count; ++i)
+                if (cstr_ngram_is_alive(idx, ids[i]))
+                    cstr_ngram_posting_append(posting, ids[i]);
+
+            free(ids);
+        }
+
+        cstr_array_destroy(&idx->texts);
+        idx->texts = texts;
+        idx->dead_since_compact = 0;
+
+        cstr_lock_release(&idx->lock);
+
+        return true;
+    }
+
+    /**
+     * @brief Remove document from the index
+     * @param idx CStringNgramIndex object
+     * @param doc Document id returned by cstr_ngram_add()
+     * @return true if the document was live
+     * @note Marks the document dead; storage is reclaimed by compaction,
+     *       which runs automatically once CSTR_NGRAM_COMPACT_RATIO percent of
+     *       the documents were removed since the previous compaction
+     */
+    bool cstr_ngram_remove(_In_ CStringNgramIndex* idx, _In_ size_t doc)
+    {
+        if (!idx)
+            return false;
+
+        cstr_lock_acquire(&idx->lock);
+
+        if (!cstr_ngram_is_alive(idx, doc))
+        {
+            cstr_lock_release(&idx->lock);
+            return false;
+        }
+
+        idx->alive[doc >> 6] &= ~((uint64_t)1 << (doc & 63));
+        idx->live--;
+        idx->dead_since_compact++;
+
+        // Count only removals since the last compaction; earlier dead slots are already empty
+        size_t dead = idx->dead_since_compact;
+        if (dead * 100 >= idx->texts.count * CSTR_NGRAM_COMPACT_RATIO && dead >= 1024)
+            cstr_ngram_compact(idx);
+
+        cstr_lock_release(&idx->lock);
+
+        return true;
+    }
+
+    /**
+     * @brief Replace contents of a changed document
+     * @param idx CStringNgramIndex object
+     * @param doc Document id to retire
+     * @param obj New contents
+     * @return New document id or CSTR_INVALID on failure
+     */
+    size_t cstr_ngram_update(_In_ CStringNgramIndex* idx, _In_ size_t doc, _In_ CString* obj)
+    {
+        if (!idx || !obj)
+            return cstr_invalid;
+
+        // Same order as cstr_ngram_add(): document first, then index
+        cstr_lock(obj);
+        cstr_lock_acquire(&idx->lock);
+
+        cstr_ngram_remove(idx, doc);
+        size_t out = cstr_ngram_add_buffer(idx, obj->data, obj->length);
+
+        cstr_lock_release(&idx->lock);
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Find live documents containing needle
+     * @param idx      CStringNgramIndex object
+     * @param needle   Needle bytes
+     * @param length   Needle length
+     * @param callback Called per matching document in id order; return false to stop
+     * @param ctx      User context passed to callback
+     * @return Number of matching documents reported, or CSTR_INVALID on failure
+     * @note Needles shorter than 3 bytes fall back to scanning every document
+     */
+    size_t cstr_ngram_search(_In_ CStringNgramIndex* idx, _In_reads_(length) const char* needle, _In_ size_t length, _In_ CStringNgramCallback callback, _In_opt_ void* ctx)
+    {
+        if (!idx || !callback || (!needle && length))
+            return cstr_invalid;
+
+        CStringView pattern = { needle, length };
+        size_t found = 0;
+
+        cstr_lock_acquire(&idx->lock);
+
+        if (length < 3)
+        {
+            for (size_t doc = 0; doc < idx->texts.count; ++doc)
+            {
+                if (!cstr_ngram_is_alive(idx, doc))
+                    continue;
+
+                CStringView text = { idx->texts.blob + idx->texts.offsets[doc], idx->texts.offsets[doc + 1] - idx->texts.offsets[doc] - 1 };
+                if (cstr_view_find(text, pattern) == cstr_invalid)
+                    continue;
+
+                found++;
+                if (!callback(doc, text, ctx))
+                    break;
+            }
+
+            cstr_lock_release(&idx->lock);
+            return found;
+        }
+
+        // Gather posting lists of the needle's trigrams, shortest first
+        size_t grams = length - 2;
+        CStringPosting** lists = (CStringPosting**)malloc(grams * sizeof(CStringPosting*));
+        if (!lists)
+        {
+            cstr_lock_release(&idx->lock);
+            return cstr_invalid;
+        }
+
+        const uint8_t* bytes = (const uint8_t*)needle;
+        size_t list_count = 0;
+        for (size_t i = 0; i < grams; ++i)
+        {
+            uint32_t trigram = ((uint32_t)bytes[i] << 16) | ((uint32_t)bytes[i + 1] << 8) | bytes[i + 2];
+            CStringPosting* posting = cstr_ngram_lookup(idx, trigram);
+            if (!posting || posting->count == 0)
+            {
+                free(lists);
+                cstr_lock_release(&idx->lock);
+                return 0;
+            }
+
+            bool duplicate = false;
+            for (size_t k = 0; k < list_count && !duplicate; ++k)
+                duplicate = lists[k] == posting;
+            if (!duplicate)
+                lists[list_count++] = posting;
+        }
+
+        for (size_t i = 1; i < list_count; ++i)
+        {
+            CStringPosting* tmp = lists[i];
+            size_t j = i;
+            while (j > 0 && lists[j - 1]->count > tmp->count)
+            {
+                lists[j] = lists[j - 1];
+                j--;
+            }
+            lists[j] = tmp;
+        }
+
+        uint32_t* candidates = (uint32_t*)malloc(lists[0]->count * sizeof(uint32_t));
+        uint32_t* scratch = list_count > 1 ? (uint32_t*)malloc(lists[list_count - 1]->count * sizeof(uint32_t)) : NULL;
+        if (!candidates || (list_count > 1 && !scratch))
+        {
+            free(candidates);
+            free(scratch);
+            free(lists);
+            cstr_lock_release(&idx->lock);
+            return cstr_invalid;
+        }
+
+        cstr_ngram_posting_decode(lists[0], candidates);
+        size_t candidate_count = lists[0]->count;
+
+        for (size_t k = 1; k < list_count && candidate_count; ++k)
+        {
+            cstr_ngram_posting_decode(lists[k], scratch);
+            candidate_count = cstr_ngram_intersect(candidates, candidate_count, scratch, lists[k]->count);
+        }
+
+        // Trigrams only prove a superset; confirm with a real search
+        for (size_t i = 0; i < candidate_count; ++i)
+        {
+            size_t doc = candidates[i];
+            if (!cstr_ngram_is_alive(idx, doc))
+                continue;
+
+            CStringView text = { idx->texts.blob + idx->texts.offsets[doc], idx->texts.offsets[doc + 1] - idx->texts.offsets[doc] - 1 };
+            if (cstr_view_find(text, pattern) == cstr_invalid)
+                continue;
+
+            found++;
+            if (!callback(doc, text, ctx))
+                break;
+        }
+
+        free(scratch);
+        free(candidates);
+        free(lists);
+
+        cstr_lock_release(&idx->lock);
+
+        return found;
+    }
+
+    /**
+     * @brief Find live documents containing a CString
+     * @param idx      CStringNgramIndex object
+     * @param obj      Needle
+     * @param callback Called per matching document; return false to stop
+     * @param ctx      User context passed to callback
+     * @return Number of matching documents reported, or CSTR_INVALID on failure
+     */
+    size_t cstr_ngram_search_cstr(_In_ CStringNgramIndex* idx, _In_ CString* obj, _In_ CStringNgramCallback callback, _In_opt_ void* ctx)
+    {
+        if (!idx || !obj)
+            return cstr_invalid;
+
+        cstr_lock(obj);
+
+        size_t out = cstr_ngram_search(idx, obj->data, obj->length, callback, ctx);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+#endif // CSTR_IMPLEMENT_NGRAM
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_NGRAM_H
@@ -0,0 +1,393 @@
+#pragma once
+
+/**
+ * @file cstr_ranges.hpp
+ * @brief Lazy token ranges and a streaming token generator (C++20).
+ *
+ * cstr::tokens() is a std::ranges::view over the tokens of a character
+ * range. cstr::stream_tokens() is a coroutine that tokenizes input pulled
+ * chunk by chunk. Both yield std::string_view with the delimiter, zone and
+ * escape rules of cstr_tokenize()/cstr_tokenize_ex(). Nothing is allocated
+ * per token, and adaptors such as std::views::take stop the scan early.
+ */
+
+#ifndef CSTR_RANGES_HPP
+#define CSTR_RANGES_HPP
+
+#include "cstr.hpp"
+
+#if (defined(_MSVC_LANG) ? _MSVC_LANG : __cplusplus) < 202002L
+#error "cstr_ranges.hpp requires C++20"
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <istream>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <utility>
+
+namespace cstr
+{
+    /**
+     * @brief Tokenizer using runtime delimiter, zone and escape strings
+     * @note Without zones and escapes the cstr_tokenize() rules apply
+     */
+    struct token_scanner
+    {
+        const char* delimiters = "";        ///< Separator characters
+        const char* zone_pairs = nullptr;   ///< Zone delimiter pairs (e.g. "\"\"''"), or NULL
+        const char* escape_chars = nullptr; ///< Escape characters, or NULL
+
+        bool operator()(const char* data, size_t len, size_t* pos, CStringView* token) const noexcept
+        {
+            if (!zone_pairs && !escape_chars)
+                return cstr_scan_token(data, len, delimiters, pos, token);
+
+            return cstr_scan_token_ex(data, len, delimiters, zone_pairs, escape_chars, pos, token);
+        }
+    };
+
+    /**
+     * @class basic_token_view
+     * @brief Forward range of the tokens of a character range
+     * @tparam Scanner Callable bool(const char* data, size_t len, size_t* pos, CStringView* token)
+     *                 with the contract of cstr_scan_token()
+     *
+     * Tokens are found one at a time when the iterator advances. Views point
+     * into the source text, which must outlive the iteration.
+     */
+    template <class Scanner>
+    class basic_token_view : public std::ranges::view_interface<basic_token_view<Scanner>>
+    {
+    public:
+        class iterator
+        {
+        public:
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+
+            iterator() = default;
+
+            std::string_view operator*() const noexcept
+            {
+                return std::string_view(token_.data, token_.length);
+            }
+
+            iterator& operator++() noexcept
+            {
+                advance();
+                return *this;
+            }
+
+            iterator operator++(int) noexcept
+            {
+                iterator old = *this;
+                advance();
+                return old;
+            }
+
+            friend bool operator==(const iterator& left, const iterator& right) noexcept
+            {
+                return left.token_.data == right.token_.data;
+            }
+
+            friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+            {
+                return it.token_.data == nullptr;
+            }
+
+        private:
+            friend class basic_token_view;
+
+            explicit iterator(const basic_token_view* parent) noexcept
+                : parent_(parent)
+            {
+                advance();
+            }
+
+            void advance() noexcept
+            {
+                if (!parent_->scanner_(parent_->text_.data(), parent_->text_.size(), &next_, &token_))
+                    token_ = CStringView{ nullptr, 0 };
+            }
+
+            const basic_token_view* parent_ = nullptr;  ///< Range being scanned
+            size_t next_ = 0;                           ///< Scan position after the current token
+            CStringView token_{ nullptr, 0 };           ///< Current token (data is nullptr at the end)
+        };
+
+        basic_token_view() = default;
+
+        basic_token_view(std::string_view text, Scanner scanner = Scanner()) noexcept
+            : text_(text), scanner_(scanner)
+        {
+        }
+
+        iterator begin() const noexcept
+        {
+            return iterator(this);
+        }
+
+        std::default_sentinel_t end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+
+    private:
+        std::string_view text_;                 ///< Source characters
+        [[no_unique_address]] Scanner scanner_; ///< Token finder
+    };
+
+    /// Token range over runtime delimiter strings (not copied; must outlive the range)
+    using token_view = basic_token_view<token_scanner>;
+
+    /**
+     * @brief Lazily tokenize characters
+     * @param text         Characters to tokenize
+     * @param delimiters   Separator characters
+     * @param zone_pairs   Zone delimiter pairs (e.g. "\"\"''"), or NULL
+     * @param escape_chars Escape characters, or NULL
+     * @code
+     * for (std::string_view word : cstr::tokens(line, " ,") | std::views::take(3))
+     *     use(word);
+     * @endcode
+     */
+    inline token_view tokens(std::string_view text, const char* delimiters, const char* zone_pairs = nullptr, const char* escape_chars = nullptr) noexcept
+    {
+        return token_view(text, token_scanner{ delimiters, zone_pairs, escape_chars });
+    }
+
+    inline token_view tokens(CStringView text, const char* delimiters, const char* zone_pairs = nullptr, const char* escape_chars = nullptr) noexcept
+    {
+        return token_view(std::string_view(text.data, text.length), token_scanner{ delimiters, zone_pairs, escape_chars });
+    }
+
+    /**
+     * @class token_generator
+     * @brief Single-pass range of tokens produced by a coroutine
+     *
+     * A yielded view stays valid until the generator is resumed again.
+     * Exceptions thrown by the source are rethrown from begin() or ++.
+     */
+    class token_generator : public std::ranges::view_interface<token_generator>
+    {
+    public:
+        struct promise_type
+        {
+            std::string_view current;   ///< Last yielded token
+            std::exception_ptr error;   ///< Exception escaping the coroutine
+
+            token_generator get_return_object() noexcept
+            {
+                return token_generator(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always final_suspend() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_always yield_value(std::string_view token) noexcept
+            {
+                current = token;
+                return {};
+            }
+
+            void return_void() noexcept {}
+
+            void unhandled_exception() noexcept
+            {
+                error = std::current_exception();
+            }
+        };
+
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        class iterator
+        {
+        public:
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::input_iterator_tag;
+
+            iterator() = default;
+
+            std::string_view operator*() const noexcept
+            {
+                return handle_.promise().current;
+            }
+
+            iterator& operator++()
+            {
+                resume(handle_);
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            friend bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+            {
+                return !it.handle_ || it.handle_.done();
+            }
+
+        private:
+            friend class token_generator;
+
+            explicit iterator(handle_type handle) noexcept
+                : handle_(handle)
+            {
+            }
+
+            handle_type handle_;    ///< Generator coroutine
+        };
+
+        token_generator() noexcept = default;
+
+        token_generator(token_generator&& other) noexcept
+            : handle_(std::exchange(other.handle_, nullptr))
+        {
+        }
+
+        token_generator& operator=(token_generator&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (handle_)
+                    handle_.destroy();
+                handle_ = std::exchange(other.handle_, nullptr);
+            }
+            return *this;
+        }
+
+        token_generator(const token_generator&) = delete;
+        token_generator& operator=(const token_generator&) = delete;
+
+        ~token_generator()
+        {
+            if (handle_)
+                handle_.destroy();
+        }
+
+        /**
+         * @brief Start the coroutine and return an iterator at the first token
+         * @note Call once; the range is single-pass
+         */
+        iterator begin()
+        {
+            if (handle_)
+                resume(handle_);
+            return iterator(handle_);
+        }
+
+        std::default_sentinel_t end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+
+    private:
+        explicit token_generator(handle_type handle) noexcept
+            : handle_(handle)
+        {
+        }
+
+        static void resume(handle_type handle)
+        {
+            handle.resume();
+            if (handle.promise().error)
+                std::rethrow_exception(std::exchange(handle.promise().error, nullptr));
+        }
+
+        handle_type handle_;    ///< Owned coroutine
+    };
+
+    /**
+     * @brief Tokenize input pulled from a streaming source
+     * @param source       Callable size_t(char* buffer, size_t capacity) that fills buffer
+     *                     and returns the number of bytes read (0 at end of input)
+     * @param delimiters   Separator characters
+     * @param zone_pairs   Zone delimiter pairs (empty for none)
+     * @param escape_chars Escape characters (empty for none)
+     * @param chunk_size   Minimum bytes requested per read
+     * @return Generator yielding each token once it is complete
+     * @note A token is held back until a delimiter follows it or input ends, so
+     *       tokens, zones and escapes may span reads. Only the unfinished tail is
+     *       buffered, and the read size doubles while one token outgrows it.
+     */
+    template <class Source>
+        requires std::is_invocable_r_v<size_t, Source&, char*, size_t>
+    token_generator stream_tokens(Source source, std::string delimiters, std::string zone_pairs = {}, std::string escape_chars = {}, size_t chunk_size = 4096)
+    {
+        const char* zones = zone_pairs.empty() ? nullptr : zone_pairs.c_str();
+        const char* escapes = escape_chars.empty() ? nullptr : escape_chars.c_str();
+
+        std::string buffer;
+        size_t pos = 0;
+        bool eof = false;
+
+        for (;;)
+        {
+            CStringView token;
+            size_t next = pos;
+
+            bool found = zones || escapes
+                ? cstr_scan_token_ex(buffer.data(), buffer.size(), delimiters.c_str(), zones, escapes, &next, &token)
+                : cstr_scan_token(buffer.data(), buffer.size(), delimiters.c_str(), &next, &token);
+
+            if (found)
+            {
+                // A token touching the end of the buffer may continue in the next read
+                if (eof || token.data + token.length < buffer.data() + buffer.size())
+                {
+                    pos = next;
+                    co_yield std::string_view(token.data, token.length);
+                    continue;
+                }
+            }
+            else
+            {
+                if (eof)
+                    co_return;
+                pos = buffer.size();
+            }
+
+            buffer.erase(0, pos);
+            pos = 0;
+
+            size_t old_size = buffer.size();
+            size_t request = old_size > chunk_size ? old_size : chunk_size;
+
+            buffer.resize(old_size + request);
+            size_t read = source(buffer.data() + old_size, request);
+            buffer.resize(old_size + (read < request ? read : request));
+
+            if (read == 0)
+                eof = true;
+        }
+    }
+
+    /**
+     * @brief Tokenize a std::istream without reading it into memory first
+     */
+    inline token_generator stream_tokens(std::istream& in, std::string delimiters, std::string zone_pairs = {}, std::string escape_chars = {}, size_t chunk_size = 4096)
+    {
+        return stream_tokens([&in](char* buffer, size_t capacity) -> size_t
+            {
+                in.read(buffer, (std::streamsize)capacity);
+                return (size_t)in.gcount();
+            }, std::move(delimiters), std::move(zone_pairs), std::move(escape_chars), chunk_size);
+    }
+}
+
+#endif // CSTR_RANGES_HPP
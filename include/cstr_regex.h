@@ -0,0 +1,1872 @@
+#pragma once
+
+/**
+ * @file cstr_regex.h
+ * @brief Regular expressions over (data, length) with a lazily built DFA.
+ *
+ * Patterns compile to an immutable NFA program that any number of threads may
+ * share without locking. Matching state lives in a CStringRegexCache owned by
+ * the calling thread: a DFA whose states are built on demand and flushed once
+ * the cache exceeds its memory limit, plus Pike VM buffers used for match
+ * bounds and captures.
+ *
+ * Supported syntax (byte oriented):
+ *   literals, '.', [set], [^set], ranges, \d \D \w \W \s \S,
+ *   \n \r \t \f \v \0 \xHH, escaped punctuation,
+ *   (group), (?:group), a|b, * + ? {n} {n,} {n,m} and lazy variants, ^ $
+ *
+ * Matches are leftmost-first as in Perl. Loops whose body matches the empty
+ * string follow automaton semantics (as in RE2), so capture spans of such
+ * iterations may differ from backtracking engines.
+ */
+
+#ifndef CSTR_REGEX_H
+#define CSTR_REGEX_H
+
+#include "cstr.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @def CSTR_REGEX_ICASE
+     * @brief Compile flag: ASCII case-insensitive matching
+     */
+#define CSTR_REGEX_ICASE 1
+
+    /**
+     * @def CSTR_REGEX_DOTALL
+     * @brief Compile flag: '.' also matches '\n'
+     */
+#define CSTR_REGEX_DOTALL 2
+
+    /**
+     * @def CSTR_REGEX_MAX_DEPTH
+     * @brief Maximum nesting of groups and quantifiers
+     */
+#ifndef CSTR_REGEX_MAX_DEPTH
+#define CSTR_REGEX_MAX_DEPTH 256
+#endif
+
+    /**
+     * @def CSTR_REGEX_MAX_REPEAT
+     * @brief Maximum bound in {n,m}
+     */
+#ifndef CSTR_REGEX_MAX_REPEAT
+#define CSTR_REGEX_MAX_REPEAT 1000
+#endif
+
+    /**
+     * @def CSTR_REGEX_MAX_PROGRAM
+     * @brief Maximum number of compiled instructions
+     */
+#ifndef CSTR_REGEX_MAX_PROGRAM
+#define CSTR_REGEX_MAX_PROGRAM 100000
+#endif
+
+    /**
+     * @def CSTR_REGEX_CACHE_LIMIT
+     * @brief Default DFA cache budget in bytes
+     */
+#ifndef CSTR_REGEX_CACHE_LIMIT
+#define CSTR_REGEX_CACHE_LIMIT (2u << 20)
+#endif
+
+#define CSTR_REGEX_NONE 0xFFFFFFFFu
+#define CSTR_REGEX_INFINITE 0xFFFFFFFFu
+
+    /**
+     * @enum CStringRegexOp
+     * @brief NFA instruction opcodes
+     */
+    typedef enum
+    {
+        CSTR_REGEX_OP_CLASS,     ///< Consume one byte from classes[x]
+        CSTR_REGEX_OP_MATCH,     ///< Accept
+        CSTR_REGEX_OP_JMP,       ///< Continue at x
+        CSTR_REGEX_OP_SPLIT,     ///< Continue at x (preferred) and y
+        CSTR_REGEX_OP_SAVE,      ///< Record position in capture slot x
+        CSTR_REGEX_OP_BOL,       ///< Assert start of input
+        CSTR_REGEX_OP_EOL        ///< Assert end of input
+    }CStringRegexOp;
+
+    /**
+     * @struct CStringRegexInst
+     * @brief NFA instruction
+     */
+    typedef struct
+    {
+        uint32_t op;          ///< CStringRegexOp
+        uint32_t x;           ///< Class, target or slot
+        uint32_t y;           ///< Second SPLIT target
+    }CStringRegexInst;
+
+    /**
+     * @struct CStringRegex
+     * @brief Compiled regular expression
+     *
+     * @var program           - NFA instructions
+     * @var program_size      - Number of instructions
+     * @var classes           - Byte sets, four 64-bit words each
+     * @var class_count       - Number of byte sets
+     * @var byte_map          - Byte to DFA alphabet symbol
+     * @var representatives   - One byte per alphabet symbol
+     * @var alphabet          - Number of alphabet symbols
+     * @var anchored_start    - Entry point matching at the start position only
+     * @var unanchored_start  - Entry point matching anywhere
+     * @var groups            - Capture groups including the whole match
+     * @var prefix            - Literal every match starts with
+     * @var prefix_length     - Literal length
+     * @var anchored          - Pattern starts with '^'
+     * @var serial            - Compilation number, tells caches apart from a
+     *                          recompiled regex at the same address
+     * @note Immutable after compilation; safe to share between threads
+     */
+    typedef struct
+    {
+        CStringRegexInst* program;    ///< Instructions
+        size_t program_size;          ///< Instruction count
+        uint64_t* classes;            ///< Byte sets
+        size_t class_count;           ///< Byte set count
+        uint8_t byte_map[256];        ///< Alphabet compression
+        uint8_t representatives[256]; ///< Sample byte per symbol
+        size_t alphabet;              ///< Symbol count
+        uint32_t anchored_start;      ///< Anchored entry
+        uint32_t unanchored_start;    ///< Unanchored entry
+        size_t groups;                ///< Capture groups
+        char* prefix;                 ///< Required literal prefix
+        size_t prefix_length;         ///< Prefix length
+        bool anchored;                ///< Starts with '^'
+        LONG serial;                  ///< Compilation number
+    }CStringRegex;
+
+    /**
+     * @struct CStringRegexMatch
+     * @brief Span of a capture group (CSTR_INVALID when the group did not take part)
+     */
+    typedef struct
+    {
+        size_t start;     ///< First byte
+        size_t end;       ///< One past the last byte
+    }CStringRegexMatch;
+
+    /**
+     * @struct CStringRegexFrame
+     * @brief Explicit stack entry for epsilon closure
+     */
+    typedef struct
+    {
+        uint32_t pc;      ///< Instruction, or CSTR_REGEX_NONE to restore a slot
+        uint32_t slot;    ///< Slot to restore
+        size_t value;     ///< Saved slot value
+    }CStringRegexFrame;
+
+    /**
+     * @struct CStringRegexCache
+     * @brief Per-thread matching state
+     *
+     * @var regex          - Regex the buffers are sized for
+     * @var memory_limit   - DFA budget in bytes; exceeding it flushes all states
+     * @note Not thread-safe; use one cache per thread
+     */
+    typedef struct
+    {
+        const CStringRegex* regex;    ///< Bound regex
+        LONG serial;                  ///< Serial of bound regex
+        size_t memory_limit;          ///< DFA budget in bytes
+
+        uint32_t* pool;               ///< Instruction sets of all states
+        size_t pool_size;             ///< Used pool entries
+        size_t pool_capacity;         ///< Allocated pool entries
+        size_t* state_offset;         ///< Start of state's set in pool
+        uint32_t* state_length;       ///< Size of state's set
+        uint8_t* state_flags;         ///< Match and context flags
+        int32_t* transitions;         ///< state * alphabet + symbol, -1 unknown
+        size_t state_count;           ///< States in use
+        size_t state_capacity;        ///< Allocated states
+        uint32_t* table;              ///< Hash table of state ids + 1
+        size_t table_capacity;        ///< Table size (power of two)
+        int32_t starts[4];            ///< Start states by (anchored, bol)
+        size_t flushes;               ///< Number of flushes so far
+        size_t flush_states;          ///< States discarded by the last flush
+
+        uint32_t* marks;              ///< Visited generation per instruction
+        uint32_t generation;          ///< Current generation
+        uint32_t* set;                ///< Set under construction
+        size_t set_count;             ///< Set size
+        CStringRegexFrame* stack;     ///< Closure stack
+
+        uint32_t* thread_pc[2];       ///< Pike VM thread lists
+        size_t* thread_caps[2];       ///< Pike VM capture slots per thread
+        size_t thread_count[2];       ///< Pike VM list sizes
+        size_t* caps;                 ///< Slots of the thread being expanded
+    }CStringRegexCache;
+
+#define CSTR_REGEX_STATE_MATCH 1
+#define CSTR_REGEX_STATE_EOL_MATCH 2
+#define CSTR_REGEX_STATE_BOL 4
+
+    /**
+     * @struct CStringRegexNode
+     * @brief Parse tree node
+     */
+    typedef struct
+    {
+        uint8_t type;         ///< CSTR_REGEX_NODE_*
+        uint8_t greedy;       ///< Repeat prefers more iterations
+        uint32_t child;       ///< First child, class index
+        uint32_t next;        ///< Next sibling in CAT/ALT lists
+        uint32_t min;         ///< Repeat minimum, group capture index
+        uint32_t max;         ///< Repeat maximum
+    }CStringRegexNode;
+
+#define CSTR_REGEX_NODE_CLASS 0
+#define CSTR_REGEX_NODE_CAT 1
+#define CSTR_REGEX_NODE_ALT 2
+#define CSTR_REGEX_NODE_REPEAT 3
+#define CSTR_REGEX_NODE_GROUP 4
+#define CSTR_REGEX_NODE_BOL 5
+#define CSTR_REGEX_NODE_EOL 6
+
+    /**
+     * @struct CStringRegexParser
+     * @brief Compilation state
+     */
+    typedef struct
+    {
+        const char* pattern;          ///< Pattern bytes
+        size_t length;                ///< Pattern length
+        size_t pos;                   ///< Parse position
+        unsigned flags;               ///< CSTR_REGEX_* flags
+        bool error;                   ///< Syntax or allocation error
+        CStringRegexNode* nodes;      ///< Parse tree
+        size_t node_count;            ///< Nodes in use
+        size_t node_capacity;         ///< Allocated nodes
+        CStringRegex* regex;          ///< Output
+        size_t class_capacity;        ///< Allocated classes
+        size_t program_capacity;      ///< Allocated instructions
+    }CStringRegexParser;
+
+    CSTR_API bool cstr_regex_destroy(_In_ CStringRegex* re);
+    CSTR_API bool cstr_regex_compile(_Out_ CStringRegex* re, _In_reads_(length) const char* pattern, _In_ size_t length, _In_ unsigned flags);
+    CSTR_API bool cstr_regex_compile_cstr(_Out_ CStringRegex* re, _In_ CString* pattern, _In_ unsigned flags);
+    CSTR_API size_t cstr_regex_group_count(_In_ const CStringRegex* re);
+    CSTR_API bool cstr_regex_cache_create(_Out_ CStringRegexCache* cache);
+    CSTR_API bool cstr_regex_cache_destroy(_In_ CStringRegexCache* cache);
+    CSTR_API bool cstr_regex_execute(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length, _In_ int mode, _Out_opt_ size_t* caps);
+    CSTR_API bool cstr_regex_find(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length, _Out_opt_ size_t* start, _Out_opt_ size_t* end);
+    CSTR_API bool cstr_regex_match(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length);
+    CSTR_API bool cstr_regex_captures(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length, _Out_writes_(count) CStringRegexMatch* groups, _In_ size_t count);
+    CSTR_API bool cstr_regex_find_cstr(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_ CString* obj, _Out_opt_ size_t* start, _Out_opt_ size_t* end);
+    CSTR_API bool cstr_regex_match_cstr(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_ CString* obj);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_REGEX)
+
+    /**
+     * @brief Source of CStringRegex::serial
+     */
+    static volatile LONG cstr_regex_serial = 0;
+
+    /**
+     * @brief Test byte against class
+     */
+    CSTR_INLINE bool cstr_regex_class_has(_In_ const uint64_t* cls, _In_ uint8_t byte)
+    {
+        return (cls[byte >> 6] >> (byte & 63)) & 1;
+    }
+
+    /**
+     * @brief Allocate parse tree node
+     * @return Node index or CSTR_REGEX_NONE
+     */
+    CSTR_INLINE uint32_t cstr_regex_node(_Inout_ CStringRegexParser* p, _In_ uint8_t type)
+    {
+        if (p->error)
+            return CSTR_REGEX_NONE;
+
+        if (p->node_count == p->node_capacity)
+        {
+            size_t capacity = p->node_capacity ? p->node_capacity * 2 : 64;
+            CStringRegexNode* nodes = (CStringRegexNode*)realloc(p->nodes, capacity * sizeof(CStringRegexNode));
+            if (!nodes)
+            {
+                p->error = true;
+                return CSTR_REGEX_NONE;
+            }
+            p->nodes = nodes;
+            p->node_capacity = capacity;
+        }
+
+        CStringRegexNode* node = &p->nodes[p->node_count];
+        memset(node, 0, sizeof(*node));
+        node->type = type;
+        node->child = CSTR_REGEX_NONE;
+        node->next = CSTR_REGEX_NONE;
+
+        return (uint32_t)p->node_count++;
+    }
+
+    /**
+     * @brief Allocate empty byte class
+     * @return Class index or CSTR_REGEX_NONE
+     */
+    CSTR_INLINE uint32_t cstr_regex_class(_Inout_ CStringRegexParser* p)
+    {
+        if (p->error)
+            return CSTR_REGEX_NONE;
+
+        CStringRegex* re = p->regex;
+        if (re->class_count == p->class_capacity)
+        {
+            size_t capacity = p->class_capacity ? p->class_capacity * 2 : 32;
+            uint64_t* classes = (uint64_t*)realloc(re->classes, capacity * 4 * sizeof(uint64_t));
+            if (!classes)
+            {
+                p->error = true;
+                return CSTR_REGEX_NONE;
+            }
+            re->classes = classes;
+            p->class_capacity = capacity;
+        }
+
+        memset(re->classes + re->class_count * 4, 0, 4 * sizeof(uint64_t));
+
+        return (uint32_t)re->class_count++;
+    }
+
+    /**
+     * @brief Add byte range to class set
+     */
+    CSTR_INLINE void cstr_regex_set_range(_Inout_updates_(4) uint64_t* set, _In_ unsigned lo, _In_ unsigned hi)
+    {
+        for (unsigned c = lo; c <= hi; ++c)
+            set[c >> 6] |= (uint64_t)1 << (c & 63);
+    }
+
+    /**
+     * @brief Add shorthand class (\d \w \s and negations) to set
+     */
+    CSTR_INLINE void cstr_regex_set_shorthand(_Inout_updates_(4) uint64_t* set, _In_ char kind)
+    {
+        uint64_t tmp[4] = { 0, 0, 0, 0 };
+
+        switch (kind | 0x20)
+        {
+        case 'd':
+            cstr_regex_set_range(tmp, '0', '9');
+            break;
+        case 'w':
+            cstr_regex_set_range(tmp, '0', '9');
+            cstr_regex_set_range(tmp, 'A', 'Z');
+            cstr_regex_set_range(tmp, 'a', 'z');
+            cstr_regex_set_range(tmp, '_', '_');
+            break;
+        case 's':
+            cstr_regex_set_range(tmp, '\t', '\r');
+            cstr_regex_set_range(tmp, ' ', ' ');
+            break;
+        }
+
+        bool negate = kind >= 'A' && kind <= 'Z';
+        for (int i = 0; i < 4; ++i)
+            set[i] |= negate ? ~tmp[i] : tmp[i];
+    }
+
+    /**
+     * @brief Parse escape after '\'
+     * @param p   Parser positioned after the backslash
+     * @param set Receives the escaped byte(s)
+     * @return true on success
+     */
+    CSTR_INLINE bool cstr_regex_parse_escape(_Inout_ CStringRegexParser* p, _Inout_updates_(4) uint64_t* set)
+    {
+        if (p->pos >= p->length)
+            return false;
+
+        char c = p->pattern[p->pos++];
+        switch (c)
+        {
+        case 'd': case 'D': case 'w': case 'W': case 's': case 'S':
+            cstr_regex_set_shorthand(set, c);
+            return true;
+        case 'n': cstr_regex_set_range(set, '\n', '\n'); return true;
+        case 'r': cstr_regex_set_range(set, '\r', '\r'); return true;
+        case 't': cstr_regex_set_range(set, '\t', '\t'); return true;
+        case 'f': cstr_regex_set_range(set, '\f', '\f'); return true;
+        case 'v': cstr_regex_set_range(set, '\v', '\v'); return true;
+        case '0': cstr_regex_set_range(set, 0, 0); return true;
+        case 'x':
+        {
+            unsigned value = 0;
+            for (int i = 0; i < 2; ++i)
+            {
+                if (p->pos >= p->length)
+                    return false;
+                char h = p->pattern[p->pos++];
+                if (h >= '0' && h <= '9')
+                    value = value * 16 + (unsigned)(h - '0');
+                else if ((h | 0x20) >= 'a' && (h | 0x20) <= 'f')
+                    value = value * 16 + (unsigned)((h | 0x20) - 'a' + 10);
+                else
+                    return false;
+            }
+            cstr_regex_set_range(set, value, value);
+            return true;
+        }
+        default:
+            // Letters and digits are reserved for future escapes
+            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+                return false;
+            cstr_regex_set_range(set, (uint8_t)c, (uint8_t)c);
+            return true;
+        }
+    }
+
+    /**
+     * @brief Add the other ASCII case of every letter in set
+     */
+    CSTR_INLINE void cstr_regex_set_fold(_Inout_updates_(4) uint64_t* set)
+    {
+        for (unsigned c = 'A'; c <= 'Z'; ++c)
+        {
+            bool upper = cstr_regex_class_has(set, (uint8_t)c);
+            bool lower = cstr_regex_class_has(set, (uint8_t)(c | 0x20));
+            if (upper || lower)
+            {
+                cstr_regex_set_range(set, c, c);
+                cstr_regex_set_range(set, c | 0x20, c | 0x20);
+            }
+        }
+    }
+
+    /**
+     * @brief Parse bracket expression after '['
+     * @return Class node or CSTR_REGEX_NONE
+     */
+    CSTR_INLINE uint32_t cstr_regex_parse_set(_Inout_ CStringRegexParser* p)
+    {
+        uint64_t set[4] = { 0, 0, 0, 0 };
+        bool negate = false;
+
+        if (p->pos < p->length && p->pattern[p->pos] == '^')
+        {
+            negate = true;
+            p->pos++;
+        }
+
+        bool first = true;
+        for (;;)
+        {
+            if (p->pos >= p->length)
+                return CSTR_REGEX_NONE;
+
+            char c = p->pattern[p->pos];
+            if (c == ']' && !first)
+            {
+                p->pos++;
+                break;
+            }
+            first = false;
+            p->pos++;
+
+            unsigned lo;
+            if (c == '\\')
+            {
+                uint64_t esc[4] = { 0, 0, 0, 0 };
+                if (!cstr_regex_parse_escape(p, esc))
+                    return CSTR_REGEX_NONE;
+
+                // Multi-byte escapes cannot start a range
+                if (cstr_popcount64(esc[0]) + cstr_popcount64(esc[1]) + cstr_popcount64(esc[2]) + cstr_popcount64(esc[3]) != 1)
+                {
+                    for (int i = 0; i < 4; ++i)
+                        set[i] |= esc[i];
+                    continue;
+                }
+
+                lo = 0;
+                while (!cstr_regex_class_has(esc, (uint8_t)lo))
+                    lo++;
+            }
+            else
+                lo = (uint8_t)c;
+
+            unsigned hi = lo;
+            if (p->pos + 1 < p->length && p->pattern[p->pos] == '-' && p->pattern[p->pos + 1] != ']')
+            {
+                p->pos++;
+                char d = p->pattern[p->pos++];
+                if (d == '\\')
+                {
+                    uint64_t esc[4] = { 0, 0, 0, 0 };
+                    if (!cstr_regex_parse_escape(p, esc))
+                        return CSTR_REGEX_NONE;
+                    if (cstr_popcount64(esc[0]) + cstr_popcount64(esc[1]) + cstr_popcount64(esc[2]) + cstr_popcount64(esc[3]) != 1)
+                        return CSTR_REGEX_NONE;
+                    hi = 0;
+                    while (!cstr_regex_class_has(esc, (uint8_t)hi))
+                        hi++;
+                }
+                else
+                    hi = (uint8_t)d;
+
+                if (hi < lo)
+                    return CSTR_REGEX_NONE;
+            }
+
+            cstr_regex_set_range(set, lo, hi);
+        }
+
+        if (p->flags & CSTR_REGEX_ICASE)
+            cstr_regex_set_fold(set);
+
+        uint32_t cls = cstr_regex_class(p);
+        uint32_t node = cstr_regex_node(p, CSTR_REGEX_NODE_CLASS);
+        if (node == CSTR_REGEX_NONE || cls == CSTR_REGEX_NONE)
+            return CSTR_REGEX_NONE;
+
+        uint64_t* out = p->regex->classes + (size_t)cls * 4;
+        for (int i = 0; i < 4; ++i)
+            out[i] = negate ? ~set[i] : set[i];
+
+        p->nodes[node].child = cls;
+
+        return node;
+    }
+
+    /**
+     * @brief Create class node from set
+     * @return Node index or CSTR_REGEX_NONE
+     */
+    CSTR_INLINE uint32_t cstr_regex_class_node(_Inout_ CStringRegexParser* p, _In_reads_(4) const uint64_t* set)
+    {
+        uint32_t cls = cstr_regex_class(p);
+        uint32_t node = cstr_regex_node(p, CSTR_REGEX_NODE_CLASS);
+        if (node == CSTR_REGEX_NONE || cls == CSTR_REGEX_NONE)
+            return CSTR_REGEX_NONE;
+
+        uint64_t* out = p->regex->classes + (size_t)cls * 4;
+        memcpy(out, set, 4 * sizeof(uint64_t));
+        if (p->flags & CSTR_REGEX_ICASE)
+            cstr_regex_set_fold(out);
+
+        p->nodes[node].child = cls;
+
+        return node;
+    }
+
+    // Groups recurse back into the alternation parser
+    CSTR_INLINE uint32_t cstr_regex_parse_alt(_Inout_ CStringRegexParser* p, _In_ unsigned depth);
+
+    /**
+     * @brief Parse single atom
+     * @return Node index or CSTR_REGEX_NONE
+     */
+    CSTR_INLINE uint32_t cstr_regex_parse_atom(_Inout_ CStringRegexParser* p, _In_ unsigned depth)
+    {
+        char c = p->pattern[p->pos++];
+        uint64_t set[4] = { 0, 0, 0, 0 };
+
+        switch (c)
+        {
+        case '(':
+        {
+            if (depth >= CSTR_REGEX_MAX_DEPTH)
+                return CSTR_REGEX_NONE;
+
+            uint32_t capture = CSTR_REGEX_NONE;
+            if (p->pos + 1 < p->length && p->pattern[p->pos] == '?' && p->pattern[p->pos + 1] == ':')
+                p->pos += 2;
+            else
+                capture = (uint32_t)p->regex->groups++;
+
+            uint32_t inner = cstr_regex_parse_alt(p, depth + 1);
+            if (inner == CSTR_REGEX_NONE || p->pos >= p->length || p->pattern[p->pos] != ')')
+                return CSTR_REGEX_NONE;
+            p->pos++;
+
+            uint32_t node = cstr_regex_node(p, CSTR_REGEX_NODE_GROUP);
+            if (node == CSTR_REGEX_NONE)
+                return CSTR_REGEX_NONE;
+            p->nodes[node].child = inner;
+            p->nodes[node].min = capture;
+            return node;
+        }
+        case '[':
+            return cstr_regex_parse_set(p);
+        case '.':
+            cstr_regex_set_range(set, 0, 255);
+            if (!(p->flags & CSTR_REGEX_DOTALL))
+                set[0] &= ~((uint64_t)1 << '\n');
+            return cstr_regex_class_node(p, set);
+        case '^':
+            return cstr_regex_node(p, CSTR_REGEX_NODE_BOL);
+        case '$':
+            return cstr_regex_node(p, CSTR_REGEX_NODE_EOL);
+        case '\\':
+            if (!cstr_regex_parse_escape(p, set))
+                return CSTR_REGEX_NONE;
+            return cstr_regex_class_node(p, set);
+        case '*': case '+': case '?': case ')':
+            return CSTR_REGEX_NONE;
+        default:
+            cstr_regex_set_range(set, (uint8_t)c, (uint8_t)c);
+            return cstr_regex_class_node(p, set);
+        }
+    }
+
+    /**
+     * @brief Parse decimal number
+     * @return true if at least one digit was read
+     */
+    CSTR_INLINE bool cstr_regex_parse_number(_Inout_ CStringRegexParser* p, _Out_ uint32_t* value)
+    {
+        size_t start = p->pos;
+        *value = 0;
+
+        while (p->pos < p->length && p->pattern[p->pos] >= '0' && p->pattern[p->pos] <= '9')
+        {
+            if (*value <= CSTR_REGEX_MAX_REPEAT)
+                *value = *value * 10 + (uint32_t)(p->pattern[p->pos] - '0');
+            p->pos++;
+        }
+
+        return p->pos > start;
+    }
+
+    /**
+     * @brief Parse atom with quantifiers
+     * @return Node index or CSTR_REGEX_NONE
+     */
+    CSTR_INLINE uint32_t cstr_regex_parse_repeat(_Inout_ CStringRegexParser* p, _In_ unsigned depth)
+    {
+        uint32_t atom = cstr_regex_parse_atom(p, depth);
+
+        while (atom != CSTR_REGEX_NONE && p->pos < p->length)
+        {
+            uint32_t min, max;
+            char c = p->pattern[p->pos];
+
+            if (c == '*' || c == '+' || c == '?')
+            {
+                min = c == '+' ? 1 : 0;
+                max = c == '?' ? 1 : CSTR_REGEX_INFINITE;
+                p->pos++;
+            }
+            else if (c == '{')
+            {
+                // Anything but {n}, {n,} or {n,m} is a literal brace
+                size_t save = p->pos++;
+                if (!cstr_regex_parse_number(p, &min))
+                {
+                    p->pos = save;
+                    break;
+                }
+
+                max = min;
+                if (p->pos < p->length && p->pattern[p->pos] == ',')
+                {
+                    p->pos++;
+                    if (!cstr_regex_parse_number(p, &max))
+                        max = CSTR_REGEX_INFINITE;
+                }
+
+                if (p->pos >= p->length || p->pattern[p->pos] != '}')
+                {
+                    p->pos = save;
+                    break;
+                }
+                p->pos++;
+
+                if (min > CSTR_REGEX_MAX_REPEAT || (max != CSTR_REGEX_INFINITE && (max > CSTR_REGEX_MAX_REPEAT || max < min)))
+                    return CSTR_REGEX_NONE;
+            }
+            else
+                break;
+
+            if (++depth > CSTR_REGEX_MAX_DEPTH)
+                return CSTR_REGEX_NONE;
+
+            bool greedy = true;
+            if (p->pos < p->length && p->pattern[p->pos] == '?')
+            {
+                greedy = false;
+                p->pos++;
+            }
+
+            uint32_t node = cstr_regex_node(p, CSTR_REGEX_NODE_REPEAT);
+            if (node == CSTR_REGEX_NONE)
+                return CSTR_REGEX_NONE;
+            p->nodes[node].child = atom;
+            p->nodes[node].min = min;
+            p->nodes[node].max = max;
+            p->nodes[node].greedy = greedy;
+            atom = node;
+        }
+
+        return atom;
+    }
+
+    /**
+     * @brief Parse concatenation up to '|' or ')'
+     * @return Node index or CSTR_REGEX_NONE
+     */
+    CSTR_INLINE uint32_t cstr_regex_parse_cat(_Inout_ CStringRegexParser* p, _In_ unsigned depth)
+    {
+        uint32_t cat = cstr_regex_node(p, CSTR_REGEX_NODE_CAT);
+        uint32_t tail = CSTR_REGEX_NONE;
+
+        while (cat != CSTR_REGEX_NONE && p->pos < p->length && p->pattern[p->pos] != '|' && p->pattern[p->pos] != ')')
+        {
+            uint32_t item = cstr_regex_parse_repeat(p, depth);
+            if (item == CSTR_REGEX_NONE)
+                return CSTR_REGEX_NONE;
+
+            if (tail == CSTR_REGEX_NONE)
+                p->nodes[cat].child = item;
+            else
+                p->nodes[tail].next = item;
+            tail = item;
+        }
+
+        return cat;
+    }
+
+    /**
+     * @brief Parse alternation
+     * @return Node index or CSTR_REGEX_NONE
+     */
+    CSTR_INLINE uint32_t cstr_regex_parse_alt(_Inout_ CStringRegexParser* p, _In_ unsigned depth)
+    {
+        uint32_t first = cstr_regex_parse_cat(p, depth);
+        if (first == CSTR_REGEX_NONE || p->pos >= p->length || p->pattern[p->pos] != '|')
+            return first;
+
+        uint32_t alt = cstr_regex_node(p, CSTR_REGEX_NODE_ALT);
+        if (alt == CSTR_REGEX_NONE)
+            return CSTR_REGEX_NONE;
+        p->nodes[alt].child = first;
+
+        uint32_t tail = first;
+        while (p->pos < p->length && p->pattern[p->pos] == '|')
+        {
+            p->pos++;
+            uint32_t next = cstr_regex_parse_cat(p, depth);
+            if (next == CSTR_REGEX_NONE)
+                return CSTR_REGEX_NONE;
+            p->nodes[tail].next = next;
+            tail = next;
+        }
+
+        return alt;
+    }
+
+    /**
+     * @brief Append instruction
+     * @return Instruction index or CSTR_REGEX_NONE
+     */
+    CSTR_INLINE uint32_t cstr_regex_emit(_Inout_ CStringRegexParser* p, _In_ uint32_t op, _In_ uint32_t x, _In_ uint32_t y)
+    {
+        if (p->error)
+            return CSTR_REGEX_NONE;
+
+        CStringRegex* re = p->regex;
+        if (re->program_size == p->program_capacity)
+        {
+            if (re->program_size >= CSTR_REGEX_MAX_PROGRAM)
+            {
+                p->error = true;
+                return CSTR_REGEX_NONE;
+            }
+
+            size_t capacity = p->program_capacity ? p->program_capacity * 2 : 64;
+            CStringRegexInst* program = (CStringRegexInst*)realloc(re->program, capacity * sizeof(CStringRegexInst));
+            if (!program)
+            {
+                p->error = true;
+                return CSTR_REGEX_NONE;
+            }
+            re->program = program;
+            p->program_capacity = capacity;
+        }
+
+        CStringRegexInst* inst = &re->program[re->program_size];
+        inst->op = op;
+        inst->x = x;
+        inst->y = y;
+
+        return (uint32_t)re->program_size++;
+    }
+
+    /**
+     * @brief Generate instructions for parse tree node
+     * @note Recursion depth is bounded by CSTR_REGEX_MAX_DEPTH
+     */
+    CSTR_INLINE void cstr_regex_generate(_Inout_ CStringRegexParser* p, _In_ uint32_t index)
+    {
+        if (p->error)
+            return;
+
+        CStringRegexNode node = p->nodes[index];
+
+        switch (node.type)
+        {
+        case CSTR_REGEX_NODE_CLASS:
+            cstr_regex_emit(p, CSTR_REGEX_OP_CLASS, node.child, 0);
+            break;
+        case CSTR_REGEX_NODE_BOL:
+            cstr_regex_emit(p, CSTR_REGEX_OP_BOL, 0, 0);
+            break;
+        case CSTR_REGEX_NODE_EOL:
+            cstr_regex_emit(p, CSTR_REGEX_OP_EOL, 0, 0);
+            break;
+        case CSTR_REGEX_NODE_CAT:
+            for (uint32_t child = node.child; child != CSTR_REGEX_NONE; child = p->nodes[child].next)
+                cstr_regex_generate(p, child);
+            break;
+        case CSTR_REGEX_NODE_ALT:
+        {
+            // SPLIT chain; each branch but the last ends in a JMP patched to the end
+            uint32_t jumps = CSTR_REGEX_NONE;
+            for (uint32_t child = node.child; child != CSTR_REGEX_NONE && !p->error; child = p->nodes[child].next)
+            {
+                if (p->nodes[child].next == CSTR_REGEX_NONE)
+                {
+                    cstr_regex_generate(p, child);
+                    break;
+                }
+
+                uint32_t split = cstr_regex_emit(p, CSTR_REGEX_OP_SPLIT, 0, 0);
+                if (split == CSTR_REGEX_NONE)
+                    return;
+                p->regex->program[split].x = split + 1;
+                cstr_regex_generate(p, child);
+
+                uint32_t jmp = cstr_regex_emit(p, CSTR_REGEX_OP_JMP, jumps, 0);
+                if (jmp == CSTR_REGEX_NONE)
+                    return;
+                jumps = jmp;
+                p->regex->program[split].y = (uint32_t)p->regex->program_size;
+            }
+
+            if (p->error)
+                return;
+
+            while (jumps != CSTR_REGEX_NONE)
+            {
+                uint32_t next = p->regex->program[jumps].x;
+                p->regex->program[jumps].x = (uint32_t)p->regex->program_size;
+                jumps = next;
+            }
+            break;
+        }
+        case CSTR_REGEX_NODE_GROUP:
+            if (node.min != CSTR_REGEX_NONE)
+                cstr_regex_emit(p, CSTR_REGEX_OP_SAVE, node.min * 2, 0);
+            cstr_regex_generate(p, node.child);
+            if (node.min != CSTR_REGEX_NONE)
+                cstr_regex_emit(p, CSTR_REGEX_OP_SAVE, node.min * 2 + 1, 0);
+            break;
+        case CSTR_REGEX_NODE_REPEAT:
+        {
+            for (uint32_t i = 0; i < node.min && !p->error; ++i)
+                cstr_regex_generate(p, node.child);
+
+            if (node.max == CSTR_REGEX_INFINITE)
+            {
+                uint32_t split = cstr_regex_emit(p, CSTR_REGEX_OP_SPLIT, 0, 0);
+                cstr_regex_generate(p, node.child);
+                cstr_regex_emit(p, CSTR_REGEX_OP_JMP, split, 0);
+                if (p->error)
+                    return;
+
+                uint32_t body = split + 1;
+                uint32_t end = (uint32_t)p->regex->program_size;
+                p->regex->program[split].x = node.greedy ? body : end;
+                p->regex->program[split].y = node.greedy ? end : body;
+                break;
+            }
+
+            // Optional copies: every SPLIT skips straight to the end
+            uint32_t splits = CSTR_REGEX_NONE;
+            for (uint32_t i = node.min; i < node.max && !p->error; ++i)
+            {
+                uint32_t split = cstr_regex_emit(p, CSTR_REGEX_OP_SPLIT, splits, 0);
+                if (split == CSTR_REGEX_NONE)
+                    return;
+                splits = split;
+                cstr_regex_generate(p, node.child);
+            }
+
+            if (p->error)
+                return;
+
+            uint32_t end = (uint32_t)p->regex->program_size;
+            while (splits != CSTR_REGEX_NONE)
+            {
+                CStringRegexInst* inst = &p->regex->program[splits];
+                uint32_t next = inst->x;
+                inst->x = node.greedy ? splits + 1 : end;
+                inst->y = node.greedy ? end : splits + 1;
+                splits = next;
+            }
+            break;
+        }
+        }
+    }
+
+    /**
+     * @brief Collect literal prefix and anchoring of pattern
+     */
+    CSTR_INLINE void cstr_regex_analyze(_Inout_ CStringRegexParser* p, _In_ uint32_t root)
+    {
+        CStringRegex* re = p->regex;
+        uint32_t item = root;
+
+        if (p->nodes[root].type == CSTR_REGEX_NODE_CAT)
+            item = p->nodes[root].child;
+        else if (p->nodes[root].type != CSTR_REGEX_NODE_CLASS && p->nodes[root].type != CSTR_REGEX_NODE_BOL)
+            return;
+
+        if (item != CSTR_REGEX_NONE && p->nodes[item].type == CSTR_REGEX_NODE_BOL)
+        {
+            re->anchored = true;
+            return;
+        }
+
+        size_t length = 0;
+        for (uint32_t i = item; i != CSTR_REGEX_NONE && p->nodes[i].type == CSTR_REGEX_NODE_CLASS; i = p->nodes[i].next)
+        {
+            const uint64_t* cls = re->classes + (size_t)p->nodes[i].child * 4;
+            if (cstr_popcount64(cls[0]) + cstr_popcount64(cls[1]) + cstr_popcount64(cls[2]) + cstr_popcount64(cls[3]) != 1)
+                break;
+            length++;
+            if (i == root)
+                break;
+        }
+
+        if (!length)
+            return;
+
+        re->prefix = (char*)malloc(length);
+        if (!re->prefix)
+            return;
+
+        size_t n = 0;
+        for (uint32_t i = item; n < length; i = p->nodes[i].next)
+        {
+            const uint64_t* cls = re->classes + (size_t)p->nodes[i].child * 4;
+            unsigned byte = 0;
+            while (!cstr_regex_class_has(cls, (uint8_t)byte))
+                byte++;
+            re->prefix[n++] = (char)byte;
+        }
+        re->prefix_length = length;
+    }
+
+    /**
+     * @brief Partition bytes into classes no instruction can tell apart
+     */
+    CSTR_INLINE void cstr_regex_build_alphabet(_Inout_ CStringRegex* re)
+    {
+        int16_t remap[512];
+        uint8_t next_map[256];
+
+        memset(re->byte_map, 0, sizeof(re->byte_map));
+        size_t count = 1;
+
+        for (size_t c = 0; c < re->class_count; ++c)
+        {
+            const uint64_t* cls = re->classes + c * 4;
+
+            for (int i = 0; i < 512; ++i)
+                remap[i] = -1;
+
+            count = 0;
+            for (unsigned b = 0; b < 256; ++b)
+            {
+                unsigned key = (unsigned)re->byte_map[b] * 2 + cstr_regex_class_has(cls, (uint8_t)b);
+                if (remap[key] < 0)
+                    remap[key] = (int16_t)count++;
+                next_map[b] = (uint8_t)remap[key];
+            }
+
+            memcpy(re->byte_map, next_map, sizeof(next_map));
+        }
+
+        re->alphabet = count;
+        for (int b = 255; b >= 0; --b)
+            re->representatives[re->byte_map[b]] = (uint8_t)b;
+    }
+
+    /**
+     * @brief Release compiled regex
+     * @param re Regex to destroy
+     * @return true on success
+     */
+    bool cstr_regex_destroy(_In_ CStringRegex* re)
+    {
+        if (!re)
+            return false;
+
+        free(re->program);
+        free(re->classes);
+        free(re->prefix);
+        memset(re, 0, sizeof(*re));
+
+        return true;
+    }
+
+    /**
+     * @brief Compile regular expression
+     * @param re      Regex to initialize
+     * @param pattern Pattern bytes
+     * @param length  Pattern length
+     * @param flags   CSTR_REGEX_ICASE, CSTR_REGEX_DOTALL
+     * @return true on success, false on syntax error or allocation failure
+     */
+    bool cstr_regex_compile(_Out_ CStringRegex* re, _In_reads_(length) const char* pattern, _In_ size_t length, _In_ unsigned flags)
+    {
+        if (!re)
+            return false;
+
+        memset(re, 0, sizeof(*re));
+
+        if (!pattern && length)
+            return false;
+
+        CStringRegexParser p;
+        memset(&p, 0, sizeof(p));
+        p.pattern = pattern;
+        p.length = length;
+        p.flags = flags;
+        p.regex = re;
+
+        re->groups = 1;
+
+        uint32_t root = cstr_regex_parse_alt(&p, 0);
+        if (root == CSTR_REGEX_NONE || p.error || p.pos != length)
+        {
+            free(p.nodes);
+            cstr_regex_destroy(re);
+            return false;
+        }
+
+        // Unanchored entry: L0: SPLIT main, any; any: CLASS all; JMP L0
+        uint32_t all = cstr_regex_class(&p);
+        if (all != CSTR_REGEX_NONE)
+            cstr_regex_set_range(re->classes + (size_t)all * 4, 0, 255);
+
+        re->unanchored_start = cstr_regex_emit(&p, CSTR_REGEX_OP_SPLIT, 3, 1);
+        cstr_regex_emit(&p, CSTR_REGEX_OP_CLASS, all, 0);
+        cstr_regex_emit(&p, CSTR_REGEX_OP_JMP, 0, 0);
+
+        re->anchored_start = cstr_regex_emit(&p, CSTR_REGEX_OP_SAVE, 0, 0);
+        cstr_regex_generate(&p, root);
+        cstr_regex_emit(&p, CSTR_REGEX_OP_SAVE, 1, 0);
+        cstr_regex_emit(&p, CSTR_REGEX_OP_MATCH, 0, 0);
+
+        if (!p.error)
+            cstr_regex_analyze(&p, root);
+
+        free(p.nodes);
+
+        if (p.error)
+        {
+            cstr_regex_destroy(re);
+            return false;
+        }
+
+        cstr_regex_build_alphabet(re);
+        re->serial = InterlockedIncrement(&cstr_regex_serial);
+
+        return true;
+    }
+
+    /**
+     * @brief Compile regular expression from CString
+     * @param re      Regex to initialize
+     * @param pattern Pattern
+     * @param flags   CSTR_REGEX_ICASE, CSTR_REGEX_DOTALL
+     * @return true on success, false on syntax error or allocation failure
+     */
+    bool cstr_regex_compile_cstr(_Out_ CStringRegex* re, _In_ CString* pattern, _In_ unsigned flags)
+    {
+        if (!re || !pattern)
+            return false;
+
+        cstr_lock(pattern);
+
+        bool out = cstr_regex_compile(re, pattern->data, pattern->length, flags);
+
+        cstr_unlock(pattern);
+
+        return out;
+    }
+
+    /**
+     * @brief Number of capture groups including group 0 (whole match)
+     * @param re Compiled regex
+     * @return Group count or CSTR_INVALID
+     */
+    size_t cstr_regex_group_count(_In_ const CStringRegex* re)
+    {
+        if (!re || !re->program)
+            return cstr_invalid;
+
+        return re->groups;
+    }
+
+    /**
+     * @brief Initialize empty matching cache
+     * @param cache Cache to initialize
+     * @return true on success
+     */
+    bool cstr_regex_cache_create(_Out_ CStringRegexCache* cache)
+    {
+        if (!cache)
+            return false;
+
+        memset(cache, 0, sizeof(*cache));
+        cache->memory_limit = CSTR_REGEX_CACHE_LIMIT;
+
+        return true;
+    }
+
+    /**
+     * @brief Release matching cache
+     * @param cache Cache to destroy
+     * @return true on success
+     */
+    bool cstr_regex_cache_destroy(_In_ CStringRegexCache* cache)
+    {
+        if (!cache)
+            return false;
+
+        free(cache->pool);
+        free(cache->state_offset);
+        free(cache->state_length);
+        free(cache->state_flags);
+        free(cache->transitions);
+        free(cache->table);
+        free(cache->marks);
+        free(cache->set);
+        free(cache->stack);
+        free(cache->thread_pc[0]);
+        free(cache->thread_pc[1]);
+        free(cache->thread_caps[0]);
+        free(cache->thread_caps[1]);
+        free(cache->caps);
+
+        size_t limit = cache->memory_limit;
+        memset(cache, 0, sizeof(*cache));
+        cache->memory_limit = limit;
+
+        return true;
+    }
+
+    /**
+     * @brief Next closure generation
+     */
+    CSTR_INLINE void cstr_regex_next_generation(_Inout_ CStringRegexCache* cache)
+    {
+        if (++cache->generation == 0)
+        {
+            memset(cache->marks, 0, cache->regex->program_size * sizeof(uint32_t));
+            cache->generation = 1;
+        }
+    }
+
+    /**
+     * @brief Drop all DFA states
+     */
+    CSTR_INLINE void cstr_regex_flush(_Inout_ CStringRegexCache* cache)
+    {
+        cache->flush_states = cache->state_count;
+        cache->flushes++;
+        cache->state_count = 0;
+        cache->pool_size = 0;
+        if (cache->table)
+            memset(cache->table, 0, cache->table_capacity * sizeof(uint32_t));
+        for (int i = 0; i < 4; ++i)
+            cache->starts[i] = -1;
+    }
+
+
+    /**
+     * @brief Bind cache to regex, sizing its buffers
+     * @return true on success
+     */
+    CSTR_INLINE bool cstr_regex_cache_bind(_Inout_ CStringRegexCache* cache, _In_ const CStringRegex* re)
+    {
+        if (cache->regex == re && cache->serial == re->serial)
+            return true;
+
+        cstr_regex_cache_destroy(cache);
+
+        size_t n = re->program_size;
+        size_t slots = re->groups * 2;
+
+        cache->marks = (uint32_t*)calloc(n, sizeof(uint32_t));
+        cache->set = (uint32_t*)malloc(n * sizeof(uint32_t));
+        cache->stack = (CStringRegexFrame*)malloc((2 * n + 2) * sizeof(CStringRegexFrame));
+        cache->thread_pc[0] = (uint32_t*)malloc(n * sizeof(uint32_t));
+        cache->thread_pc[1] = (uint32_t*)malloc(n * sizeof(uint32_t));
+        cache->thread_caps[0] = (size_t*)malloc(n * slots * sizeof(size_t));
+        cache->thread_caps[1] = (size_t*)malloc(n * slots * sizeof(size_t));
+        cache->caps = (size_t*)malloc(slots * sizeof(size_t));
+
+        if (!cache->marks || !cache->set || !cache->stack || !cache->thread_pc[0] || !cache->thread_pc[1] ||
+            !cache->thread_caps[0] || !cache->thread_caps[1] || !cache->caps)
+        {
+            cstr_regex_cache_destroy(cache);
+            return false;
+        }
+
+        cache->regex = re;
+        cache->serial = re->serial;
+        cache->generation = 1;
+        cstr_regex_flush(cache);
+        cache->flushes = 0;
+
+        return true;
+    }
+
+    /**
+     * @brief Add epsilon closure of pc to cache->set
+     * @param context CSTR_REGEX_STATE_BOL if '^' may pass
+     * @note '$' instructions are kept in the set; they only pass at end of input
+     */
+    CSTR_INLINE void cstr_regex_closure(_In_ const CStringRegex* re, _Inout_ CStringRegexCache* cache, _In_ uint32_t pc, _In_ uint8_t context)
+    {
+        size_t top = 0;
+        cache->stack[top++].pc = pc;
+
+        while (top)
+        {
+            pc = cache->stack[--top].pc;
+            if (cache->marks[pc] == cache->generation)
+                continue;
+            cache->marks[pc] = cache->generation;
+
+            const CStringRegexInst* inst = &re->program[pc];
+            switch (inst->op)
+            {
+            case CSTR_REGEX_OP_JMP:
+                cache->stack[top++].pc = inst->x;
+                break;
+            case CSTR_REGEX_OP_SPLIT:
+                cache->stack[top++].pc = inst->y;
+                cache->stack[top++].pc = inst->x;
+                break;
+            case CSTR_REGEX_OP_SAVE:
+                cache->stack[top++].pc = pc + 1;
+                break;
+            case CSTR_REGEX_OP_BOL:
+                if (context & CSTR_REGEX_STATE_BOL)
+                    cache->stack[top++].pc = pc + 1;
+                break;
+            default:
+                cache->set[cache->set_count++] = pc;
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Check whether MATCH is reachable from the set's '$' instructions at end of input
+     */
+    CSTR_INLINE bool cstr_regex_eol_match(_In_ const CStringRegex* re, _Inout_ CStringRegexCache* cache, _In_ uint8_t context)
+    {
+        cstr_regex_next_generation(cache);
+
+        for (size_t i = 0; i < cache->set_count; ++i)
+        {
+            if (re->program[cache->set[i]].op != CSTR_REGEX_OP_EOL)
+                continue;
+
+            size_t top = 0;
+            cache->stack[top++].pc = cache->set[i];
+
+            while (top)
+            {
+                uint32_t pc = cache->stack[--top].pc;
+                if (cache->marks[pc] == cache->generation)
+                    continue;
+                cache->marks[pc] = cache->generation;
+
+                const CStringRegexInst* inst = &re->program[pc];
+                switch (inst->op)
+                {
+                case CSTR_REGEX_OP_MATCH:
+                    return true;
+                case CSTR_REGEX_OP_JMP:
+                    cache->stack[top++].pc = inst->x;
+                    break;
+                case CSTR_REGEX_OP_SPLIT:
+                    cache->stack[top++].pc = inst->y;
+                    cache->stack[top++].pc = inst->x;
+                    break;
+                case CSTR_REGEX_OP_SAVE:
+                case CSTR_REGEX_OP_EOL:
+                    cache->stack[top++].pc = pc + 1;
+                    break;
+                case CSTR_REGEX_OP_BOL:
+                    if (context & CSTR_REGEX_STATE_BOL)
+                        cache->stack[top++].pc = pc + 1;
+                    break;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief qsort() comparator for instruction indices
+     */
+    CSTR_INLINE int cstr_regex_compare_pc(_In_ const void* a, _In_ const void* b)
+    {
+        uint32_t x = *(const uint32_t*)a;
+        uint32_t y = *(const uint32_t*)b;
+        return (x > y) - (x < y);
+    }
+
+    /**
+     * @brief Find or create DFA state for cache->set
+     * @param context CSTR_REGEX_STATE_BOL for start-of-input states
+     * @return State id, or -1 on allocation failure
+     * @note May flush the cache, invalidating all other state ids
+     */
+    CSTR_INLINE int32_t cstr_regex_dfa_state(_In_ const CStringRegex* re, _Inout_ CStringRegexCache* cache, _In_ uint8_t context)
+    {
+        uint32_t* set = cache->set;
+        size_t count = cache->set_count;
+
+        qsort(set, count, sizeof(uint32_t), cstr_regex_compare_pc);
+
+        uint32_t hash = 2166136261u ^ context;
+        for (size_t i = 0; i < count; ++i)
+            hash = (hash ^ set[i]) * 16777619u;
+
+        if (cache->table_capacity)
+        {
+            for (size_t i = hash & (cache->table_capacity - 1);; i = (i + 1) & (cache->table_capacity - 1))
+            {
+                uint32_t id = cache->table[i];
+                if (!id)
+                    break;
+                id--;
+                if (cache->state_length[id] == count && (cache->state_flags[id] & CSTR_REGEX_STATE_BOL) == context &&
+                    memcmp(cache->pool + cache->state_offset[id], set, count * sizeof(uint32_t)) == 0)
+                    return (int32_t)id;
+            }
+        }
+
+        size_t state_bytes = re->alphabet * sizeof(int32_t) + sizeof(size_t) + sizeof(uint32_t) * 3 + 1;
+        size_t used = (cache->pool_size + count) * sizeof(uint32_t) + (cache->state_count + 1) * state_bytes;
+        if (used > cache->memory_limit && cache->state_count)
+            cstr_regex_flush(cache);
+
+        if (cache->state_count == cache->state_capacity)
+        {
+            size_t capacity = cache->state_capacity ? cache->state_capacity * 2 : 64;
+            size_t* offset = (size_t*)realloc(cache->state_offset, capacity * sizeof(size_t));
+            if (offset)
+                cache->state_offset = offset;
+            uint32_t* length = (uint32_t*)realloc(cache->state_length, capacity * sizeof(uint32_t));
+            if (length)
+                cache->state_length = length;
+            uint8_t* flags = (uint8_t*)realloc(cache->state_flags, capacity);
+            if (flags)
+                cache->state_flags = flags;
+            int32_t* transitions = (int32_t*)realloc(cache->transitions, capacity * re->alphabet * sizeof(int32_t));
+            if (transitions)
+                cache->transitions = transitions;
+            if (!offset || !length || !flags || !transitions)
+                return -1;
+            cache->state_capacity = capacity;
+        }
+
+        if ((cache->state_count + 1) * 2 > cache->table_capacity)
+        {
+            size_t capacity = cache->table_capacity ? cache->table_capacity * 2 : 128;
+            uint32_t* table = (uint32_t*)calloc(capacity, sizeof(uint32_t));
+            if (!table)
+                return -1;
+
+            for (size_t id = 0; id < cache->state_count; ++id)
+            {
+                uint32_t h = 2166136261u ^ (cache->state_flags[id] & CSTR_REGEX_STATE_BOL);
+                for (uint32_t k = 0; k < cache->state_length[id]; ++k)
+                    h = (h ^ cache->pool[cache->state_offset[id] + k]) * 16777619u;
+                size_t j = h & (capacity - 1);
+                while (table[j])
+                    j = (j + 1) & (capacity - 1);
+                table[j] = (uint32_t)id + 1;
+            }
+
+            free(cache->table);
+            cache->table = table;
+            cache->table_capacity = capacity;
+        }
+
+        if (cache->pool_size + count > cache->pool_capacity)
+        {
+            size_t capacity = cache->pool_capacity ? cache->pool_capacity : 1024;
+            while (capacity < cache->pool_size + count)
+                capacity *= 2;
+            uint32_t* pool = (uint32_t*)realloc(cache->pool, capacity * sizeof(uint32_t));
+            if (!pool)
+                return -1;
+            cache->pool = pool;
+            cache->pool_capacity = capacity;
+        }
+
+        uint8_t flags = context;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (re->program[set[i]].op == CSTR_REGEX_OP_MATCH)
+                flags |= CSTR_REGEX_STATE_MATCH | CSTR_REGEX_STATE_EOL_MATCH;
+        }
+        if (!(flags & CSTR_REGEX_STATE_EOL_MATCH) && cstr_regex_eol_match(re, cache, context))
+            flags |= CSTR_REGEX_STATE_EOL_MATCH;
+
+        size_t id = cache->state_count++;
+        cache->state_offset[id] = cache->pool_size;
+        cache->state_length[id] = (uint32_t)count;
+        cache->state_flags[id] = flags;
+        memcpy(cache->pool + cache->pool_size, set, count * sizeof(uint32_t));
+        cache->pool_size += count;
+
+        int32_t* row = cache->transitions + id * re->alphabet;
+        for (size_t i = 0; i < re->alphabet; ++i)
+            row[i] = -1;
+
+        size_t slot = hash & (cache->table_capacity - 1);
+        while (cache->table[slot])
+            slot = (slot + 1) & (cache->table_capacity - 1);
+        cache->table[slot] = (uint32_t)id + 1;
+
+        return (int32_t)id;
+    }
+
+    /**
+     * @brief Get start state
+     * @return State id or -1 on allocation failure
+     */
+    CSTR_INLINE int32_t cstr_regex_dfa_start(_In_ const CStringRegex* re, _Inout_ CStringRegexCache* cache, _In_ bool anchored, _In_ bool bol)
+    {
+        int index = (anchored ? 2 : 0) | (bol ? 1 : 0);
+        if (cache->starts[index] >= 0)
+            return cache->starts[index];
+
+        uint8_t context = bol ? CSTR_REGEX_STATE_BOL : 0;
+
+        cstr_regex_next_generation(cache);
+        cache->set_count = 0;
+        cstr_regex_closure(re, cache, anchored ? re->anchored_start : re->unanchored_start, context);
+
+        int32_t state = cstr_regex_dfa_state(re, cache, context);
+        cache->starts[index] = state;
+
+        return state;
+    }
+
+    /**
+     * @brief Compute (and cache) transition of state on alphabet symbol
+     * @return Next state id or -1 on allocation failure
+     */
+    CSTR_INLINE int32_t cstr_regex_dfa_step(_In_ const CStringRegex* re, _Inout_ CStringRegexCache* cache, _In_ int32_t state, _In_ uint8_t symbol)
+    {
+        uint8_t byte = re->representatives[symbol];
+
+        cstr_regex_next_generation(cache);
+        cache->set_count = 0;
+
+        const uint32_t* members = cache->pool + cache->state_offset[state];
+        for (uint32_t i = 0; i < cache->state_length[state]; ++i)
+        {
+            const CStringRegexInst* inst = &re->program[members[i]];
+            if (inst->op == CSTR_REGEX_OP_CLASS && cstr_regex_class_has(re->classes + (size_t)inst->x * 4, byte))
+                cstr_regex_closure(re, cache, members[i] + 1, 0);
+        }
+
+        size_t flushes = cache->flushes;
+        int32_t next = cstr_regex_dfa_state(re, cache, 0);
+
+        if (next >= 0 && flushes == cache->flushes)
+            cache->transitions[(size_t)state * re->alphabet + symbol] = next;
+
+        return next;
+    }
+
+    /**
+     * @brief Run DFA over input
+     * @param pos      First byte to scan
+     * @param anchored Match must start at pos
+     * @param full     Match must end at end of input (otherwise stop at the earliest match)
+     * @return 1 on match, 0 on no match, -1 if the DFA gave up
+     * @note Gives up when the cache thrashes (flushes faster than input is consumed)
+     */
+    CSTR_INLINE int cstr_regex_dfa_run(_In_ const CStringRegex* re, _Inout_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length, _In_ size_t pos, _In_ bool anchored, _In_ bool full)
+    {
+        int32_t state = cstr_regex_dfa_start(re, cache, anchored, pos == 0);
+        if (state < 0)
+            return -1;
+
+        const uint8_t* bytes = (const uint8_t*)data;
+        size_t flushes = cache->flushes;
+        size_t last_flush = pos;
+
+        for (size_t i = pos; i < length; ++i)
+        {
+            if (!full && (cache->state_flags[state] & CSTR_REGEX_STATE_MATCH))
+                return 1;
+
+            uint8_t symbol = re->byte_map[bytes[i]];
+            int32_t next = cache->transitions[(size_t)state * re->alphabet + symbol];
+            if (next < 0)
+            {
+                next = cstr_regex_dfa_step(re, cache, state, symbol);
+                if (next < 0)
+                    return -1;
+
+                if (cache->flushes != flushes)
+                {
+                    if (cache->flushes - flushes > 1 && i - last_flush < 10 * cache->flush_states)
+                        return -1;
+                    last_flush = i;
+                }
+            }
+
+            // Empty set: no thread survives, nothing can match any more
+            if (cache->state_length[next] == 0)
+                return 0;
+
+            state = next;
+        }
+
+        return (cache->state_flags[state] & CSTR_REGEX_STATE_EOL_MATCH) ? 1 : 0;
+    }
+
+    /**
+     * @brief Add Pike VM thread with its epsilon closure
+     * @param list Thread list (0 or 1)
+     * @param pc   First instruction
+     * @param pos   Input position of the thread
+     * @param slots Capture slots kept per thread
+     * @note cache->caps holds the thread's slots; it is restored before returning
+     */
+    CSTR_INLINE void cstr_regex_add_thread(_In_ const CStringRegex* re, _Inout_ CStringRegexCache* cache, _In_ int list, _In_ uint32_t pc, _In_ size_t pos, _In_ size_t length, _In_ size_t slots)
+    {
+        size_t top = 0;
+
+        cache->stack[top].pc = pc;
+        top++;
+
+        while (top)
+        {
+            CStringRegexFrame frame = cache->stack[--top];
+            if (frame.pc == CSTR_REGEX_NONE)
+            {
+                cache->caps[frame.slot] = frame.value;
+                continue;
+            }
+
+            pc = frame.pc;
+            if (cache->marks[pc] == cache->generation)
+                continue;
+            cache->marks[pc] = cache->generation;
+
+            const CStringRegexInst* inst = &re->program[pc];
+            switch (inst->op)
+            {
+            case CSTR_REGEX_OP_JMP:
+                cache->stack[top++].pc = inst->x;
+                break;
+            case CSTR_REGEX_OP_SPLIT:
+                cache->stack[top++].pc = inst->y;
+                cache->stack[top++].pc = inst->x;
+                break;
+            case CSTR_REGEX_OP_SAVE:
+                cache->stack[top].pc = CSTR_REGEX_NONE;
+                cache->stack[top].slot = inst->x;
+                cache->stack[top].value = cache->caps[inst->x];
+                top++;
+                cache->caps[inst->x] = pos;
+                cache->stack[top++].pc = pc + 1;
+                break;
+            case CSTR_REGEX_OP_BOL:
+                if (pos == 0)
+                    cache->stack[top++].pc = pc + 1;
+                break;
+            case CSTR_REGEX_OP_EOL:
+                if (pos == length)
+                    cache->stack[top++].pc = pc + 1;
+                break;
+            default:
+            {
+                size_t n = cache->thread_count[list]++;
+                cache->thread_pc[list][n] = pc;
+                memcpy(cache->thread_caps[list] + n * slots, cache->caps, slots * sizeof(size_t));
+                break;
+            }
+            }
+        }
+    }
+
+    /**
+     * @brief Run Pike VM (leftmost-first semantics, as in Perl)
+     * @param pos      First byte to scan
+     * @param anchored Match must start at pos
+     * @param full     Match must end at end of input
+     * @param slots    Capture slots to track (2 for the match bounds only)
+     * @param caps     Receives slots values
+     * @return true on match
+     */
+    CSTR_INLINE bool cstr_regex_pike(_In_ const CStringRegex* re, _Inout_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length, _In_ size_t pos, _In_ bool anchored, _In_ bool full, _In_ size_t slots, _Out_writes_(slots) size_t* caps)
+    {
+        bool matched = false;
+        int current = 0;
+
+        for (size_t i = 0; i < re->groups * 2; ++i)
+            cache->caps[i] = cstr_invalid;
+
+        cstr_regex_next_generation(cache);
+        cache->thread_count[0] = 0;
+        cstr_regex_add_thread(re, cache, 0, anchored ? re->anchored_start : re->unanchored_start, pos, length, slots);
+
+        for (size_t i = pos;; ++i)
+        {
+            if (!cache->thread_count[current])
+                break;
+
+            int next = current ^ 1;
+            cstr_regex_next_generation(cache);
+            cache->thread_count[next] = 0;
+
+            for (size_t t = 0; t < cache->thread_count[current]; ++t)
+            {
+                uint32_t pc = cache->thread_pc[current][t];
+                const size_t* thread_caps = cache->thread_caps[current] + t * slots;
+                const CStringRegexInst* inst = &re->program[pc];
+
+                if (inst->op == CSTR_REGEX_OP_MATCH)
+                {
+                    if (full && i != length)
+                        continue;
+
+                    // Lower-priority threads can only produce less preferred matches
+                    matched = true;
+                    memcpy(caps, thread_caps, slots * sizeof(size_t));
+                    break;
+                }
+
+                if (i < length && cstr_regex_class_has(re->classes + (size_t)inst->x * 4, (uint8_t)data[i]))
+                {
+                    memcpy(cache->caps, thread_caps, slots * sizeof(size_t));
+                    cstr_regex_add_thread(re, cache, next, pc + 1, i + 1, length, slots);
+                }
+            }
+
+            current = next;
+            if (i >= length)
+                break;
+        }
+
+        return matched;
+    }
+
+    /**
+     * @brief Run prefilter, DFA and (when needed) Pike VM on a bound cache
+     * @param mode See cstr_regex_execute()
+     * @return true on match
+     */
+    CSTR_INLINE bool cstr_regex_run(_In_ const CStringRegex* re, _Inout_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length, _In_ int mode, _Out_opt_ size_t* caps)
+    {
+        bool full = mode == 2;
+        bool anchored = re->anchored || full;
+        size_t pos = 0;
+
+        // Literal prefilter: no match can start before the first prefix occurrence
+        if (re->prefix_length && !anchored)
+        {
+            CStringView haystack = { data, length };
+            CStringView needle = { re->prefix, re->prefix_length };
+            pos = cstr_view_find(haystack, needle);
+            if (pos == cstr_invalid)
+                return false;
+        }
+
+        int dfa = cstr_regex_dfa_run(re, cache, data, length, pos, anchored, full);
+        if (dfa == 0)
+            return false;
+        if (dfa == 1 && (mode == 0 || mode == 2))
+            return true;
+
+        size_t* slots = caps;
+        size_t bounds[2];
+        if (!slots)
+            slots = bounds;
+
+        // Outside capture mode only group 0 is copied between threads
+        return cstr_regex_pike(re, cache, data, length, pos, anchored, full, mode == 3 ? re->groups * 2 : 2, slots);
+    }
+
+    /**
+     * @brief Run matcher with a caller cache or a temporary one
+     * @param mode 0 = any match (DFA only), 1 = find bounds, 2 = full match, 3 = captures
+     * @return true on match
+     */
+    bool cstr_regex_execute(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length, _In_ int mode, _Out_opt_ size_t* caps)
+    {
+        CStringRegexCache local;
+        if (!cache)
+        {
+            cstr_regex_cache_create(&local);
+            cache = &local;
+        }
+
+        bool out = cstr_regex_cache_bind(cache, re) && cstr_regex_run(re, cache, data, length, mode, caps);
+
+        if (cache == &local)
+            cstr_regex_cache_destroy(&local);
+
+        return out;
+    }
+
+    /**
+     * @brief Find leftmost match
+     * @param re     Compiled regex
+     * @param cache  Per-thread cache, or NULL for a temporary one
+     * @param data   Input bytes
+     * @param length Input length
+     * @param start  Receives match start (optional)
+     * @param end    Receives match end (optional)
+     * @return true if the input contains a match
+     * @note With start and end both NULL only the DFA runs
+     */
+    bool cstr_regex_find(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length, _Out_opt_ size_t* start, _Out_opt_ size_t* end)
+    {
+        if (!re || !re->program || (!data && length))
+            return false;
+
+        size_t bounds[2];
+        bool want = start || end;
+
+        if (!cstr_regex_execute(re, cache, data, length, want ? 1 : 0, bounds))
+            return false;
+
+        if (start)
+            *start = bounds[0];
+        if (end)
+            *end = bounds[1];
+
+        return true;
+    }
+
+    /**
+     * @brief Check whether whole input matches
+     * @param re     Compiled regex
+     * @param cache  Per-thread cache, or NULL for a temporary one
+     * @param data   Input bytes
+     * @param length Input length
+     * @return true if the pattern matches all of the input
+     */
+    bool cstr_regex_match(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length)
+    {
+        if (!re || !re->program || (!data && length))
+            return false;
+
+        return cstr_regex_execute(re, cache, data, length, 2, NULL);
+    }
+
+    /**
+     * @brief Find leftmost match with capture groups
+     * @param re     Compiled regex
+     * @param cache  Per-thread cache, or NULL for a temporary one
+     * @param data   Input bytes
+     * @param length Input length
+     * @param groups Receives up to count spans; groups[0] is the whole match
+     * @param count  Number of entries in groups
+     * @return true if the input contains a match
+     */
+    bool cstr_regex_captures(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_reads_(length) const char* data, _In_ size_t length, _Out_writes_(count) CStringRegexMatch* groups, _In_ size_t count)
+    {
+        if (!re || !re->program || !groups || (!data && length))
+            return false;
+
+        size_t* slots = (size_t*)malloc(re->groups * 2 * sizeof(size_t));
+        if (!slots)
+            return false;
+
+        bool out = cstr_regex_execute(re, cache, data, length, 3, slots);
+        if (out)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                bool set = i < re->groups && slots[i * 2] != cstr_invalid && slots[i * 2 + 1] != cstr_invalid;
+                groups[i].start = set ? slots[i * 2] : cstr_invalid;
+                groups[i].end = set ? slots[i * 2 + 1] : cstr_invalid;
+            }
+        }
+
+        free(slots);
+
+        return out;
+    }
+
+    /**
+     * @brief Find leftmost match in CString
+     * @param re    Compiled regex
+     * @param cache Per-thread cache, or NULL for a temporary one
+     * @param obj   CString to search
+     * @param start Receives match start (optional)
+     * @param end   Receives match end (optional)
+     * @return true if the string contains a match
+     */
+    bool cstr_regex_find_cstr(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_ CString* obj, _Out_opt_ size_t* start, _Out_opt_ size_t* end)
+    {
+        if (!obj)
+            return false;
+
+        cstr_lock(obj);
+
+        bool out = cstr_regex_find(re, cache, obj->data, obj->length, start, end);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+    /**
+     * @brief Check whether whole CString matches
+     * @param re    Compiled regex
+     * @param cache Per-thread cache, or NULL for a temporary one
+     * @param obj   CString to test
+     * @return true if the pattern matches all of the string
+     */
+    bool cstr_regex_match_cstr(_In_ const CStringRegex* re, _Inout_opt_ CStringRegexCache* cache, _In_ CString* obj)
+    {
+        if (!obj)
+            return false;
+
+        cstr_lock(obj);
+
+        bool out = cstr_regex_match(re, cache, obj->data, obj->length);
+
+        cstr_unlock(obj);
+
+        return out;
+    }
+
+#endif // CSTR_IMPLEMENT_REGEX
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_REGEX_H
@@ -0,0 +1,636 @@
+#pragma once
+
+/**
+ * @file cstr_sort.h
+ * @brief Cache-efficient string sorting (MSD radix + multikey quicksort).
+ */
+
+#ifndef CSTR_SORT_H
+#define CSTR_SORT_H
+
+#include "cstr.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @def CSTR_SORT_INSERTION_THRESHOLD
+     * @brief Partitions smaller than this are finished with insertion sort
+     */
+#ifndef CSTR_SORT_INSERTION_THRESHOLD
+#define CSTR_SORT_INSERTION_THRESHOLD 16
+#endif
+
+    /**
+     * @def CSTR_SORT_RADIX_THRESHOLD
+     * @brief Inputs of at least this size start with a 2-byte MSD radix pass
+     */
+#ifndef CSTR_SORT_RADIX_THRESHOLD
+#define CSTR_SORT_RADIX_THRESHOLD 65536
+#endif
+
+    /**
+     * @def CSTR_SORT_PARALLEL_THRESHOLD
+     * @brief Inputs of at least this size sort radix buckets on worker threads
+     */
+#ifndef CSTR_SORT_PARALLEL_THRESHOLD
+#define CSTR_SORT_PARALLEL_THRESHOLD 262144
+#endif
+
+#define CSTR_SORT_BUCKETS (257 * 257)  ///< Radix buckets: (end or byte) x (end or byte)
+#define CSTR_SORT_MAX_THREADS 64       ///< Limit imposed by WaitForMultipleObjects
+#define CSTR_SORT_SPLIT_FACTOR 8       ///< Parallel buckets above count / (threads * factor) are split further
+
+#ifdef _MSC_VER
+#define CSTR_BSWAP64(x) _byteswap_uint64(x)
+#else
+#define CSTR_BSWAP64(x) __builtin_bswap64(x)
+#endif
+
+    /**
+     * @struct CStringSortEntry
+     * @brief Sort record with cached key prefix
+     *
+     * @var key    - Next 8 bytes from the current depth, big-endian, zero padded
+     * @var data   - String bytes
+     * @var length - String length
+     * @var index  - Original position of the string
+     */
+    typedef struct
+    {
+        uint64_t key;          ///< Cached prefix at current depth
+        const uint8_t* data;   ///< String bytes
+        size_t length;         ///< String length
+        size_t index;          ///< Original position
+    }CStringSortEntry;
+
+    /**
+     * @struct CStringSortTask
+     * @brief Range of entries sharing their first depth bytes
+     */
+    typedef struct
+    {
+        size_t begin;   ///< First entry
+        size_t count;   ///< Number of entries
+        size_t depth;   ///< Common prefix length
+    }CStringSortTask;
+
+    /**
+     * @struct CStringSortJob
+     * @brief Shared state of parallel bucket sorting
+     */
+    typedef struct
+    {
+        CStringSortEntry* entries;   ///< Distributed entries
+        CStringSortTask* tasks;      ///< Ranges left to sort
+        size_t task_count;           ///< Number of tasks
+        size_t task_capacity;        ///< Allocated tasks
+        volatile LONG next;          ///< Next task to claim
+    }CStringSortJob;
+
+    CSTR_API bool cstr_sort_views(_Inout_updates_(count) CStringView* views, _In_ size_t count);
+    CSTR_API bool cstr_sort_cstrs(_Inout_updates_(count) CString* objs, _In_ size_t count);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_SORT)
+
+    /**
+     * @brief Load cached key of a sort entry at given depth
+     * @param entry Sort entry to update
+     * @param depth Byte offset of the key
+     */
+    CSTR_INLINE void cstr_sort_load_key(_Inout_ CStringSortEntry* entry, _In_ size_t depth)
+    {
+        size_t avail = entry->length > depth ? entry->length - depth : 0;
+
+        if (avail >= 8)
+        {
+            uint64_t raw;
+            memcpy(&raw, entry->data + depth, 8);
+            entry->key = CSTR_BSWAP64(raw);
+            return;
+        }
+
+        uint64_t key = 0;
+        for (size_t i = 0; i < avail; ++i)
+            key |= (uint64_t)entry->data[depth + i] << (56 - 8 * i);
+
+        entry->key = key;
+    }
+
+    /**
+     * @brief Compare two entries by cached key at given depth
+     * @return Negative, zero or positive
+     * @note Zero means equal in all bytes covered by the key window
+     */
+    CSTR_INLINE int cstr_sort_key_compare(_In_ const CStringSortEntry* a, _In_ const CStringSortEntry* b, _In_ size_t depth)
+    {
+        if (a->key != b->key)
+            return a->key < b->key ? -1 : 1;
+
+        // Equal keys: shorter remainder wins, padding zeros are not data
+        size_t avail_a = a->length > depth ? a->length - depth : 0;
+        size_t avail_b = b->length > depth ? b->length - depth : 0;
+        if (avail_a > 8)
+            avail_a = 8;
+        if (avail_b > 8)
+            avail_b = 8;
+
+        return (avail_a > avail_b) - (avail_a < avail_b);
+    }
+
+    /**
+     * @brief Full comparison of two entries known equal before depth
+     * @return Negative, zero or positive
+     */
+    CSTR_INLINE int cstr_sort_entry_compare(_In_ const CStringSortEntry* a, _In_ const CStringSortEntry* b, _In_ size_t depth)
+    {
+        int cmp = cstr_sort_key_compare(a, b, depth);
+        if (cmp != 0 || a->length < depth + 8)
+            return cmp;
+
+        // Both extend through the key window; compare what follows it
+        CStringView va = { (const char*)a->data + depth + 8, a->length - depth - 8 };
+        CStringView vb = { (const char*)b->data + depth + 8, b->length - depth - 8 };
+
+        return cstr_view_compare(va, vb);
+    }
+
+    /**
+     * @brief Multikey quicksort of entries sharing their first depth bytes
+     * @param entries Entries with keys loaded at depth
+     * @param count   Number of entries
+     * @param depth   Common prefix length
+     * @note Recursion depth is O(log count); the largest partition is handled iteratively
+     */
+    CSTR_INLINE void cstr_sort_mkqs(_Inout_updates_(count) CStringSortEntry* entries, _In_ size_t count, _In_ size_t depth)
+    {
+        while (count > 1)
+        {
+            if (count < CSTR_SORT_INSERTION_THRESHOLD)
+            {
+                for (size_t i = 1; i < count; ++i)
+                {
+                    CStringSortEntry tmp = entries[i];
+                    size_t j = i;
+                    while (j > 0 && cstr_sort_entry_compare(&tmp, &entries[j - 1], depth) < 0)
+                    {
+                        entries[j] = entries[j - 1];
+                        j--;
+                    }
+                    entries[j] = tmp;
+                }
+                return;
+            }
+
+            // Median of three
+            CStringSortEntry* a = &entries[0];
+            CStringSortEntry* b = &entries[count / 2];
+            CStringSortEntry* c = &entries[count - 1];
+            CStringSortEntry* m = b;
+            if (cstr_sort_key_compare(a, b, depth) < 0)
+            {
+                if (cstr_sort_key_compare(b, c, depth) > 0)
+                    m = cstr_sort_key_compare(a, c, depth) < 0 ? c : a;
+            }
+            else if (cstr_sort_key_compare(b, c, depth) < 0)
+            {
+                m = cstr_sort_key_compare(a, c, depth) < 0 ? a : c;
+            }
+            CStringSortEntry pivot = *m;
+
+            // Three-way partition: [0, lt) < pivot, [lt, gt) == pivot, [gt, count) > pivot
+            size_t lt = 0;
+            size_t gt = count;
+            size_t i = 0;
+            while (i < gt)
+            {
+                int cmp = cstr_sort_key_compare(&entries[i], &pivot, depth);
+                if (cmp < 0)
+                {
+                    CStringSortEntry tmp = entries[i];
+                    entries[i++] = entries[lt];
+                    entries[lt++] = tmp;
+                }
+                else if (cmp > 0)
+                {
+                    CStringSortEntry tmp = entries[i];
+                    entries[i] = entries[--gt];
+                    entries[gt] = tmp;
+                }
+                else
+                {
+                    i++;
+                }
+            }
+
+            size_t less = lt;
+            size_t greater = count - gt;
+            // Equal partition either ended inside the key window or continues deeper
+            size_t equal = pivot.length < depth + 8 ? 0 : gt - lt;
+
+            // Recurse into the two smaller partitions and loop on the largest,
+            // so the stack depth stays O(log count) for any input
+            if (equal >= less && equal >= greater)
+            {
+                cstr_sort_mkqs(entries, less, depth);
+                cstr_sort_mkqs(entries + gt, greater, depth);
+
+                entries += lt;
+                count = equal;
+                depth += 8;
+
+                for (size_t k = 0; k < count; ++k)
+                    cstr_sort_load_key(&entries[k], depth);
+                continue;
+            }
+
+            if (equal)
+            {
+                for (size_t k = lt; k < gt; ++k)
+                    cstr_sort_load_key(&entries[k], depth + 8);
+                cstr_sort_mkqs(entries + lt, equal, depth + 8);
+            }
+
+            if (less >= greater)
+            {
+                cstr_sort_mkqs(entries + gt, greater, depth);
+                count = less;
+            }
+            else
+            {
+                cstr_sort_mkqs(entries, less, depth);
+                entries += gt;
+                count = greater;
+            }
+        }
+    }
+
+    /**
+     * @brief Radix bucket of an entry (first two bytes, end-of-string aware)
+     */
+    CSTR_INLINE size_t cstr_sort_bucket(_In_ const CStringSortEntry* entry)
+    {
+        size_t b0 = entry->length >= 1 ? 1 + (size_t)(entry->key >> 56) : 0;
+        size_t b1 = entry->length >= 2 ? 1 + (size_t)((entry->key >> 48) & 0xFF) : 0;
+        return b0 * 257 + b1;
+    }
+
+    /**
+     * @brief Append a task to the job
+     * @return false on allocation failure
+     */
+    CSTR_INLINE bool cstr_sort_add_task(_Inout_ CStringSortJob* job, _In_ size_t begin, _In_ size_t count, _In_ size_t depth)
+    {
+        if (job->task_count == job->task_capacity)
+        {
+            size_t new_capacity = job->task_capacity ? job->task_capacity * 2 : 1024;
+            CStringSortTask* tasks = (CStringSortTask*)realloc(job->tasks, new_capacity * sizeof(CStringSortTask));
+            if (!tasks)
+                return false;
+
+            job->tasks = tasks;
+            job->task_capacity = new_capacity;
+        }
+
+        CStringSortTask* task = &job->tasks[job->task_count++];
+        task->begin = begin;
+        task->count = count;
+        task->depth = depth;
+
+        return true;
+    }
+
+    /**
+     * @brief Split a task by the byte at its depth until no piece exceeds limit
+     * @param job     Job whose task list receives the pieces
+     * @param index   Task to split; replaced by its first piece
+     * @param scratch Buffer of at least the task's entry count
+     * @param limit   Largest piece left whole
+     * @return false on allocation failure
+     * @note Ranges whose strings all continue with the same byte only advance
+     *       their depth, so a long shared prefix costs no data movement
+     */
+    CSTR_INLINE bool cstr_sort_split(_Inout_ CStringSortJob* job, _In_ size_t index, _Inout_ CStringSortEntry* scratch, _In_ size_t limit)
+    {
+        while (job->tasks[index].count > limit)
+        {
+            CStringSortTask task = job->tasks[index];
+            CStringSortEntry* entries = job->entries + task.begin;
+
+            // Slot 0 holds strings ending at depth, slot 1 + b those continuing with byte b
+            size_t bounds[258] = { 0 };
+            for (size_t i = 0; i < task.count; ++i)
+            {
+                size_t slot = entries[i].length > task.depth ? 1 + (size_t)entries[i].data[task.depth] : 0;
+                bounds[slot + 1]++;
+            }
+
+            // Strings that end here are equal to each other
+            if (bounds[1] == task.count)
+            {
+                job->tasks[index].count = 0;
+                return true;
+            }
+
+            bool single = false;
+            for (size_t slot = 1; slot < 257; ++slot)
+            {
+                if (bounds[slot + 1] == task.count)
+                {
+                    single = true;
+                    break;
+                }
+            }
+            if (single)
+            {
+                job->tasks[index].depth++;
+                continue;
+            }
+
+            for (size_t slot = 0; slot < 257; ++slot)
+                bounds[slot + 1] += bounds[slot];
+
+            for (size_t i = 0; i < task.count; ++i)
+            {
+                size_t slot = entries[i].length > task.depth ? 1 + (size_t)entries[i].data[task.depth] : 0;
+                scratch[bounds[slot]++] = entries[i];
+            }
+            memcpy(entries, scratch, task.count * sizeof(CStringSortEntry));
+
+            // bounds[slot] now ends slot; the first piece takes over this task
+            bool first = true;
+            size_t start = bounds[0];
+            for (size_t slot = 1; slot < 257; ++slot)
+            {
+                size_t count = bounds[slot] - start;
+                if (count > 1)
+                {
+                    if (first)
+                    {
+                        job->tasks[index].begin = task.begin + start;
+                        job->tasks[index].count = count;
+                        job->tasks[index].depth = task.depth + 1;
+                        first = false;
+                    }
+                    else if (!cstr_sort_add_task(job, task.begin + start, count, task.depth + 1))
+                    {
+                        return false;
+                    }
+                }
+                start = bounds[slot];
+            }
+
+            if (first)
+                job->tasks[index].count = 0;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Sort one task
+     */
+    CSTR_INLINE void cstr_sort_run_task(_In_ CStringSortJob* job, _In_ const CStringSortTask* task)
+    {
+        if (task->count < 2)
+            return;
+
+        CStringSortEntry* entries = job->entries + task->begin;
+
+        // Radix buckets keep their depth-0 keys; split pieces reload theirs
+        if (task->depth)
+        {
+            for (size_t i = 0; i < task->count; ++i)
+                cstr_sort_load_key(&entries[i], task->depth);
+        }
+
+        cstr_sort_mkqs(entries, task->count, task->depth);
+    }
+
+    /**
+     * @brief Worker thread: claim and sort tasks until none remain
+     */
+    CSTR_INLINE DWORD WINAPI cstr_sort_worker(_In_ LPVOID param)
+    {
+        CStringSortJob* job = (CStringSortJob*)param;
+
+        for (;;)
+        {
+            size_t index = (size_t)(InterlockedIncrement(&job->next) - 1);
+            if (index >= job->task_count)
+                break;
+            cstr_sort_run_task(job, &job->tasks[index]);
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief Sort prepared entries
+     * @param entries Entries (data, length, index set)
+     * @param count   Number of entries
+     * @return true on success, false on allocation failure
+     * @note Large inputs get a 2-byte MSD radix pass whose buckets are
+     *       finished by multikey quicksort. Inputs big enough to sort in
+     *       parallel split oversized buckets at the following bytes first,
+     *       so shared prefixes still spread over all threads
+     */
+    CSTR_INLINE bool cstr_sort_entries(_Inout_updates_(count) CStringSortEntry* entries, _In_ size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            cstr_sort_load_key(&entries[i], 0);
+
+        if (count < CSTR_SORT_RADIX_THRESHOLD)
+        {
+            cstr_sort_mkqs(entries, count, 0);
+            return true;
+        }
+
+        size_t* bounds = (size_t*)calloc(CSTR_SORT_BUCKETS + 1, sizeof(size_t));
+        CStringSortEntry* scratch = (CStringSortEntry*)malloc(count * sizeof(CStringSortEntry));
+        if (!bounds || !scratch)
+        {
+            free(bounds);
+            free(scratch);
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            bounds[cstr_sort_bucket(&entries[i]) + 1]++;
+        for (size_t b = 0; b < CSTR_SORT_BUCKETS; ++b)
+            bounds[b + 1] += bounds[b];
+
+        // bounds[b] is used as a fill cursor, then restored
+        for (size_t i = 0; i < count; ++i)
+            scratch[bounds[cstr_sort_bucket(&entries[i])]++] = entries[i];
+        memmove(bounds + 1, bounds, CSTR_SORT_BUCKETS * sizeof(size_t));
+        bounds[0] = 0;
+        memcpy(entries, scratch, count * sizeof(CStringSortEntry));
+
+        CStringSortJob job;
+        job.entries = entries;
+        job.tasks = NULL;
+        job.task_count = 0;
+        job.task_capacity = 0;
+        job.next = 0;
+
+        // Bucket fixes both leading bytes; the 8-byte keys are still valid at depth 0
+        bool out = true;
+        for (size_t b = 0; b < CSTR_SORT_BUCKETS && out; ++b)
+        {
+            if (bounds[b + 1] - bounds[b] > 1)
+                out = cstr_sort_add_task(&job, bounds[b], bounds[b + 1] - bounds[b], 0);
+        }
+        free(bounds);
+
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        DWORD threads = info.dwNumberOfProcessors;
+        if (threads > CSTR_SORT_MAX_THREADS)
+            threads = CSTR_SORT_MAX_THREADS;
+        if (count < CSTR_SORT_PARALLEL_THRESHOLD)
+            threads = 1;
+
+        if (out && threads > 1)
+        {
+            size_t limit = count / ((size_t)threads * CSTR_SORT_SPLIT_FACTOR);
+            for (size_t t = 0; t < job.task_count && out; ++t)
+                out = cstr_sort_split(&job, t, scratch, limit);
+        }
+        free(scratch);
+
+        if (!out)
+        {
+            free(job.tasks);
+            return false;
+        }
+
+        HANDLE handles[CSTR_SORT_MAX_THREADS];
+        DWORD started = 0;
+
+        // The calling thread works too
+        for (DWORD t = 1; t < threads; ++t)
+        {
+            HANDLE handle = CreateThread(NULL, 0, cstr_sort_worker, &job, 0, NULL);
+            if (handle == NULL)
+                break;
+            handles[started++] = handle;
+        }
+
+        cstr_sort_worker(&job);
+
+        if (started)
+        {
+            WaitForMultipleObjects(started, handles, TRUE, INFINITE);
+            for (DWORD t = 0; t < started; ++t)
+                CloseHandle(handles[t]);
+        }
+
+        free(job.tasks);
+
+        return true;
+    }
+
+    /**
+     * @brief Sort views in binary-safe lexicographic order
+     * @param views Views to sort in place
+     * @param count Number of views
+     * @return true on success, false on allocation failure
+     * @note Orders by (data, length) like cstr_view_compare()
+     */
+    bool cstr_sort_views(_Inout_updates_(count) CStringView* views, _In_ size_t count)
+    {
+        if (!views && count)
+            return false;
+
+        if (count < 2)
+            return true;
+
+        CStringSortEntry* entries = (CStringSortEntry*)malloc(count * sizeof(CStringSortEntry));
+        if (!entries)
+            return false;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            entries[i].data = (const uint8_t*)views[i].data;
+            entries[i].length = views[i].length;
+            entries[i].index = i;
+        }
+
+        if (!cstr_sort_entries(entries, count))
+        {
+            free(entries);
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            views[i].data = (const char*)entries[i].data;
+            views[i].length = entries[i].length;
+        }
+
+        free(entries);
+
+        return true;
+    }
+
+    /**
+     * @brief Sort CString objects by contents
+     * @param objs  Array of CString objects to reorder in place
+     * @param count Number of objects
+     * @return true on success, false on allocation failure
+     * @note Each object is locked once to snapshot its contents, not per comparison
+     * @warning Caller must ensure no other thread uses the objects while sorting
+     */
+    bool cstr_sort_cstrs(_Inout_updates_(count) CString* objs, _In_ size_t count)
+    {
+        if (!objs && count)
+            return false;
+
+        if (count < 2)
+            return true;
+
+        CStringSortEntry* entries = (CStringSortEntry*)malloc(count * sizeof(CStringSortEntry));
+        CString* moved = (CString*)malloc(count * sizeof(CString));
+        if (!entries || !moved)
+        {
+            free(entries);
+            free(moved);
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            cstr_lock(&objs[i]);
+            entries[i].data = (const uint8_t*)objs[i].data;
+            entries[i].length = objs[i].length;
+            entries[i].index = i;
+            cstr_unlock(&objs[i]);
+        }
+
+        if (!cstr_sort_entries(entries, count))
+        {
+            free(entries);
+            free(moved);
+            return false;
+        }
+
+        memcpy(moved, objs, count * sizeof(CString));
+        for (size_t i = 0; i < count; ++i)
+            objs[i] = moved[entries[i].index];
+
+        free(moved);
+        free(entries);
+
+        return true;
+    }
+
+#endif // CSTR_IMPLEMENT_SORT
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_SORT_H
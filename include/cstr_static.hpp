@@ -0,0 +1,566 @@
+#pragma once
+
+/**
+ * @file cstr_static.hpp
+ * @brief Compile-time character sets, tokenizers and needle searchers (C++20).
+ *
+ * Delimiters, zone pairs, escapes and needles given as string literal
+ * template arguments become constexpr tables, and each call site gets a
+ * kernel specialized for its literal. Examples: a one-character set scans
+ * with memchr(), small sets compare 16 bytes per step, and needles use
+ * Two-Way with a precomputed factorization and shift table.
+ *
+ * Unlike the runtime tokenizers, a NUL byte is an ordinary character unless
+ * the literal lists it (e.g. "\0,").
+ */
+
+#ifndef CSTR_STATIC_HPP
+#define CSTR_STATIC_HPP
+
+#include "cstr_ranges.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace cstr
+{
+    /**
+     * @brief String literal usable as a template argument
+     */
+    template <size_t N>
+    struct fixed_string
+    {
+        char value[N] = {};  ///< Characters including the terminator
+
+        constexpr fixed_string(const char (&text)[N]) noexcept
+        {
+            for (size_t i = 0; i < N; ++i)
+                value[i] = text[i];
+        }
+
+        static constexpr size_t size() noexcept
+        {
+            return N - 1;
+        }
+
+        constexpr unsigned char operator[](size_t index) const noexcept
+        {
+            return (unsigned char)value[index];
+        }
+    };
+
+    /**
+     * @class char_set
+     * @brief Set of bytes fixed at compile time
+     * @tparam Chars Members (duplicates allowed)
+     */
+    template <fixed_string Chars>
+    class char_set
+    {
+        static constexpr std::array<bool, 256> make_table() noexcept
+        {
+            std::array<bool, 256> table = {};
+            for (size_t i = 0; i < Chars.size(); ++i)
+                table[Chars[i]] = true;
+            return table;
+        }
+
+        static constexpr std::array<bool, 256> table = make_table();
+
+        static constexpr size_t count_members() noexcept
+        {
+            size_t count = 0;
+            for (bool member : table)
+                count += member;
+            return count;
+        }
+
+    public:
+        static constexpr size_t count = count_members();  ///< Distinct members
+
+        /**
+         * @brief Distinct members in ascending order
+         */
+        static constexpr std::array<unsigned char, count> members = []
+        {
+            std::array<unsigned char, count> out = {};
+            size_t n = 0;
+            for (size_t c = 0; c < 256; ++c)
+            {
+                if (table[c])
+                    out[n++] = (unsigned char)c;
+            }
+            return out;
+        }();
+
+        static constexpr bool contains(char c) noexcept
+        {
+            return table[(unsigned char)c];
+        }
+
+        /**
+         * @brief Index of the first member byte
+         * @return Index, or size if none
+         */
+        static size_t find_first(const char* data, size_t size) noexcept
+        {
+            if constexpr (count == 0)
+            {
+                return size;
+            }
+            else if constexpr (count == 1)
+            {
+                const void* hit = size ? memchr(data, members[0], size) : nullptr;
+                return hit ? (size_t)((const char*)hit - data) : size;
+            }
+            else
+            {
+                size_t i = 0;
+
+#ifdef CSTR_HAVE_SSE2
+                if constexpr (count <= 4)
+                {
+                    for (; i + 16 <= size; i += 16)
+                    {
+                        __m128i block = _mm_loadu_si128((const __m128i*)(data + i));
+                        __m128i hits = _mm_cmpeq_epi8(block, _mm_set1_epi8((char)members[0]));
+
+                        for (size_t k = 1; k < count; ++k)
+                            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, _mm_set1_epi8((char)members[k])));
+
+                        uint32_t mask = (uint32_t)_mm_movemask_epi8(hits);
+                        if (mask)
+                            return i + cstr_ctz32(mask);
+                    }
+                }
+#endif
+
+                for (; i < size; ++i)
+                {
+                    if (contains(data[i]))
+                        return i;
+                }
+
+                return size;
+            }
+        }
+
+        /**
+         * @brief Index of the first byte that is not a member
+         * @return Index, or size if all bytes are members
+         */
+        static size_t find_first_not(const char* data, size_t size) noexcept
+        {
+            size_t i = 0;
+
+            if constexpr (count == 1)
+            {
+                while (i < size && (unsigned char)data[i] == members[0])
+                    ++i;
+            }
+            else if constexpr (count > 1)
+            {
+                while (i < size && contains(data[i]))
+                    ++i;
+            }
+
+            return i;
+        }
+
+        /**
+         * @brief Position of the first member
+         * @return Index or CSTR_INVALID
+         */
+        static size_t find(std::string_view text) noexcept
+        {
+            size_t index = find_first(text.data(), text.size());
+            return index == text.size() ? cstr_invalid : index;
+        }
+    };
+
+    /**
+     * @class static_tokenizer
+     * @brief cstr_scan_token_ex() with delimiters, zones and escapes fixed at compile time
+     * @tparam Delimiters  Separator characters
+     * @tparam ZonePairs   Zone delimiter pairs (e.g. "\"\"''")
+     * @tparam EscapeChars Escape characters
+     *
+     * Produces the same tokens as the runtime tokenizer for text without NUL
+     * bytes. Without zones and escapes, a token is one char_set scan. Inside a
+     * zone, memchr() jumps to the closing character.
+     */
+    template <fixed_string Delimiters, fixed_string ZonePairs = "", fixed_string EscapeChars = "">
+    struct static_tokenizer
+    {
+        using delimiter_set = char_set<Delimiters>;
+
+        static constexpr unsigned char class_delimiter = 1;  ///< Ends the token
+        static constexpr unsigned char class_zone = 2;       ///< Opens a zone
+        static constexpr unsigned char class_escape = 4;     ///< Escapes the next byte
+
+        static constexpr bool plain = ZonePairs.size() < 2 && EscapeChars.size() == 0;  ///< Delimiters only
+
+        /**
+         * @brief Per-byte classes and zone closers
+         * @note Like the runtime tokenizer, the first pair with a given opener wins
+         *       and an unpaired trailing zone character is ignored
+         */
+        struct tables
+        {
+            std::array<unsigned char, 256> classes = {};
+            std::array<unsigned char, 256> closers = {};
+        };
+
+        static constexpr tables classify = []
+        {
+            tables out;
+
+            for (size_t i = 0; i < Delimiters.size(); ++i)
+                out.classes[Delimiters[i]] |= class_delimiter;
+
+            for (size_t i = 0; i + 1 < ZonePairs.size(); i += 2)
+            {
+                if (!(out.classes[ZonePairs[i]] & class_zone))
+                {
+                    out.classes[ZonePairs[i]] |= class_zone;
+                    out.closers[ZonePairs[i]] = ZonePairs[i + 1];
+                }
+            }
+
+            for (size_t i = 0; i < EscapeChars.size(); ++i)
+                out.classes[EscapeChars[i]] |= class_escape;
+
+            return out;
+        }();
+
+        /**
+         * @brief Locate next token (contract of cstr_scan_token())
+         */
+        bool operator()(const char* data, size_t len, size_t* start_pos, CStringView* token) const noexcept
+        {
+            return scan(data, len, start_pos, token);
+        }
+
+        static bool scan(const char* data, size_t len, size_t* start_pos, CStringView* token) noexcept
+        {
+            if (!data || *start_pos >= len)
+                return false;
+
+            size_t pos = *start_pos;
+            pos += delimiter_set::find_first_not(data + pos, len - pos);
+
+            if (pos >= len)
+            {
+                *start_pos = pos;
+                return false;
+            }
+
+            size_t token_start = pos;
+
+            if constexpr (plain)
+            {
+                pos += delimiter_set::find_first(data + pos, len - pos);
+            }
+            else
+            {
+                bool escape = false;
+
+                for (; pos < len; ++pos)
+                {
+                    if (escape)
+                    {
+                        escape = false;
+                        continue;
+                    }
+
+                    unsigned char c = (unsigned char)data[pos];
+                    unsigned char cls = classify.classes[c];
+
+                    if (!cls)
+                        continue;
+
+                    if (cls & class_delimiter)
+                        break;
+
+                    if (cls & class_escape)
+                        escape = true;
+
+                    if (cls & class_zone)
+                    {
+                        // An escape that is also a zone opener still skips one byte first
+                        size_t from = pos + 1 + (escape ? 1 : 0);
+                        escape = false;
+
+                        const void* close = from < len ? memchr(data + from, classify.closers[c], len - from) : nullptr;
+                        if (!close)
+                        {
+                            pos = len;
+                            break;
+                        }
+
+                        pos = (size_t)((const char*)close - data);
+                    }
+                }
+            }
+
+            token->data = data + token_start;
+            token->length = pos - token_start;
+
+            *start_pos = pos < len ? pos + 1 : len;
+
+            return true;
+        }
+    };
+
+    /**
+     * @brief Lazily tokenize characters with literal delimiters, zones and escapes
+     * @code
+     * for (std::string_view field : cstr::tokens<",", "\"\"", "\\">(line))
+     *     use(field);
+     * @endcode
+     */
+    template <fixed_string Delimiters, fixed_string ZonePairs = "", fixed_string EscapeChars = "">
+    basic_token_view<static_tokenizer<Delimiters, ZonePairs, EscapeChars>> tokens(std::string_view text) noexcept
+    {
+        return basic_token_view<static_tokenizer<Delimiters, ZonePairs, EscapeChars>>(text);
+    }
+
+    /**
+     * @class static_needle
+     * @brief Substring searcher for a needle fixed at compile time
+     *
+     * One-byte needles use memchr(). Longer needles run Two-Way
+     * (Crochemore-Perrin). Its critical factorization, period and bad-character
+     * shift table are computed by the compiler. The search is linear time
+     * with constant extra space.
+     */
+    template <fixed_string Needle>
+    class static_needle
+    {
+        static constexpr size_t length = Needle.size();
+
+        using shift_type = std::conditional_t<(length < 256), uint8_t, size_t>;
+
+        struct factorization
+        {
+            size_t suffix;   ///< Start of the right half
+            size_t period;   ///< Period of the needle (or shift bound when aperiodic)
+            bool periodic;   ///< Left half repeats with the period
+        };
+
+        static constexpr size_t maximal_suffix(bool reverse, size_t* period) noexcept
+        {
+            size_t max_suffix = (size_t)-1;
+            size_t j = 0;
+            size_t k = 1;
+            size_t p = 1;
+
+            while (j + k < length)
+            {
+                unsigned char a = Needle[j + k];
+                unsigned char b = Needle[max_suffix + k];
+
+                if (reverse ? b < a : a < b)
+                {
+                    j += k;
+                    k = 1;
+                    p = j - max_suffix;
+                }
+                else if (a == b)
+                {
+                    if (k != p)
+                    {
+                        ++k;
+                    }
+                    else
+                    {
+                        j += p;
+                        k = 1;
+                    }
+                }
+                else
+                {
+                    max_suffix = j++;
+                    k = p = 1;
+                }
+            }
+
+            *period = p;
+            return max_suffix;
+        }
+
+        static constexpr factorization factorize() noexcept
+        {
+            size_t period = 1;
+            size_t period_rev = 1;
+            size_t suffix = maximal_suffix(false, &period);
+            size_t suffix_rev = maximal_suffix(true, &period_rev);
+
+            factorization out = {};
+            if (suffix_rev + 1 < suffix + 1)
+            {
+                out.suffix = suffix + 1;
+                out.period = period;
+            }
+            else
+            {
+                out.suffix = suffix_rev + 1;
+                out.period = period_rev;
+            }
+
+            out.periodic = true;
+            for (size_t i = 0; i < out.suffix; ++i)
+            {
+                if (out.suffix > length - out.period || Needle[i] != Needle[i + out.period])
+                {
+                    out.periodic = false;
+                    break;
+                }
+            }
+
+            if (!out.periodic)
+                out.period = (out.suffix > length - out.suffix ? out.suffix : length - out.suffix) + 1;
+
+            return out;
+        }
+
+        static constexpr factorization split = factorize();
+
+        static constexpr std::array<shift_type, 256> shift = []
+        {
+            std::array<shift_type, 256> out = {};
+            for (size_t c = 0; c < 256; ++c)
+                out[c] = (shift_type)length;
+            for (size_t i = 0; i < length; ++i)
+                out[Needle[i]] = (shift_type)(length - i - 1);
+            return out;
+        }();
+
+    public:
+        /**
+         * @brief Find the needle
+         * @return Starting index or CSTR_INVALID
+         */
+        static size_t find(std::string_view haystack) noexcept
+        {
+            const unsigned char* h = (const unsigned char*)haystack.data();
+            size_t size = haystack.size();
+
+            if constexpr (length == 0)
+            {
+                return 0;
+            }
+            else if constexpr (length == 1)
+            {
+                const void* hit = size ? memchr(h, Needle[0], size) : nullptr;
+                return hit ? (size_t)((const unsigned char*)hit - h) : cstr_invalid;
+            }
+            else
+            {
+                if (size < length)
+                    return cstr_invalid;
+
+                constexpr size_t suffix = split.suffix;
+                constexpr size_t period = split.period;
+
+                size_t j = 0;
+
+                if constexpr (split.periodic)
+                {
+                    // Prefix matched in the previous window, as in the original algorithm
+                    size_t memory = 0;
+
+                    while (j <= size - length)
+                    {
+                        size_t skip = shift[h[j + length - 1]];
+                        if (skip)
+                        {
+                            if (memory && skip < period)
+                                skip = length - period;
+                            memory = 0;
+                            j += skip;
+                            continue;
+                        }
+
+                        size_t i = suffix > memory ? suffix : memory;
+                        while (i < length - 1 && Needle[i] == h[i + j])
+                            ++i;
+
+                        if (length - 1 <= i)
+                        {
+                            i = suffix - 1;
+                            while (memory < i + 1 && Needle[i] == h[i + j])
+                                --i;
+
+                            if (i + 1 < memory + 1)
+                                return j;
+
+                            j += period;
+                            memory = length - period;
+                        }
+                        else
+                        {
+                            j += i - suffix + 1;
+                            memory = 0;
+                        }
+                    }
+                }
+                else
+                {
+                    while (j <= size - length)
+                    {
+                        size_t skip = shift[h[j + length - 1]];
+                        if (skip)
+                        {
+                            j += skip;
+                            continue;
+                        }
+
+                        size_t i = suffix;
+                        while (i < length - 1 && Needle[i] == h[i + j])
+                            ++i;
+
+                        if (length - 1 <= i)
+                        {
+                            i = suffix - 1;
+                            while (i != (size_t)-1 && Needle[i] == h[i + j])
+                                --i;
+
+                            if (i == (size_t)-1)
+                                return j;
+
+                            j += period;
+                        }
+                        else
+                        {
+                            j += i - suffix + 1;
+                        }
+                    }
+                }
+
+                return cstr_invalid;
+            }
+        }
+    };
+
+    /**
+     * @brief Find a literal needle
+     * @return Starting index or CSTR_INVALID
+     * @code
+     * size_t at = cstr::find<"\r\n\r\n">(request);
+     * @endcode
+     */
+    template <fixed_string Needle>
+    size_t find(std::string_view haystack) noexcept
+    {
+        return static_needle<Needle>::find(haystack);
+    }
+
+    template <fixed_string Needle>
+    bool contains(std::string_view haystack) noexcept
+    {
+        return static_needle<Needle>::find(haystack) != cstr_invalid;
+    }
+}
+
+#endif // CSTR_STATIC_HPP
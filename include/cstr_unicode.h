@@ -0,0 +1,480 @@
+#pragma once
+
+/**
+ * @file cstr_unicode.h
+ * @brief Unicode case folding and NFC/NFD normalization of UTF-8 CStrings.
+ *
+ * Properties come from two-stage tables generated from the UCD
+ * (tools/gen_unicode.py). Each call makes one pass into output that was
+ * reserved up front. Pure-ASCII runs are found 16 bytes at a time and
+ * skip the table lookups.
+ */
+
+#ifndef CSTR_UNICODE_H
+#define CSTR_UNICODE_H
+
+#include "cstr.h"
+#include "cstr_unicode_tables.h"
+
+#define CSTR_NFD 0  ///< Canonical decomposition
+#define CSTR_NFC 1  ///< Canonical decomposition followed by canonical composition
+
+#define CSTR_HANGUL_S_BASE  0xAC00  ///< First precomposed Hangul syllable
+#define CSTR_HANGUL_L_BASE  0x1100  ///< First leading consonant jamo
+#define CSTR_HANGUL_V_BASE  0x1161  ///< First vowel jamo
+#define CSTR_HANGUL_T_BASE  0x11A7  ///< One before the first trailing consonant jamo
+#define CSTR_HANGUL_L_COUNT 19
+#define CSTR_HANGUL_V_COUNT 21
+#define CSTR_HANGUL_T_COUNT 28
+#define CSTR_HANGUL_N_COUNT (CSTR_HANGUL_V_COUNT * CSTR_HANGUL_T_COUNT)
+#define CSTR_HANGUL_S_COUNT (CSTR_HANGUL_L_COUNT * CSTR_HANGUL_N_COUNT)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @struct CStringCodeBuffer
+     * @brief Growable code point buffer holding the pending normalization segment
+     */
+    typedef struct
+    {
+        uint32_t* data;   ///< Code points
+        size_t length;    ///< Used entries
+        size_t capacity;  ///< Allocated entries
+    }CStringCodeBuffer;
+
+    CSTR_API bool cstr_append_normalized(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ unsigned form);
+    CSTR_API bool cstr_append_casefold_utf8(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size);
+    CSTR_API bool cstr_casefold_utf8(_In_ CString* obj);
+    CSTR_API bool cstr_normalize(_In_ CString* obj, _In_ unsigned form);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_UNICODE)
+
+    /**
+     * @brief Canonical combining class of a code point
+     */
+    CSTR_INLINE uint8_t cstr_unicode_ccc(_In_ uint32_t code)
+    {
+        if (code >= CSTR_UNICODE_CCC_LIMIT)
+            return 0;
+
+        size_t block = cstr_unicode_ccc_index[code >> CSTR_UNICODE_BLOCK_SHIFT];
+        return cstr_unicode_ccc_blocks[(block << CSTR_UNICODE_BLOCK_SHIFT) | (code & ((1u << CSTR_UNICODE_BLOCK_SHIFT) - 1))];
+    }
+
+    /**
+     * @brief Look up a sequence mapping in a two-stage table
+     * @return Length-prefixed code point sequence, or NULL if unmapped
+     */
+    CSTR_INLINE const uint32_t* cstr_unicode_mapping(_In_ const uint16_t* index, _In_ const uint16_t* blocks, _In_ uint32_t limit, _In_ uint32_t code)
+    {
+        if (code >= limit)
+            return NULL;
+
+        size_t block = index[code >> CSTR_UNICODE_BLOCK_SHIFT];
+        uint16_t offset = blocks[(block << CSTR_UNICODE_BLOCK_SHIFT) | (code & ((1u << CSTR_UNICODE_BLOCK_SHIFT) - 1))];
+
+        return offset ? &cstr_unicode_sequences[offset] : NULL;
+    }
+
+    /**
+     * @brief Primary composite of two code points
+     * @return Composite, or 0 if the pair does not compose
+     */
+    CSTR_INLINE uint32_t cstr_unicode_compose(_In_ uint32_t first, _In_ uint32_t second)
+    {
+        if (first - CSTR_HANGUL_L_BASE < CSTR_HANGUL_L_COUNT && second - CSTR_HANGUL_V_BASE < CSTR_HANGUL_V_COUNT)
+            return CSTR_HANGUL_S_BASE + ((first - CSTR_HANGUL_L_BASE) * CSTR_HANGUL_V_COUNT + (second - CSTR_HANGUL_V_BASE)) * CSTR_HANGUL_T_COUNT;
+
+        if (first - CSTR_HANGUL_S_BASE < CSTR_HANGUL_S_COUNT && (first - CSTR_HANGUL_S_BASE) % CSTR_HANGUL_T_COUNT == 0 &&
+            second - CSTR_HANGUL_T_BASE - 1 < CSTR_HANGUL_T_COUNT - 1)
+            return first + (second - CSTR_HANGUL_T_BASE);
+
+        uint64_t key = ((uint64_t)first << 21) | second;
+        size_t lo = 0;
+        size_t hi = sizeof(cstr_unicode_compose_keys) / sizeof(cstr_unicode_compose_keys[0]);
+
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (cstr_unicode_compose_keys[mid] < key)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        if (lo < sizeof(cstr_unicode_compose_keys) / sizeof(cstr_unicode_compose_keys[0]) && cstr_unicode_compose_keys[lo] == key)
+            return cstr_unicode_compose_values[lo];
+
+        return 0;
+    }
+
+    /**
+     * @brief Check if a starter can compose with the character before it
+     */
+    CSTR_INLINE bool cstr_unicode_composes_backward(_In_ uint32_t code)
+    {
+        if (code - CSTR_HANGUL_V_BASE < CSTR_HANGUL_V_COUNT || code - CSTR_HANGUL_T_BASE - 1 < CSTR_HANGUL_T_COUNT - 1)
+            return true;
+
+        for (size_t i = 0; i < sizeof(cstr_unicode_compose_starters) / sizeof(cstr_unicode_compose_starters[0]); ++i)
+        {
+            if (cstr_unicode_compose_starters[i] == code)
+                return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Append code point to buffer
+     * @return true on success, false on allocation failure
+     */
+    CSTR_INLINE bool cstr_unicode_push(_Inout_ CStringCodeBuffer* buffer, _In_ uint32_t code)
+    {
+        if (buffer->length == buffer->capacity)
+        {
+            size_t capacity = buffer->capacity ? buffer->capacity * 2 : 32;
+            uint32_t* data = (uint32_t*)realloc(buffer->data, capacity * sizeof(uint32_t));
+            if (!data)
+                return false;
+
+            buffer->data = data;
+            buffer->capacity = capacity;
+        }
+
+        buffer->data[buffer->length++] = code;
+
+        return true;
+    }
+
+    /**
+     * @brief Reorder, optionally compose, and write out the pending segment
+     * @param buffer  Pending code points (emptied)
+     * @param out     Output cursor (advanced)
+     * @param compose Apply canonical composition (NFC)
+     */
+    CSTR_INLINE void cstr_unicode_flush(_Inout_ CStringCodeBuffer* buffer, _Inout_ char** out, _In_ bool compose)
+    {
+        uint32_t* data = buffer->data;
+        size_t length = buffer->length;
+
+        // Canonical ordering: stable insertion sort of each run of non-starters
+        for (size_t i = 1; i < length; ++i)
+        {
+            uint32_t code = data[i];
+            uint8_t ccc = cstr_unicode_ccc(code);
+            if (ccc == 0)
+                continue;
+
+            size_t j = i;
+            while (j > 0 && cstr_unicode_ccc(data[j - 1]) > ccc)
+            {
+                data[j] = data[j - 1];
+                --j;
+            }
+            data[j] = code;
+        }
+
+        if (compose && length > 1)
+        {
+            size_t starter = cstr_unicode_ccc(data[0]) == 0 ? 0 : cstr_invalid;
+            uint8_t last_ccc = starter == 0 ? 0 : 0xFF;
+            size_t kept = 1;
+
+            for (size_t i = 1; i < length; ++i)
+            {
+                uint32_t code = data[i];
+                uint8_t ccc = cstr_unicode_ccc(code);
+
+                // Not blocked: adjacent to the starter, or every mark in between has a lower class
+                if (starter != cstr_invalid && (kept == starter + 1 || (last_ccc != 0 && last_ccc < ccc)))
+                {
+                    uint32_t composite = cstr_unicode_compose(data[starter], code);
+                    if (composite)
+                    {
+                        data[starter] = composite;
+                        continue;
+                    }
+                }
+
+                if (ccc == 0)
+                    starter = kept;
+
+                last_ccc = ccc;
+                data[kept++] = code;
+            }
+
+            length = kept;
+        }
+
+        for (size_t i = 0; i < length; ++i)
+            *out += cstr_utf8_encode(*out, data[i]);
+
+        buffer->length = 0;
+    }
+
+    /**
+     * @brief Append UTF-8 text converted to a normalization form
+     * @param obj  Destination CString
+     * @param data UTF-8 text
+     * @param size Input length
+     * @param form CSTR_NFC or CSTR_NFD
+     * @return true on success, false on malformed UTF-8 or allocation failure
+     * @note On failure the destination is left unchanged
+     */
+    bool cstr_append_normalized(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ unsigned form)
+    {
+        if (!obj || (!data && size) || (form != CSTR_NFC && form != CSTR_NFD))
+            return false;
+
+        if (size > (cstr_invalid - 1) / CSTR_UNICODE_MAX_GROWTH)
+            return false;
+
+        bool compose = form == CSTR_NFC;
+        CStringCodeBuffer buffer = { NULL, 0, 0 };
+
+        cstr_lock(obj);
+
+        if (size * CSTR_UNICODE_MAX_GROWTH > cstr_invalid - 1 - obj->length || !cstr_reserve(obj, obj->length + size * CSTR_UNICODE_MAX_GROWTH))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        const uint8_t* in = (const uint8_t*)data;
+        char* start = obj->data + obj->length;
+        char* out = start;
+        size_t i = 0;
+
+        while (i < size)
+        {
+            size_t run = cstr_ascii_run(in + i, size - i);
+            if (run)
+            {
+                // ASCII never reorders and is never a second composition element;
+                // under NFC the last byte may still take combining marks
+                cstr_unicode_flush(&buffer, &out, compose);
+
+                size_t direct = compose && i + run < size ? run - 1 : run;
+                memcpy(out, in + i, direct);
+                out += direct;
+                i += direct;
+
+                if (direct < run)
+                {
+                    if (!cstr_unicode_push(&buffer, in[i++]))
+                        goto fail;
+                }
+                continue;
+            }
+
+            uint32_t code;
+            size_t used = cstr_utf8_next(in + i, size - i, &code);
+            if (used == 1)
+                goto fail;
+            i += used;
+
+            uint32_t single[3];
+            const uint32_t* parts = single;
+            size_t count = 1;
+
+            if (code - CSTR_HANGUL_S_BASE < CSTR_HANGUL_S_COUNT)
+            {
+                uint32_t index = code - CSTR_HANGUL_S_BASE;
+                single[0] = CSTR_HANGUL_L_BASE + index / CSTR_HANGUL_N_COUNT;
+                single[1] = CSTR_HANGUL_V_BASE + (index % CSTR_HANGUL_N_COUNT) / CSTR_HANGUL_T_COUNT;
+                single[2] = CSTR_HANGUL_T_BASE + index % CSTR_HANGUL_T_COUNT;
+                count = single[2] == CSTR_HANGUL_T_BASE ? 2 : 3;
+            }
+            else
+            {
+                const uint32_t* mapping = cstr_unicode_mapping(cstr_unicode_decomp_index, cstr_unicode_decomp_blocks, CSTR_UNICODE_DECOMP_LIMIT, code);
+                if (mapping)
+                {
+                    count = mapping[0];
+                    parts = mapping + 1;
+                }
+                else
+                {
+                    single[0] = code;
+                }
+            }
+
+            for (size_t k = 0; k < count; ++k)
+            {
+                // A starter ends the segment unless it may compose with what came before
+                if (cstr_unicode_ccc(parts[k]) == 0 && !(compose && cstr_unicode_composes_backward(parts[k])))
+                    cstr_unicode_flush(&buffer, &out, compose);
+
+                if (!cstr_unicode_push(&buffer, parts[k]))
+                    goto fail;
+            }
+        }
+
+        cstr_unicode_flush(&buffer, &out, compose);
+        free(buffer.data);
+
+        obj->length += (size_t)(out - start);
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+
+    fail:
+        free(buffer.data);
+        obj->data[obj->length] = '\0';
+        cstr_unlock(obj);
+        return false;
+    }
+
+    /**
+     * @brief Append UTF-8 text with full Unicode case folding applied
+     * @param obj  Destination CString
+     * @param data UTF-8 text
+     * @param size Input length
+     * @return true on success, false on malformed UTF-8 or allocation failure
+     * @note Folding is context-free (CaseFolding.txt status C and F) and does not
+     *       normalize; fold then normalize when comparing arbitrary input.
+     *       On failure the destination is left unchanged.
+     */
+    bool cstr_append_casefold_utf8(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size)
+    {
+        if (!obj || (!data && size))
+            return false;
+
+        if (size > (cstr_invalid - 1) / CSTR_UNICODE_MAX_GROWTH)
+            return false;
+
+        cstr_lock(obj);
+
+        if (size * CSTR_UNICODE_MAX_GROWTH > cstr_invalid - 1 - obj->length || !cstr_reserve(obj, obj->length + size * CSTR_UNICODE_MAX_GROWTH))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        const uint8_t* in = (const uint8_t*)data;
+        char* start = obj->data + obj->length;
+        char* out = start;
+        size_t i = 0;
+
+        while (i < size)
+        {
+#ifdef CSTR_HAVE_SSE2
+            // Lowercase ASCII blocks directly: 'A'..'Z' get 0x20 added
+            for (; i + 16 <= size; i += 16)
+            {
+                __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+                if (_mm_movemask_epi8(v))
+                    break;
+
+                __m128i upper = _mm_sub_epi8(v, _mm_set1_epi8('A'));
+                upper = _mm_cmpeq_epi8(_mm_min_epu8(upper, _mm_set1_epi8(25)), upper);
+                _mm_storeu_si128((__m128i*)out, _mm_add_epi8(v, _mm_and_si128(upper, _mm_set1_epi8(0x20))));
+                out += 16;
+            }
+#endif
+
+            for (; i < size && in[i] < 0x80; ++i)
+                *out++ = (char)(in[i] >= 'A' && in[i] <= 'Z' ? in[i] + 0x20 : in[i]);
+
+            if (i == size)
+                break;
+
+            uint32_t code;
+            size_t used = cstr_utf8_next(in + i, size - i, &code);
+            if (used == 1)
+            {
+                obj->data[obj->length] = '\0';
+                cstr_unlock(obj);
+                return false;
+            }
+            i += used;
+
+            const uint32_t* mapping = cstr_unicode_mapping(cstr_unicode_fold_index, cstr_unicode_fold_blocks, CSTR_UNICODE_FOLD_LIMIT, code);
+            if (!mapping)
+            {
+                out += cstr_utf8_encode(out, code);
+                continue;
+            }
+
+            for (uint32_t k = 1; k <= mapping[0]; ++k)
+                out += cstr_utf8_encode(out, mapping[k]);
+        }
+
+        obj->length += (size_t)(out - start);
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Apply full Unicode case folding to a UTF-8 CString
+     * @param obj CString to fold
+     * @return true on success, false on malformed UTF-8 or allocation failure
+     * @note Unlike cstr_to_lower() this handles multi-byte characters and
+     *       one-to-many foldings (e.g. U+00DF folds to "ss")
+     */
+    bool cstr_casefold_utf8(_In_ CString* obj)
+    {
+        if (!obj)
+            return false;
+
+        CString result;
+        if (!cstr_create_ex(&result, cstr_buffer_allocator(obj->data)))
+            return false;
+
+        cstr_lock(obj);
+
+        bool ok = cstr_append_casefold_utf8(&result, obj->data, obj->length);
+        if (ok)
+            cstr_swap(obj, &result);
+
+        cstr_unlock(obj);
+
+        cstr_destroy(&result);
+
+        return ok;
+    }
+
+    /**
+     * @brief Convert a UTF-8 CString to a normalization form
+     * @param obj  CString to normalize
+     * @param form CSTR_NFC or CSTR_NFD
+     * @return true on success, false on malformed UTF-8 or allocation failure
+     */
+    bool cstr_normalize(_In_ CString* obj, _In_ unsigned form)
+    {
+        if (!obj)
+            return false;
+
+        CString result;
+        if (!cstr_create_ex(&result, cstr_buffer_allocator(obj->data)))
+            return false;
+
+        cstr_lock(obj);
+
+        bool ok = cstr_append_normalized(&result, obj->data, obj->length, form);
+        if (ok)
+            cstr_swap(obj, &result);
+
+        cstr_unlock(obj);
+
+        cstr_destroy(&result);
+
+        return ok;
+    }
+
+#endif // CSTR_IMPLEMENT_UNICODE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_UNICODE_H
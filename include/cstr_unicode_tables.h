@@ -0,0 +1,3148 @@
+#pragma once
+
+/**
+ * @file cstr_unicode_tables.h
+ * @brief Unicode 14.0.0 property tables (generated by tools/gen_unicode.py, do not edit).
+ */
+
+#ifndef CSTR_UNICODE_TABLES_H
+#define CSTR_UNICODE_TABLES_H
+
+#define CSTR_UNICODE_VERSION "14.0.0"
+#define CSTR_UNICODE_BLOCK_SHIFT 7
+#define CSTR_UNICODE_MAX_GROWTH 3
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define CSTR_UNICODE_CCC_LIMIT 0x1E980
+
+    static const uint16_t cstr_unicode_ccc_index[979] =
+    {
+        0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 3, 4, 5, 6, 7,
+        8, 9, 10, 11, 12, 12, 12, 13, 14, 12, 15, 16, 17, 18, 19, 20,
+        21, 22, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0, 0, 24, 25,
+        0, 26, 27, 0, 28, 29, 30, 31, 32, 33, 0, 34, 0, 0, 0, 0,
+        0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 37, 38, 0, 0, 0, 0,
+        39, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0,
+        43, 44, 45, 46, 0, 47, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 50, 0, 0, 0,
+        0, 0, 0, 51, 0, 52, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 56, 0, 0, 57, 58, 59,
+        60, 61, 62, 63, 64, 65, 66, 0, 67, 68, 0, 69, 70, 71, 72, 0,
+        61, 0, 73, 74, 75, 76, 0, 0, 70, 0, 77, 78, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 79, 80, 0, 0, 0, 0, 0, 0, 0, 0, 81,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 82, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 83, 84, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        86, 0, 80, 0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 88, 89,
+    };
+
+    static const uint8_t cstr_unicode_ccc_blocks[11520] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 232, 220, 220, 220, 220, 232, 216, 220, 220, 220, 220,
+        220, 202, 202, 220, 220, 220, 220, 202, 202, 220, 220, 220, 220, 220, 220, 220,
+        220, 220, 220, 220, 1, 1, 1, 1, 1, 220, 220, 220, 220, 230, 230, 230,
+        230, 230, 230, 230, 230, 240, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0,
+        230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230, 233, 234, 234, 233,
+        234, 234, 233, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 220, 230, 230, 230, 230, 220, 230, 230, 230, 222, 220, 230, 230, 230, 230,
+        230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 230, 230, 222, 228, 230,
+        10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23,
+        0, 24, 25, 0, 230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31,
+        32, 33, 34, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230,
+        230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220, 230, 230, 220, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+        230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+        230, 230, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 0, 230, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220, 230, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220,
+        220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 0, 220, 230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220,
+        27, 28, 29, 230, 230, 230, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 230, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 84, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 9, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 129, 130, 0, 132, 0, 0, 0, 0, 0, 130, 130, 130, 130, 0, 0,
+        130, 0, 230, 230, 9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220,
+        220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230,
+        230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230, 230, 220, 220, 220, 220,
+        230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 220, 0, 0,
+        0, 0, 0, 0, 230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220,
+        202, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230, 233, 220, 230, 220,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 1, 1, 230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0,
+        0, 230, 0, 0, 0, 1, 1, 230, 220, 230, 1, 1, 220, 220, 220, 220,
+        230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+        230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+        0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 0, 230, 230, 220, 0, 0, 230, 230, 0, 0, 0, 0, 0, 230, 230,
+        0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 220, 0, 0, 0, 0, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220, 230, 220, 220, 220,
+        220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 230, 220, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0,
+        230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+        7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0,
+        0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 216, 216, 1, 1, 1, 0, 0, 0, 226, 216, 216,
+        216, 216, 216, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220, 220,
+        220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+        230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230,
+        230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        220, 220, 220, 220, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 7, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+#define CSTR_UNICODE_DECOMP_LIMIT 0x2FA80
+
+    static const uint16_t cstr_unicode_decomp_index[1525] =
+    {
+        0, 1, 2, 3, 4, 0, 5, 6, 7, 8, 0, 0, 9, 10, 0, 0,
+        0, 0, 11, 12, 13, 0, 14, 15, 16, 17, 18, 19, 0, 0, 20, 21,
+        22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 24, 25, 26, 27,
+        28, 0, 29, 30, 31, 32, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        35, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 37, 38, 39, 40, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 42, 43, 0, 0, 0, 44, 0, 0, 45, 0, 46, 0, 0, 0, 0,
+        0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        50, 51, 52, 53, 54,
+    };
+
+    static const uint16_t cstr_unicode_decomp_blocks[7040] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        55, 60, 65, 70, 75, 80, 0, 87, 92, 97, 102, 107, 112, 117, 122, 127,
+        0, 134, 139, 144, 149, 154, 159, 0, 0, 166, 171, 176, 181, 186, 0, 0,
+        196, 199, 202, 205, 208, 211, 0, 214, 217, 220, 223, 226, 229, 232, 235, 238,
+        0, 241, 244, 247, 250, 253, 256, 0, 0, 259, 262, 265, 268, 271, 0, 274,
+        277, 282, 285, 290, 293, 298, 301, 306, 309, 314, 317, 322, 325, 330, 333, 338,
+        0, 0, 343, 348, 351, 356, 359, 364, 367, 372, 375, 380, 383, 388, 391, 396,
+        399, 404, 407, 412, 415, 420, 0, 0, 425, 430, 433, 438, 441, 446, 449, 454,
+        457, 0, 0, 0, 465, 470, 473, 478, 0, 481, 486, 489, 494, 497, 502, 0,
+        0, 0, 0, 509, 514, 517, 522, 525, 530, 0, 0, 0, 538, 543, 546, 551,
+        554, 559, 0, 0, 564, 569, 572, 577, 580, 585, 588, 593, 596, 601, 604, 609,
+        612, 617, 620, 625, 628, 633, 0, 0, 638, 643, 646, 651, 654, 659, 662, 667,
+        670, 675, 678, 683, 686, 691, 694, 699, 702, 707, 712, 715, 720, 723, 728, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        771, 776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 793,
+        798, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 821, 826, 829,
+        834, 837, 842, 845, 850, 853, 859, 863, 869, 873, 879, 883, 889, 0, 893, 899,
+        903, 909, 913, 918, 0, 0, 923, 928, 931, 936, 939, 944, 947, 953, 957, 962,
+        965, 0, 0, 0, 970, 975, 0, 0, 982, 987, 990, 996, 1000, 1005, 1008, 1013,
+        1016, 1021, 1024, 1029, 1032, 1037, 1040, 1045, 1048, 1053, 1056, 1061, 1064, 1069, 1072, 1077,
+        1080, 1085, 1088, 1093, 1096, 1101, 1104, 1109, 1112, 1117, 1120, 1125, 0, 0, 1130, 1135,
+        0, 0, 0, 0, 0, 0, 1144, 1149, 1152, 1157, 1160, 1166, 1170, 1176, 1180, 1185,
+        1188, 1194, 1198, 1203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1232, 1234, 0, 1236, 1238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1251, 0,
+        0, 0, 0, 0, 0, 1255, 1258, 1263, 1265, 1270, 1275, 0, 1280, 0, 1285, 1290,
+        1295, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1343, 1348, 1353, 1356, 1359, 1362,
+        1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1369, 1372, 1375, 1378, 1381, 0,
+        0, 0, 0, 1386, 1389, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1428, 1433, 0, 1440, 0, 0, 0, 1451, 0, 0, 0, 0, 1464, 1469, 1474, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1499, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1548, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1551, 1554, 0, 1557, 0, 0, 0, 1560, 0, 0, 0, 0, 1563, 1566, 1569, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1594, 1599, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1668, 1673, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1688, 1693, 1696, 1701, 0, 0, 1706, 1711, 0, 0, 1716, 1721, 1724, 1729, 1732, 1737,
+        0, 0, 1742, 1747, 1750, 1755, 1758, 1763, 0, 0, 1768, 1773, 1776, 1781, 1784, 1789,
+        1792, 1797, 1800, 1805, 1808, 1813, 0, 0, 1818, 1823, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1959, 1962, 1965, 1968, 1971, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1974, 0, 1977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1980, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1983, 0, 0, 0, 0, 0, 0,
+        0, 1986, 0, 0, 1989, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1992, 1995, 1998, 2001, 2004, 2007, 2010, 2013,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2016, 2019, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2022, 2025, 0, 2028,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2031, 0, 0, 2034, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2037, 2040, 2043, 0, 0, 2046, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 2049, 0, 0, 2052, 2055, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2058, 2061, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 2064, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2067, 2070, 2073, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 2076, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2079, 0, 0, 0, 0, 0, 0, 2082, 2085, 0, 2088, 2091, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2095, 2098, 2101, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2104, 0, 2107, 2110, 2114, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2120, 0, 0,
+        0, 0, 2123, 0, 0, 0, 0, 2126, 0, 0, 0, 0, 2129, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2132, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2135, 0, 2138, 2141, 0, 2144, 0, 0, 0, 0, 0, 0, 0,
+        0, 2147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2153, 0, 0,
+        0, 0, 2156, 0, 0, 0, 0, 2159, 0, 0, 0, 0, 2162, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2165, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 2168, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 2263, 0, 2266, 0, 2269, 0, 2272, 0, 2275, 0,
+        0, 0, 2278, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2281, 0, 2284, 0, 0,
+        2287, 2290, 0, 2293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2390, 2395, 2398, 2403, 2406, 2411, 2414, 2419, 2422, 2428, 2432, 2437, 2440, 2445, 2448, 2453,
+        2456, 2461, 2464, 2469, 2472, 2478, 2482, 2488, 2492, 2497, 2500, 2505, 2508, 2514, 2518, 2523,
+        2526, 2531, 2534, 2539, 2542, 2547, 2550, 2555, 2558, 2563, 2566, 2571, 2574, 2579, 2582, 2588,
+        2592, 2597, 2600, 2605, 2608, 2613, 2616, 2621, 2624, 2630, 2634, 2639, 2642, 2647, 2650, 2655,
+        2658, 2663, 2666, 2671, 2674, 2679, 2682, 2687, 2690, 2695, 2698, 2703, 2706, 2712, 2716, 2722,
+        2726, 2732, 2736, 2742, 2746, 2751, 2754, 2759, 2762, 2767, 2770, 2775, 2778, 2784, 2788, 2793,
+        2796, 2801, 2804, 2809, 2812, 2818, 2822, 2828, 2832, 2838, 2842, 2847, 2850, 2855, 2858, 2863,
+        2866, 2871, 2874, 2879, 2882, 2887, 2890, 2895, 2898, 2904, 2908, 2914, 2918, 2923, 2926, 2931,
+        2934, 2939, 2942, 2947, 2950, 2955, 2958, 2963, 2966, 2971, 2974, 2979, 2982, 2987, 2990, 2995,
+        2998, 3003, 3006, 3011, 3014, 3019, 3022, 3025, 3028, 3031, 0, 3037, 0, 0, 0, 0,
+        3040, 3045, 3048, 3053, 3056, 3062, 3066, 3072, 3076, 3082, 3086, 3092, 3096, 3102, 3106, 3112,
+        3116, 3122, 3126, 3132, 3136, 3142, 3146, 3152, 3156, 3161, 3164, 3169, 3172, 3177, 3180, 3186,
+        3190, 3196, 3200, 3206, 3210, 3216, 3220, 3226, 3230, 3235, 3238, 3243, 3246, 3251, 3254, 3259,
+        3262, 3268, 3272, 3278, 3282, 3288, 3292, 3298, 3302, 3308, 3312, 3318, 3322, 3328, 3332, 3338,
+        3342, 3348, 3352, 3358, 3362, 3367, 3370, 3375, 3378, 3384, 3388, 3394, 3398, 3404, 3408, 3414,
+        3418, 3424, 3428, 3433, 3436, 3441, 3444, 3449, 3452, 3457, 0, 0, 0, 0, 0, 0,
+        3466, 3469, 3472, 3476, 3480, 3484, 3488, 3492, 3496, 3501, 3506, 3512, 3518, 3524, 3530, 3536,
+        3542, 3545, 3548, 3552, 3556, 3560, 0, 0, 3564, 3569, 3574, 3580, 3586, 3592, 0, 0,
+        3598, 3601, 3604, 3608, 3612, 3616, 3620, 3624, 3628, 3633, 3638, 3644, 3650, 3656, 3662, 3668,
+        3674, 3677, 3680, 3684, 3688, 3692, 3696, 3700, 3704, 3709, 3714, 3720, 3726, 3732, 3738, 3744,
+        3750, 3753, 3756, 3760, 3764, 3768, 0, 0, 3772, 3777, 3782, 3788, 3794, 3800, 0, 0,
+        3806, 3809, 3812, 3816, 3820, 3824, 3828, 3832, 0, 3836, 0, 3841, 0, 3847, 0, 3853,
+        3859, 3862, 3865, 3869, 3873, 3877, 3881, 3885, 3889, 3894, 3899, 3905, 3911, 3917, 3923, 3929,
+        3935, 1353, 3938, 1356, 3941, 1359, 3944, 1362, 3947, 1375, 3950, 1378, 3953, 1381, 0, 0,
+        3956, 3963, 3970, 3978, 3986, 3994, 4002, 4010, 4018, 4022, 4026, 4031, 4036, 4041, 4046, 4051,
+        4056, 4063, 4070, 4078, 4086, 4094, 4102, 4110, 4118, 4122, 4126, 4131, 4136, 4141, 4146, 4151,
+        4156, 4163, 4170, 4178, 4186, 4194, 4202, 4210, 4218, 4222, 4226, 4231, 4236, 4241, 4246, 4251,
+        4256, 4259, 4262, 4269, 4275, 0, 4282, 4285, 4293, 4298, 4303, 1258, 4310, 0, 1241, 0,
+        0, 4313, 4316, 4323, 4329, 0, 4336, 4339, 4347, 1265, 4354, 1270, 4361, 4364, 4367, 4370,
+        4373, 4376, 4379, 1295, 0, 0, 4383, 4386, 4390, 4395, 4400, 1275, 0, 4407, 4410, 4413,
+        4416, 4419, 4422, 1365, 4426, 4429, 4432, 4435, 4439, 4444, 4449, 1285, 4456, 4461, 1255, 4464,
+        0, 0, 4466, 4473, 4479, 0, 4486, 4489, 4497, 1280, 4504, 1290, 4511, 4514, 0, 0,
+        4516, 4518, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4520, 0, 0, 0, 4522, 80, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4560, 4563, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4566, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4569, 4572, 4575,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4578, 0, 0, 0, 0, 4581, 0, 0, 4584, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 4587, 0, 4590, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4593, 0, 0, 4596, 0, 0, 4599, 0, 4602, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4605, 0, 4608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4611, 4614, 4617,
+        4620, 4623, 0, 0, 4626, 4629, 0, 0, 4632, 4635, 0, 0, 0, 0, 0, 0,
+        4638, 4641, 0, 0, 4644, 4647, 0, 0, 4650, 4653, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4656, 4659, 4662, 4665,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4668, 4671, 4674, 4677, 0, 0, 0, 0, 0, 0, 4680, 4683, 4686, 4689, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 4692, 4694, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4748, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4983, 0, 4986, 0,
+        4989, 0, 4992, 0, 4995, 0, 4998, 0, 5001, 0, 5004, 0, 5007, 0, 5010, 0,
+        5013, 0, 5016, 0, 0, 5019, 0, 5022, 0, 5025, 0, 0, 0, 0, 0, 0,
+        5028, 5031, 0, 5034, 5037, 0, 5040, 5043, 0, 5046, 5049, 0, 5052, 5055, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 5058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5061, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5064, 0, 5067, 0,
+        5070, 0, 5073, 0, 5076, 0, 5079, 0, 5082, 0, 5085, 0, 5088, 0, 5091, 0,
+        5094, 0, 5097, 0, 0, 5100, 0, 5103, 0, 5106, 0, 0, 0, 0, 0, 0,
+        5109, 5112, 0, 5115, 5118, 0, 5121, 5124, 0, 5127, 5130, 0, 5133, 5136, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 5139, 0, 0, 5142, 5145, 5148, 5151, 0, 0, 0, 5154, 0,
+        5561, 5563, 5565, 5567, 5569, 5571, 5573, 5575, 5575, 5577, 5579, 5581, 5583, 5585, 5587, 5589,
+        5591, 5593, 5595, 5597, 5599, 5601, 5603, 5605, 5607, 5609, 5611, 5613, 5615, 5617, 5619, 5621,
+        5623, 5625, 5627, 5629, 5631, 5633, 5635, 5637, 5639, 5641, 5643, 5645, 5647, 5649, 5651, 5653,
+        5655, 5657, 5659, 5661, 5663, 5665, 5667, 5669, 5671, 5673, 5675, 5677, 5679, 5681, 5683, 5685,
+        5687, 5689, 5691, 5693, 5695, 5697, 5699, 5701, 5703, 5705, 5707, 5709, 5711, 5713, 5715, 5717,
+        5719, 5721, 5723, 5725, 5727, 5729, 5731, 5733, 5735, 5737, 5739, 5741, 5599, 5743, 5745, 5747,
+        5749, 5751, 5753, 5755, 5757, 5759, 5761, 5763, 5765, 5767, 5769, 5771, 5773, 5775, 5777, 5779,
+        5781, 5783, 5785, 5787, 5789, 5791, 5793, 5795, 5797, 5799, 5801, 5803, 5805, 5807, 5809, 5811,
+        5813, 5815, 5817, 5819, 5821, 5823, 5825, 5827, 5829, 5831, 5833, 5835, 5837, 5839, 5841, 5843,
+        5845, 5847, 5849, 5851, 5853, 5855, 5857, 5859, 5861, 5863, 5865, 5867, 5869, 5871, 5873, 5875,
+        5877, 5779, 5879, 5881, 5883, 5885, 5887, 5889, 5891, 5893, 5747, 5895, 5897, 5899, 5901, 5903,
+        5905, 5907, 5909, 5911, 5913, 5915, 5917, 5919, 5921, 5923, 5925, 5927, 5929, 5931, 5933, 5599,
+        5935, 5937, 5939, 5941, 5943, 5945, 5947, 5949, 5951, 5953, 5955, 5957, 5959, 5961, 5963, 5965,
+        5967, 5969, 5971, 5973, 5975, 5977, 5979, 5981, 5983, 5985, 5987, 5751, 5989, 5991, 5993, 5995,
+        5997, 5999, 6001, 6003, 6005, 6007, 6009, 6011, 6013, 6015, 6017, 6019, 6021, 6023, 6025, 6027,
+        6029, 6031, 6033, 6035, 6037, 6039, 6041, 6043, 6045, 6047, 6049, 6051, 6053, 6055, 6057, 6059,
+        6061, 6063, 6065, 6067, 6069, 6071, 6073, 6075, 6077, 6079, 6081, 6083, 6085, 6087, 0, 0,
+        6089, 0, 6091, 0, 0, 6093, 6095, 6097, 6099, 6101, 6103, 6105, 6107, 6109, 6111, 0,
+        6113, 0, 6115, 0, 0, 6117, 6119, 0, 0, 0, 6121, 6123, 6125, 6127, 6129, 6131,
+        6133, 6135, 6137, 6139, 6141, 6143, 6145, 6147, 6149, 6151, 6153, 6155, 6157, 6159, 6161, 6163,
+        6165, 6167, 6169, 6171, 6173, 6175, 6177, 6179, 6181, 6183, 6185, 6187, 6189, 6191, 6193, 6195,
+        6197, 6199, 6201, 6203, 6205, 6207, 6209, 5857, 6211, 6213, 6215, 6217, 6219, 6221, 6221, 6223,
+        6225, 6227, 6229, 6231, 6233, 6235, 6237, 6117, 6239, 6241, 6243, 6245, 6247, 6249, 0, 0,
+        6251, 6253, 6255, 6257, 6259, 6261, 6263, 6265, 6145, 6267, 6269, 6271, 6089, 6273, 6275, 6277,
+        6279, 6281, 6283, 6285, 6287, 6289, 6291, 6293, 6295, 6163, 6297, 6165, 6299, 6301, 6303, 6305,
+        6307, 6091, 5641, 6309, 6311, 6313, 5781, 5955, 6315, 6317, 6179, 6319, 6181, 6321, 6323, 6325,
+        6095, 6327, 6329, 6331, 6333, 6335, 6097, 6337, 6339, 6341, 6343, 6345, 6347, 6209, 6349, 6351,
+        5857, 6353, 6217, 6355, 6357, 6359, 6361, 6363, 6227, 6365, 6115, 6367, 6229, 5743, 6369, 6231,
+        6371, 6235, 6373, 6375, 6377, 6379, 6381, 6239, 6107, 6383, 6241, 6385, 6243, 6387, 5575, 6389,
+        6391, 6393, 6395, 6397, 6399, 6401, 6403, 6405, 6407, 6409, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6446, 0, 6449,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6452, 6455, 6458, 6462, 6466, 6469,
+        6472, 6475, 6478, 6481, 6484, 6487, 6490, 0, 6493, 6496, 6499, 6502, 6505, 0, 6508, 0,
+        6511, 6514, 0, 6517, 6520, 0, 6523, 6526, 6529, 6532, 6535, 6538, 6541, 6544, 6547, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6926, 0, 6929, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6932, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6935, 6938,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6941, 6944, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6947, 6950, 0, 6953, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6956, 6959, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 7026, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7093, 7096,
+        7099, 7103, 7107, 7111, 7115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7119, 7122, 7125, 7129, 7133,
+        7137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7209, 7211, 7213, 7215, 7217, 6133, 7219, 7221, 7223, 7225, 6135, 7227, 7229, 7231, 6137, 7233,
+        7235, 7237, 7239, 7241, 7243, 7245, 7247, 7249, 7251, 7253, 7255, 6253, 7257, 7259, 7261, 7263,
+        7265, 7267, 7269, 7271, 7273, 6263, 6139, 6141, 6265, 7275, 7277, 5755, 7279, 6143, 7281, 7283,
+        7285, 7287, 7287, 7287, 7289, 7291, 7293, 7295, 7297, 7299, 7301, 7303, 7305, 7307, 7309, 7311,
+        7313, 7315, 7317, 7319, 7321, 7323, 7323, 6269, 7325, 7327, 7329, 7331, 6147, 7333, 7335, 7337,
+        6061, 7339, 7341, 7343, 7345, 7347, 7349, 7351, 7353, 7355, 7357, 7359, 7361, 7363, 7365, 7367,
+        7369, 7371, 7373, 7375, 7377, 7379, 7381, 7383, 7385, 7387, 7389, 7389, 7391, 7393, 7395, 5747,
+        7397, 7399, 7401, 7403, 7405, 7407, 7409, 7411, 6157, 7413, 7415, 7417, 7419, 7421, 7423, 7425,
+        7427, 7429, 7431, 7433, 7435, 7437, 7439, 7441, 7443, 7445, 7447, 7449, 7451, 7453, 5639, 7455,
+        7457, 7459, 7459, 7461, 7463, 7463, 7465, 7467, 7469, 7471, 7473, 7475, 7477, 7479, 7481, 7483,
+        7485, 7487, 7489, 6159, 7491, 7493, 7495, 7497, 6293, 7497, 7499, 6163, 7501, 7503, 7505, 7507,
+        6165, 5585, 7509, 7511, 7513, 7515, 7517, 7519, 7521, 7523, 7525, 7527, 7529, 7531, 7533, 7535,
+        7537, 7539, 7541, 7543, 7545, 7547, 7549, 7551, 6167, 7553, 7555, 7557, 7559, 7561, 7563, 6171,
+        7565, 7567, 7569, 7571, 7573, 7575, 7577, 7579, 5641, 6309, 7581, 7583, 7585, 7587, 7589, 7591,
+        7593, 7595, 6173, 7597, 7599, 7601, 7603, 6395, 7605, 7607, 7609, 7611, 7613, 7615, 7617, 7619,
+        7621, 7623, 7625, 7627, 7629, 5781, 7631, 7633, 7635, 7637, 7639, 7641, 7643, 7645, 7647, 7649,
+        7651, 6175, 5955, 7653, 7655, 7657, 7659, 7661, 7663, 7665, 7667, 6317, 7669, 7671, 7673, 7675,
+        7677, 7679, 7681, 7683, 6319, 7685, 7687, 7689, 7691, 7693, 7695, 7697, 7699, 7701, 7703, 7705,
+        7707, 6323, 7709, 7711, 7713, 7715, 7717, 7719, 7721, 7723, 7725, 7727, 7729, 7729, 7731, 7733,
+        6327, 7735, 7737, 7739, 7741, 7743, 7745, 7747, 5753, 7749, 7751, 7753, 7755, 7757, 7759, 7761,
+        6339, 7763, 7765, 7767, 7769, 7771, 7773, 7773, 6341, 6399, 7775, 7777, 7779, 7781, 7783, 5677,
+        6345, 7785, 7787, 6197, 7789, 7791, 6105, 7793, 7795, 6205, 7797, 7799, 7801, 7803, 7803, 7805,
+        7807, 7809, 7811, 7813, 7815, 7817, 7819, 7821, 7823, 7825, 7827, 7829, 7831, 7833, 7835, 7837,
+        7839, 7841, 7843, 7845, 7847, 7849, 7851, 7853, 7855, 7857, 6217, 7859, 7861, 7863, 7865, 7867,
+        7869, 7871, 7873, 7875, 7877, 7879, 7881, 7883, 7885, 7887, 7889, 7461, 7891, 7893, 7895, 7897,
+        7899, 7901, 7903, 7905, 7907, 7909, 7911, 7913, 5789, 7915, 7917, 7919, 7921, 7923, 7925, 6223,
+        7927, 7929, 7931, 7933, 7935, 7937, 7939, 7941, 7943, 7945, 7947, 7949, 7951, 7953, 7955, 7957,
+        7959, 7961, 7963, 7965, 5667, 7967, 7969, 7971, 7973, 7975, 7977, 6359, 7979, 7981, 7983, 7985,
+        7987, 7989, 7991, 7993, 7995, 7997, 7999, 8001, 8003, 8005, 8007, 8009, 8011, 8013, 8015, 8017,
+        6369, 6371, 8019, 8021, 8023, 8025, 8027, 8029, 8031, 8033, 8035, 8037, 8039, 8041, 8043, 6373,
+        8045, 8047, 8049, 8051, 8053, 8055, 8057, 8059, 8061, 8063, 8065, 8067, 8069, 8071, 8073, 8075,
+        8077, 8079, 8081, 8083, 8085, 8087, 8089, 8091, 8093, 8095, 8097, 8099, 8101, 8103, 6385, 6385,
+        8105, 8107, 8109, 8111, 8113, 8115, 8117, 8119, 8121, 8123, 6387, 8125, 8127, 8129, 8131, 8133,
+        8135, 8137, 8139, 8141, 8143, 8145, 8147, 8149, 8151, 8153, 8155, 8157, 8159, 8161, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+#define CSTR_UNICODE_FOLD_LIMIT 0x1E980
+
+    static const uint16_t cstr_unicode_fold_index[979] =
+    {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 12, 5, 5, 5, 5, 5, 13, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 5, 5, 15, 16, 17, 18,
+        5, 5, 19, 20, 5, 5, 5, 5, 5, 21, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 22, 23, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 24, 25, 26, 27,
+        5, 5, 5, 5, 5, 5, 28, 29, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 31, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 32, 33, 34, 35, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 36, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 37, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 38, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 39,
+    };
+
+    static const uint16_t cstr_unicode_fold_blocks[5120] =
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29,
+        31, 33, 35, 37, 39, 41, 43, 45, 47, 49, 51, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        58, 63, 68, 73, 78, 83, 85, 90, 95, 100, 105, 110, 115, 120, 125, 130,
+        132, 137, 142, 147, 152, 157, 162, 0, 164, 169, 174, 179, 184, 189, 191, 193,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        280, 0, 288, 0, 296, 0, 304, 0, 312, 0, 320, 0, 328, 0, 336, 0,
+        341, 0, 346, 0, 354, 0, 362, 0, 370, 0, 378, 0, 386, 0, 394, 0,
+        402, 0, 410, 0, 418, 0, 423, 0, 428, 0, 436, 0, 444, 0, 452, 0,
+        460, 0, 463, 0, 468, 0, 476, 0, 0, 484, 0, 492, 0, 500, 0, 505,
+        0, 507, 0, 512, 0, 520, 0, 528, 0, 533, 536, 0, 541, 0, 549, 0,
+        557, 0, 562, 0, 567, 0, 575, 0, 583, 0, 591, 0, 599, 0, 607, 0,
+        615, 0, 623, 0, 631, 0, 636, 0, 641, 0, 649, 0, 657, 0, 665, 0,
+        673, 0, 681, 0, 689, 0, 697, 0, 705, 710, 0, 718, 0, 726, 0, 37,
+        0, 731, 733, 0, 735, 0, 737, 739, 0, 741, 743, 745, 0, 0, 747, 749,
+        751, 753, 0, 755, 757, 0, 759, 761, 763, 0, 0, 0, 765, 767, 0, 769,
+        774, 0, 779, 0, 781, 0, 783, 785, 0, 787, 0, 0, 789, 0, 791, 796,
+        0, 801, 803, 805, 0, 807, 0, 809, 811, 0, 0, 0, 813, 0, 0, 0,
+        0, 0, 0, 0, 815, 815, 0, 817, 817, 0, 819, 819, 0, 824, 0, 832,
+        0, 840, 0, 848, 0, 857, 0, 867, 0, 877, 0, 887, 0, 0, 897, 0,
+        907, 0, 916, 0, 921, 0, 926, 0, 934, 0, 942, 0, 951, 0, 960, 0,
+        965, 968, 968, 0, 973, 0, 978, 980, 985, 0, 994, 0, 1003, 0, 1011, 0,
+        1019, 0, 1027, 0, 1035, 0, 1043, 0, 1051, 0, 1059, 0, 1067, 0, 1075, 0,
+        1083, 0, 1091, 0, 1099, 0, 1107, 0, 1115, 0, 1123, 0, 1128, 0, 1133, 0,
+        1138, 0, 1140, 0, 1142, 0, 1147, 0, 1155, 0, 1164, 0, 1174, 0, 1183, 0,
+        1192, 0, 1201, 0, 0, 0, 0, 0, 0, 0, 1206, 1208, 0, 1210, 1212, 0,
+        0, 1214, 0, 1216, 1218, 1220, 1222, 0, 1224, 0, 1226, 0, 1228, 0, 1230, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1241, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1243, 0, 1245, 0, 0, 0, 1249, 0, 0, 0, 0, 0, 0, 0, 0, 1253,
+        0, 0, 0, 0, 0, 0, 1261, 0, 1268, 1273, 1278, 0, 1283, 0, 1288, 1293,
+        1295, 1299, 1301, 1303, 1305, 1307, 1309, 1311, 1313, 1241, 1315, 1317, 53, 1319, 1321, 1323,
+        1325, 1327, 0, 1329, 1331, 1333, 1335, 1337, 1339, 1341, 1346, 1351, 0, 0, 0, 0,
+        1365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1384,
+        1301, 1313, 0, 0, 0, 1335, 1325, 0, 1392, 0, 1394, 0, 1396, 0, 1398, 0,
+        1400, 0, 1402, 0, 1404, 0, 1406, 0, 1408, 0, 1410, 0, 1412, 0, 1414, 0,
+        1315, 1327, 0, 0, 1313, 1307, 0, 1416, 0, 1418, 1420, 0, 0, 1422, 1424, 1426,
+        1431, 1436, 1438, 1443, 1445, 1447, 1449, 1454, 1456, 1458, 1460, 1462, 1467, 1472, 1477, 1479,
+        1481, 1483, 1485, 1487, 1489, 1491, 1493, 1495, 1497, 1502, 1504, 1506, 1508, 1510, 1512, 1514,
+        1516, 1518, 1520, 1522, 1524, 1526, 1528, 1530, 1532, 1534, 1536, 1538, 1540, 1542, 1544, 1546,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1572, 0, 1574, 0, 1576, 0, 1578, 0, 1580, 0, 1582, 0, 1584, 0, 1586, 0,
+        1588, 0, 1590, 0, 1592, 0, 1597, 0, 1602, 0, 1604, 0, 1606, 0, 1608, 0,
+        1610, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1612, 0, 1614, 0, 1616, 0,
+        1618, 0, 1620, 0, 1622, 0, 1624, 0, 1626, 0, 1628, 0, 1630, 0, 1632, 0,
+        1634, 0, 1636, 0, 1638, 0, 1640, 0, 1642, 0, 1644, 0, 1646, 0, 1648, 0,
+        1650, 0, 1652, 0, 1654, 0, 1656, 0, 1658, 0, 1660, 0, 1662, 0, 1664, 0,
+        1666, 1671, 0, 1676, 0, 1678, 0, 1680, 0, 1682, 0, 1684, 0, 1686, 0, 0,
+        1691, 0, 1699, 0, 1704, 0, 1709, 0, 1714, 0, 1719, 0, 1727, 0, 1735, 0,
+        1740, 0, 1745, 0, 1753, 0, 1761, 0, 1766, 0, 1771, 0, 1779, 0, 1787, 0,
+        1795, 0, 1803, 0, 1811, 0, 1816, 0, 1821, 0, 1826, 0, 1828, 0, 1830, 0,
+        1832, 0, 1834, 0, 1836, 0, 1838, 0, 1840, 0, 1842, 0, 1844, 0, 1846, 0,
+        1848, 0, 1850, 0, 1852, 0, 1854, 0, 1856, 0, 1858, 0, 1860, 0, 1862, 0,
+        1864, 0, 1866, 0, 1868, 0, 1870, 0, 1872, 0, 1874, 0, 1876, 0, 1878, 0,
+        0, 1880, 1882, 1884, 1886, 1888, 1890, 1892, 1894, 1896, 1898, 1900, 1902, 1904, 1906, 1908,
+        1910, 1912, 1914, 1916, 1918, 1920, 1922, 1924, 1926, 1928, 1930, 1932, 1934, 1936, 1938, 1940,
+        1942, 1944, 1946, 1948, 1950, 1952, 1954, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1956, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2171, 2173, 2175, 2177, 2179, 2181, 2183, 2185, 2187, 2189, 2191, 2193, 2195, 2197, 2199, 2201,
+        2203, 2205, 2207, 2209, 2211, 2213, 2215, 2217, 2219, 2221, 2223, 2225, 2227, 2229, 2231, 2233,
+        2235, 2237, 2239, 2241, 2243, 2245, 0, 2247, 0, 0, 0, 0, 0, 2249, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 2251, 2253, 2255, 2257, 2259, 2261, 0, 0,
+        1485, 1489, 1512, 1518, 1520, 1520, 1536, 1574, 2296, 0, 0, 0, 0, 0, 0, 0,
+        2298, 2300, 2302, 2304, 2306, 2308, 2310, 2312, 2314, 2316, 2318, 2320, 2322, 2324, 2326, 2328,
+        2330, 2332, 2334, 2336, 2338, 2340, 2342, 2344, 2346, 2348, 2350, 2352, 2354, 2356, 2358, 2360,
+        2362, 2364, 2366, 2368, 2370, 2372, 2374, 2376, 2378, 2380, 2382, 0, 0, 2384, 2386, 2388,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2393, 0, 2401, 0, 2409, 0, 2417, 0, 2426, 0, 2435, 0, 2443, 0, 2451, 0,
+        2459, 0, 2467, 0, 2476, 0, 2486, 0, 2495, 0, 2503, 0, 2512, 0, 2521, 0,
+        2529, 0, 2537, 0, 2545, 0, 2553, 0, 2561, 0, 2569, 0, 2577, 0, 2586, 0,
+        2595, 0, 2603, 0, 2611, 0, 2619, 0, 2628, 0, 2637, 0, 2645, 0, 2653, 0,
+        2661, 0, 2669, 0, 2677, 0, 2685, 0, 2693, 0, 2701, 0, 2710, 0, 2720, 0,
+        2730, 0, 2740, 0, 2749, 0, 2757, 0, 2765, 0, 2773, 0, 2782, 0, 2791, 0,
+        2799, 0, 2807, 0, 2816, 0, 2826, 0, 2836, 0, 2845, 0, 2853, 0, 2861, 0,
+        2869, 0, 2877, 0, 2885, 0, 2893, 0, 2902, 0, 2912, 0, 2921, 0, 2929, 0,
+        2937, 0, 2945, 0, 2953, 0, 2961, 0, 2969, 0, 2977, 0, 2985, 0, 2993, 0,
+        3001, 0, 3009, 0, 3017, 0, 3022, 3025, 3028, 3031, 3034, 2799, 0, 0, 193, 0,
+        3043, 0, 3051, 0, 3060, 0, 3070, 0, 3080, 0, 3090, 0, 3100, 0, 3110, 0,
+        3120, 0, 3130, 0, 3140, 0, 3150, 0, 3159, 0, 3167, 0, 3175, 0, 3184, 0,
+        3194, 0, 3204, 0, 3214, 0, 3224, 0, 3233, 0, 3241, 0, 3249, 0, 3257, 0,
+        3266, 0, 3276, 0, 3286, 0, 3296, 0, 3306, 0, 3316, 0, 3326, 0, 3336, 0,
+        3346, 0, 3356, 0, 3365, 0, 3373, 0, 3382, 0, 3392, 0, 3402, 0, 3412, 0,
+        3422, 0, 3431, 0, 3439, 0, 3447, 0, 3455, 0, 3460, 0, 3462, 0, 3464, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 3499, 3504, 3510, 3516, 3522, 3528, 3534, 3540,
+        0, 0, 0, 0, 0, 0, 0, 0, 3567, 3572, 3578, 3584, 3590, 3596, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 3631, 3636, 3642, 3648, 3654, 3660, 3666, 3672,
+        0, 0, 0, 0, 0, 0, 0, 0, 3707, 3712, 3718, 3724, 3730, 3736, 3742, 3748,
+        0, 0, 0, 0, 0, 0, 0, 0, 3775, 3780, 3786, 3792, 3798, 3804, 0, 0,
+        3806, 0, 3812, 0, 3820, 0, 3828, 0, 0, 3839, 0, 3845, 0, 3851, 0, 3857,
+        0, 0, 0, 0, 0, 0, 0, 0, 3892, 3897, 3903, 3909, 3915, 3921, 3927, 3933,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3960, 3967, 3975, 3983, 3991, 3999, 4007, 4015, 3960, 3967, 3975, 3983, 3991, 3999, 4007, 4015,
+        4060, 4067, 4075, 4083, 4091, 4099, 4107, 4115, 4060, 4067, 4075, 4083, 4091, 4099, 4107, 4115,
+        4160, 4167, 4175, 4183, 4191, 4199, 4207, 4215, 4160, 4167, 4175, 4183, 4191, 4199, 4207, 4215,
+        0, 0, 4266, 4272, 4279, 0, 4282, 4289, 4296, 4301, 4306, 4308, 4272, 0, 1241, 0,
+        0, 0, 4320, 4326, 4333, 0, 4336, 4343, 4350, 4352, 4357, 4359, 4326, 0, 0, 0,
+        0, 0, 4379, 1295, 0, 0, 4383, 4386, 4393, 4398, 4403, 4405, 0, 0, 0, 0,
+        0, 0, 4422, 1365, 4426, 0, 4432, 4435, 4442, 4447, 4452, 4454, 4459, 0, 0, 0,
+        0, 0, 4470, 4476, 4483, 0, 4486, 4493, 4500, 4502, 4507, 4509, 4476, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1341, 0, 0, 0, 21, 83, 0, 0, 0, 0,
+        0, 0, 4524, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4526, 4528, 4530, 4532, 4534, 4536, 4538, 4540, 4542, 4544, 4546, 4548, 4550, 4552, 4554, 4556,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4558, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4696, 4698, 4700, 4702, 4704, 4706, 4708, 4710, 4712, 4714,
+        4716, 4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734, 4736, 4738, 4740, 4742, 4744, 4746,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4751, 4753, 4755, 4757, 4759, 4761, 4763, 4765, 4767, 4769, 4771, 4773, 4775, 4777, 4779, 4781,
+        4783, 4785, 4787, 4789, 4791, 4793, 4795, 4797, 4799, 4801, 4803, 4805, 4807, 4809, 4811, 4813,
+        4815, 4817, 4819, 4821, 4823, 4825, 4827, 4829, 4831, 4833, 4835, 4837, 4839, 4841, 4843, 4845,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4847, 0, 4849, 4851, 4853, 0, 0, 4855, 0, 4857, 0, 4859, 0, 4861, 4863, 4865,
+        4867, 0, 4869, 0, 0, 4871, 0, 0, 0, 0, 0, 0, 0, 0, 4873, 4875,
+        4877, 0, 4879, 0, 4881, 0, 4883, 0, 4885, 0, 4887, 0, 4889, 0, 4891, 0,
+        4893, 0, 4895, 0, 4897, 0, 4899, 0, 4901, 0, 4903, 0, 4905, 0, 4907, 0,
+        4909, 0, 4911, 0, 4913, 0, 4915, 0, 4917, 0, 4919, 0, 4921, 0, 4923, 0,
+        4925, 0, 4927, 0, 4929, 0, 4931, 0, 4933, 0, 4935, 0, 4937, 0, 4939, 0,
+        4941, 0, 4943, 0, 4945, 0, 4947, 0, 4949, 0, 4951, 0, 4953, 0, 4955, 0,
+        4957, 0, 4959, 0, 4961, 0, 4963, 0, 4965, 0, 4967, 0, 4969, 0, 4971, 0,
+        4973, 0, 4975, 0, 0, 0, 0, 0, 0, 0, 0, 4977, 0, 4979, 0, 0,
+        0, 0, 4981, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5157, 0, 5159, 0, 5161, 0, 5163, 0, 5165, 0, 2296, 0, 5167, 0, 5169, 0,
+        5171, 0, 5173, 0, 5175, 0, 5177, 0, 5179, 0, 5181, 0, 5183, 0, 5185, 0,
+        5187, 0, 5189, 0, 5191, 0, 5193, 0, 5195, 0, 5197, 0, 5199, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5201, 0, 5203, 0, 5205, 0, 5207, 0, 5209, 0, 5211, 0, 5213, 0, 5215, 0,
+        5217, 0, 5219, 0, 5221, 0, 5223, 0, 5225, 0, 5227, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 5229, 0, 5231, 0, 5233, 0, 5235, 0, 5237, 0, 5239, 0, 5241, 0,
+        0, 0, 5243, 0, 5245, 0, 5247, 0, 5249, 0, 5251, 0, 5253, 0, 5255, 0,
+        5257, 0, 5259, 0, 5261, 0, 5263, 0, 5265, 0, 5267, 0, 5269, 0, 5271, 0,
+        5273, 0, 5275, 0, 5277, 0, 5279, 0, 5281, 0, 5283, 0, 5285, 0, 5287, 0,
+        5289, 0, 5291, 0, 5293, 0, 5295, 0, 5297, 0, 5299, 0, 5301, 0, 5303, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 5305, 0, 5307, 0, 5309, 5311, 0,
+        5313, 0, 5315, 0, 5317, 0, 5319, 0, 0, 0, 0, 5321, 0, 5323, 0, 0,
+        5325, 0, 5327, 0, 0, 0, 5329, 0, 5331, 0, 5333, 0, 5335, 0, 5337, 0,
+        5339, 0, 5341, 0, 5343, 0, 5345, 0, 5347, 0, 5349, 5351, 5353, 5355, 5357, 0,
+        5359, 5361, 5363, 5365, 5367, 0, 5369, 0, 5371, 0, 5373, 0, 5375, 0, 5377, 0,
+        5379, 0, 5381, 0, 5383, 5385, 5387, 5389, 0, 5391, 0, 0, 0, 0, 0, 0,
+        5393, 0, 0, 0, 0, 0, 5395, 0, 5397, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 5399, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5401, 5403, 5405, 5407, 5409, 5411, 5413, 5415, 5417, 5419, 5421, 5423, 5425, 5427, 5429, 5431,
+        5433, 5435, 5437, 5439, 5441, 5443, 5445, 5447, 5449, 5451, 5453, 5455, 5457, 5459, 5461, 5463,
+        5465, 5467, 5469, 5471, 5473, 5475, 5477, 5479, 5481, 5483, 5485, 5487, 5489, 5491, 5493, 5495,
+        5497, 5499, 5501, 5503, 5505, 5507, 5509, 5511, 5513, 5515, 5517, 5519, 5521, 5523, 5525, 5527,
+        5529, 5531, 5533, 5535, 5537, 5539, 5541, 5543, 5545, 5547, 5549, 5551, 5553, 5555, 5557, 5559,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6411, 6414, 6417, 6420, 6424, 6428, 6428, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 6431, 6434, 6437, 6440, 6443, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 6550, 6552, 6554, 6556, 6558, 6560, 6562, 6564, 6566, 6568, 6570, 6572, 6574, 6576, 6578,
+        6580, 6582, 6584, 6586, 6588, 6590, 6592, 6594, 6596, 6598, 6600, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6602, 6604, 6606, 6608, 6610, 6612, 6614, 6616, 6618, 6620, 6622, 6624, 6626, 6628, 6630, 6632,
+        6634, 6636, 6638, 6640, 6642, 6644, 6646, 6648, 6650, 6652, 6654, 6656, 6658, 6660, 6662, 6664,
+        6666, 6668, 6670, 6672, 6674, 6676, 6678, 6680, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6682, 6684, 6686, 6688, 6690, 6692, 6694, 6696, 6698, 6700, 6702, 6704, 6706, 6708, 6710, 6712,
+        6714, 6716, 6718, 6720, 6722, 6724, 6726, 6728, 6730, 6732, 6734, 6736, 6738, 6740, 6742, 6744,
+        6746, 6748, 6750, 6752, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6754, 6756, 6758, 6760, 6762, 6764, 6766, 6768, 6770, 6772, 6774, 0, 6776, 6778, 6780, 6782,
+        6784, 6786, 6788, 6790, 6792, 6794, 6796, 6798, 6800, 6802, 6804, 0, 6806, 6808, 6810, 6812,
+        6814, 6816, 6818, 0, 6820, 6822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6824, 6826, 6828, 6830, 6832, 6834, 6836, 6838, 6840, 6842, 6844, 6846, 6848, 6850, 6852, 6854,
+        6856, 6858, 6860, 6862, 6864, 6866, 6868, 6870, 6872, 6874, 6876, 6878, 6880, 6882, 6884, 6886,
+        6888, 6890, 6892, 6894, 6896, 6898, 6900, 6902, 6904, 6906, 6908, 6910, 6912, 6914, 6916, 6918,
+        6920, 6922, 6924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        6962, 6964, 6966, 6968, 6970, 6972, 6974, 6976, 6978, 6980, 6982, 6984, 6986, 6988, 6990, 6992,
+        6994, 6996, 6998, 7000, 7002, 7004, 7006, 7008, 7010, 7012, 7014, 7016, 7018, 7020, 7022, 7024,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7029, 7031, 7033, 7035, 7037, 7039, 7041, 7043, 7045, 7047, 7049, 7051, 7053, 7055, 7057, 7059,
+        7061, 7063, 7065, 7067, 7069, 7071, 7073, 7075, 7077, 7079, 7081, 7083, 7085, 7087, 7089, 7091,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7141, 7143, 7145, 7147, 7149, 7151, 7153, 7155, 7157, 7159, 7161, 7163, 7165, 7167, 7169, 7171,
+        7173, 7175, 7177, 7179, 7181, 7183, 7185, 7187, 7189, 7191, 7193, 7195, 7197, 7199, 7201, 7203,
+        7205, 7207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    static const uint32_t cstr_unicode_sequences[8163] =
+    {
+        0x0, 0x1, 0x61, 0x1, 0x62, 0x1, 0x63, 0x1,
+        0x64, 0x1, 0x65, 0x1, 0x66, 0x1, 0x67, 0x1,
+        0x68, 0x1, 0x69, 0x1, 0x6A, 0x1, 0x6B, 0x1,
+        0x6C, 0x1, 0x6D, 0x1, 0x6E, 0x1, 0x6F, 0x1,
+        0x70, 0x1, 0x71, 0x1, 0x72, 0x1, 0x73, 0x1,
+        0x74, 0x1, 0x75, 0x1, 0x76, 0x1, 0x77, 0x1,
+        0x78, 0x1, 0x79, 0x1, 0x7A, 0x1, 0x3BC, 0x2,
+        0x41, 0x300, 0x1, 0xE0, 0x2, 0x41, 0x301, 0x1,
+        0xE1, 0x2, 0x41, 0x302, 0x1, 0xE2, 0x2, 0x41,
+        0x303, 0x1, 0xE3, 0x2, 0x41, 0x308, 0x1, 0xE4,
+        0x2, 0x41, 0x30A, 0x1, 0xE5, 0x1, 0xE6, 0x2,
+        0x43, 0x327, 0x1, 0xE7, 0x2, 0x45, 0x300, 0x1,
+        0xE8, 0x2, 0x45, 0x301, 0x1, 0xE9, 0x2, 0x45,
+        0x302, 0x1, 0xEA, 0x2, 0x45, 0x308, 0x1, 0xEB,
+        0x2, 0x49, 0x300, 0x1, 0xEC, 0x2, 0x49, 0x301,
+        0x1, 0xED, 0x2, 0x49, 0x302, 0x1, 0xEE, 0x2,
+        0x49, 0x308, 0x1, 0xEF, 0x1, 0xF0, 0x2, 0x4E,
+        0x303, 0x1, 0xF1, 0x2, 0x4F, 0x300, 0x1, 0xF2,
+        0x2, 0x4F, 0x301, 0x1, 0xF3, 0x2, 0x4F, 0x302,
+        0x1, 0xF4, 0x2, 0x4F, 0x303, 0x1, 0xF5, 0x2,
+        0x4F, 0x308, 0x1, 0xF6, 0x1, 0xF8, 0x2, 0x55,
+        0x300, 0x1, 0xF9, 0x2, 0x55, 0x301, 0x1, 0xFA,
+        0x2, 0x55, 0x302, 0x1, 0xFB, 0x2, 0x55, 0x308,
+        0x1, 0xFC, 0x2, 0x59, 0x301, 0x1, 0xFD, 0x1,
+        0xFE, 0x2, 0x73, 0x73, 0x2, 0x61, 0x300, 0x2,
+        0x61, 0x301, 0x2, 0x61, 0x302, 0x2, 0x61, 0x303,
+        0x2, 0x61, 0x308, 0x2, 0x61, 0x30A, 0x2, 0x63,
+        0x327, 0x2, 0x65, 0x300, 0x2, 0x65, 0x301, 0x2,
+        0x65, 0x302, 0x2, 0x65, 0x308, 0x2, 0x69, 0x300,
+        0x2, 0x69, 0x301, 0x2, 0x69, 0x302, 0x2, 0x69,
+        0x308, 0x2, 0x6E, 0x303, 0x2, 0x6F, 0x300, 0x2,
+        0x6F, 0x301, 0x2, 0x6F, 0x302, 0x2, 0x6F, 0x303,
+        0x2, 0x6F, 0x308, 0x2, 0x75, 0x300, 0x2, 0x75,
+        0x301, 0x2, 0x75, 0x302, 0x2, 0x75, 0x308, 0x2,
+        0x79, 0x301, 0x2, 0x79, 0x308, 0x2, 0x41, 0x304,
+        0x1, 0x101, 0x2, 0x61, 0x304, 0x2, 0x41, 0x306,
+        0x1, 0x103, 0x2, 0x61, 0x306, 0x2, 0x41, 0x328,
+        0x1, 0x105, 0x2, 0x61, 0x328, 0x2, 0x43, 0x301,
+        0x1, 0x107, 0x2, 0x63, 0x301, 0x2, 0x43, 0x302,
+        0x1, 0x109, 0x2, 0x63, 0x302, 0x2, 0x43, 0x307,
+        0x1, 0x10B, 0x2, 0x63, 0x307, 0x2, 0x43, 0x30C,
+        0x1, 0x10D, 0x2, 0x63, 0x30C, 0x2, 0x44, 0x30C,
+        0x1, 0x10F, 0x2, 0x64, 0x30C, 0x1, 0x111, 0x2,
+        0x45, 0x304, 0x1, 0x113, 0x2, 0x65, 0x304, 0x2,
+        0x45, 0x306, 0x1, 0x115, 0x2, 0x65, 0x306, 0x2,
+        0x45, 0x307, 0x1, 0x117, 0x2, 0x65, 0x307, 0x2,
+        0x45, 0x328, 0x1, 0x119, 0x2, 0x65, 0x328, 0x2,
+        0x45, 0x30C, 0x1, 0x11B, 0x2, 0x65, 0x30C, 0x2,
+        0x47, 0x302, 0x1, 0x11D, 0x2, 0x67, 0x302, 0x2,
+        0x47, 0x306, 0x1, 0x11F, 0x2, 0x67, 0x306, 0x2,
+        0x47, 0x307, 0x1, 0x121, 0x2, 0x67, 0x307, 0x2,
+        0x47, 0x327, 0x1, 0x123, 0x2, 0x67, 0x327, 0x2,
+        0x48, 0x302, 0x1, 0x125, 0x2, 0x68, 0x302, 0x1,
+        0x127, 0x2, 0x49, 0x303, 0x1, 0x129, 0x2, 0x69,
+        0x303, 0x2, 0x49, 0x304, 0x1, 0x12B, 0x2, 0x69,
+        0x304, 0x2, 0x49, 0x306, 0x1, 0x12D, 0x2, 0x69,
+        0x306, 0x2, 0x49, 0x328, 0x1, 0x12F, 0x2, 0x69,
+        0x328, 0x2, 0x49, 0x307, 0x2, 0x69, 0x307, 0x1,
+        0x133, 0x2, 0x4A, 0x302, 0x1, 0x135, 0x2, 0x6A,
+        0x302, 0x2, 0x4B, 0x327, 0x1, 0x137, 0x2, 0x6B,
+        0x327, 0x2, 0x4C, 0x301, 0x1, 0x13A, 0x2, 0x6C,
+        0x301, 0x2, 0x4C, 0x327, 0x1, 0x13C, 0x2, 0x6C,
+        0x327, 0x2, 0x4C, 0x30C, 0x1, 0x13E, 0x2, 0x6C,
+        0x30C, 0x1, 0x140, 0x1, 0x142, 0x2, 0x4E, 0x301,
+        0x1, 0x144, 0x2, 0x6E, 0x301, 0x2, 0x4E, 0x327,
+        0x1, 0x146, 0x2, 0x6E, 0x327, 0x2, 0x4E, 0x30C,
+        0x1, 0x148, 0x2, 0x6E, 0x30C, 0x2, 0x2BC, 0x6E,
+        0x1, 0x14B, 0x2, 0x4F, 0x304, 0x1, 0x14D, 0x2,
+        0x6F, 0x304, 0x2, 0x4F, 0x306, 0x1, 0x14F, 0x2,
+        0x6F, 0x306, 0x2, 0x4F, 0x30B, 0x1, 0x151, 0x2,
+        0x6F, 0x30B, 0x1, 0x153, 0x2, 0x52, 0x301, 0x1,
+        0x155, 0x2, 0x72, 0x301, 0x2, 0x52, 0x327, 0x1,
+        0x157, 0x2, 0x72, 0x327, 0x2, 0x52, 0x30C, 0x1,
+        0x159, 0x2, 0x72, 0x30C, 0x2, 0x53, 0x301, 0x1,
+        0x15B, 0x2, 0x73, 0x301, 0x2, 0x53, 0x302, 0x1,
+        0x15D, 0x2, 0x73, 0x302, 0x2, 0x53, 0x327, 0x1,
+        0x15F, 0x2, 0x73, 0x327, 0x2, 0x53, 0x30C, 0x1,
+        0x161, 0x2, 0x73, 0x30C, 0x2, 0x54, 0x327, 0x1,
+        0x163, 0x2, 0x74, 0x327, 0x2, 0x54, 0x30C, 0x1,
+        0x165, 0x2, 0x74, 0x30C, 0x1, 0x167, 0x2, 0x55,
+        0x303, 0x1, 0x169, 0x2, 0x75, 0x303, 0x2, 0x55,
+        0x304, 0x1, 0x16B, 0x2, 0x75, 0x304, 0x2, 0x55,
+        0x306, 0x1, 0x16D, 0x2, 0x75, 0x306, 0x2, 0x55,
+        0x30A, 0x1, 0x16F, 0x2, 0x75, 0x30A, 0x2, 0x55,
+        0x30B, 0x1, 0x171, 0x2, 0x75, 0x30B, 0x2, 0x55,
+        0x328, 0x1, 0x173, 0x2, 0x75, 0x328, 0x2, 0x57,
+        0x302, 0x1, 0x175, 0x2, 0x77, 0x302, 0x2, 0x59,
+        0x302, 0x1, 0x177, 0x2, 0x79, 0x302, 0x2, 0x59,
+        0x308, 0x1, 0xFF, 0x2, 0x5A, 0x301, 0x1, 0x17A,
+        0x2, 0x7A, 0x301, 0x2, 0x5A, 0x307, 0x1, 0x17C,
+        0x2, 0x7A, 0x307, 0x2, 0x5A, 0x30C, 0x1, 0x17E,
+        0x2, 0x7A, 0x30C, 0x1, 0x253, 0x1, 0x183, 0x1,
+        0x185, 0x1, 0x254, 0x1, 0x188, 0x1, 0x256, 0x1,
+        0x257, 0x1, 0x18C, 0x1, 0x1DD, 0x1, 0x259, 0x1,
+        0x25B, 0x1, 0x192, 0x1, 0x260, 0x1, 0x263, 0x1,
+        0x269, 0x1, 0x268, 0x1, 0x199, 0x1, 0x26F, 0x1,
+        0x272, 0x1, 0x275, 0x2, 0x4F, 0x31B, 0x1, 0x1A1,
+        0x2, 0x6F, 0x31B, 0x1, 0x1A3, 0x1, 0x1A5, 0x1,
+        0x280, 0x1, 0x1A8, 0x1, 0x283, 0x1, 0x1AD, 0x1,
+        0x288, 0x2, 0x55, 0x31B, 0x1, 0x1B0, 0x2, 0x75,
+        0x31B, 0x1, 0x28A, 0x1, 0x28B, 0x1, 0x1B4, 0x1,
+        0x1B6, 0x1, 0x292, 0x1, 0x1B9, 0x1, 0x1BD, 0x1,
+        0x1C6, 0x1, 0x1C9, 0x1, 0x1CC, 0x2, 0x41, 0x30C,
+        0x1, 0x1CE, 0x2, 0x61, 0x30C, 0x2, 0x49, 0x30C,
+        0x1, 0x1D0, 0x2, 0x69, 0x30C, 0x2, 0x4F, 0x30C,
+        0x1, 0x1D2, 0x2, 0x6F, 0x30C, 0x2, 0x55, 0x30C,
+        0x1, 0x1D4, 0x2, 0x75, 0x30C, 0x3, 0x55, 0x308,
+        0x304, 0x1, 0x1D6, 0x3, 0x75, 0x308, 0x304, 0x3,
+        0x55, 0x308, 0x301, 0x1, 0x1D8, 0x3, 0x75, 0x308,
+        0x301, 0x3, 0x55, 0x308, 0x30C, 0x1, 0x1DA, 0x3,
+        0x75, 0x308, 0x30C, 0x3, 0x55, 0x308, 0x300, 0x1,
+        0x1DC, 0x3, 0x75, 0x308, 0x300, 0x3, 0x41, 0x308,
+        0x304, 0x1, 0x1DF, 0x3, 0x61, 0x308, 0x304, 0x3,
+        0x41, 0x307, 0x304, 0x1, 0x1E1, 0x3, 0x61, 0x307,
+        0x304, 0x2, 0xC6, 0x304, 0x1, 0x1E3, 0x2, 0xE6,
+        0x304, 0x1, 0x1E5, 0x2, 0x47, 0x30C, 0x1, 0x1E7,
+        0x2, 0x67, 0x30C, 0x2, 0x4B, 0x30C, 0x1, 0x1E9,
+        0x2, 0x6B, 0x30C, 0x2, 0x4F, 0x328, 0x1, 0x1EB,
+        0x2, 0x6F, 0x328, 0x3, 0x4F, 0x328, 0x304, 0x1,
+        0x1ED, 0x3, 0x6F, 0x328, 0x304, 0x2, 0x1B7, 0x30C,
+        0x1, 0x1EF, 0x2, 0x292, 0x30C, 0x2, 0x6A, 0x30C,
+        0x1, 0x1F3, 0x2, 0x47, 0x301, 0x1, 0x1F5, 0x2,
+        0x67, 0x301, 0x1, 0x195, 0x1, 0x1BF, 0x2, 0x4E,
+        0x300, 0x1, 0x1F9, 0x2, 0x6E, 0x300, 0x3, 0x41,
+        0x30A, 0x301, 0x1, 0x1FB, 0x3, 0x61, 0x30A, 0x301,
+        0x2, 0xC6, 0x301, 0x1, 0x1FD, 0x2, 0xE6, 0x301,
+        0x2, 0xD8, 0x301, 0x1, 0x1FF, 0x2, 0xF8, 0x301,
+        0x2, 0x41, 0x30F, 0x1, 0x201, 0x2, 0x61, 0x30F,
+        0x2, 0x41, 0x311, 0x1, 0x203, 0x2, 0x61, 0x311,
+        0x2, 0x45, 0x30F, 0x1, 0x205, 0x2, 0x65, 0x30F,
+        0x2, 0x45, 0x311, 0x1, 0x207, 0x2, 0x65, 0x311,
+        0x2, 0x49, 0x30F, 0x1, 0x209, 0x2, 0x69, 0x30F,
+        0x2, 0x49, 0x311, 0x1, 0x20B, 0x2, 0x69, 0x311,
+        0x2, 0x4F, 0x30F, 0x1, 0x20D, 0x2, 0x6F, 0x30F,
+        0x2, 0x4F, 0x311, 0x1, 0x20F, 0x2, 0x6F, 0x311,
+        0x2, 0x52, 0x30F, 0x1, 0x211, 0x2, 0x72, 0x30F,
+        0x2, 0x52, 0x311, 0x1, 0x213, 0x2, 0x72, 0x311,
+        0x2, 0x55, 0x30F, 0x1, 0x215, 0x2, 0x75, 0x30F,
+        0x2, 0x55, 0x311, 0x1, 0x217, 0x2, 0x75, 0x311,
+        0x2, 0x53, 0x326, 0x1, 0x219, 0x2, 0x73, 0x326,
+        0x2, 0x54, 0x326, 0x1, 0x21B, 0x2, 0x74, 0x326,
+        0x1, 0x21D, 0x2, 0x48, 0x30C, 0x1, 0x21F, 0x2,
+        0x68, 0x30C, 0x1, 0x19E, 0x1, 0x223, 0x1, 0x225,
+        0x2, 0x41, 0x307, 0x1, 0x227, 0x2, 0x61, 0x307,
+        0x2, 0x45, 0x327, 0x1, 0x229, 0x2, 0x65, 0x327,
+        0x3, 0x4F, 0x308, 0x304, 0x1, 0x22B, 0x3, 0x6F,
+        0x308, 0x304, 0x3, 0x4F, 0x303, 0x304, 0x1, 0x22D,
+        0x3, 0x6F, 0x303, 0x304, 0x2, 0x4F, 0x307, 0x1,
+        0x22F, 0x2, 0x6F, 0x307, 0x3, 0x4F, 0x307, 0x304,
+        0x1, 0x231, 0x3, 0x6F, 0x307, 0x304, 0x2, 0x59,
+        0x304, 0x1, 0x233, 0x2, 0x79, 0x304, 0x1, 0x2C65,
+        0x1, 0x23C, 0x1, 0x19A, 0x1, 0x2C66, 0x1, 0x242,
+        0x1, 0x180, 0x1, 0x289, 0x1, 0x28C, 0x1, 0x247,
+        0x1, 0x249, 0x1, 0x24B, 0x1, 0x24D, 0x1, 0x24F,
+        0x1, 0x300, 0x1, 0x301, 0x1, 0x313, 0x2, 0x308,
+        0x301, 0x1, 0x3B9, 0x1, 0x371, 0x1, 0x373, 0x1,
+        0x2B9, 0x1, 0x377, 0x1, 0x3B, 0x1, 0x3F3, 0x2,
+        0xA8, 0x301, 0x2, 0x391, 0x301, 0x1, 0x3AC, 0x1,
+        0xB7, 0x2, 0x395, 0x301, 0x1, 0x3AD, 0x2, 0x397,
+        0x301, 0x1, 0x3AE, 0x2, 0x399, 0x301, 0x1, 0x3AF,
+        0x2, 0x39F, 0x301, 0x1, 0x3CC, 0x2, 0x3A5, 0x301,
+        0x1, 0x3CD, 0x2, 0x3A9, 0x301, 0x1, 0x3CE, 0x3,
+        0x3B9, 0x308, 0x301, 0x1, 0x3B1, 0x1, 0x3B2, 0x1,
+        0x3B3, 0x1, 0x3B4, 0x1, 0x3B5, 0x1, 0x3B6, 0x1,
+        0x3B7, 0x1, 0x3B8, 0x1, 0x3BA, 0x1, 0x3BB, 0x1,
+        0x3BD, 0x1, 0x3BE, 0x1, 0x3BF, 0x1, 0x3C0, 0x1,
+        0x3C1, 0x1, 0x3C3, 0x1, 0x3C4, 0x1, 0x3C5, 0x1,
+        0x3C6, 0x1, 0x3C7, 0x1, 0x3C8, 0x1, 0x3C9, 0x2,
+        0x399, 0x308, 0x1, 0x3CA, 0x2, 0x3A5, 0x308, 0x1,
+        0x3CB, 0x2, 0x3B1, 0x301, 0x2, 0x3B5, 0x301, 0x2,
+        0x3B7, 0x301, 0x2, 0x3B9, 0x301, 0x3, 0x3C5, 0x308,
+        0x301, 0x2, 0x3B9, 0x308, 0x2, 0x3C5, 0x308, 0x2,
+        0x3BF, 0x301, 0x2, 0x3C5, 0x301, 0x2, 0x3C9, 0x301,
+        0x1, 0x3D7, 0x2, 0x3D2, 0x301, 0x2, 0x3D2, 0x308,
+        0x1, 0x3D9, 0x1, 0x3DB, 0x1, 0x3DD, 0x1, 0x3DF,
+        0x1, 0x3E1, 0x1, 0x3E3, 0x1, 0x3E5, 0x1, 0x3E7,
+        0x1, 0x3E9, 0x1, 0x3EB, 0x1, 0x3ED, 0x1, 0x3EF,
+        0x1, 0x3F8, 0x1, 0x3F2, 0x1, 0x3FB, 0x1, 0x37B,
+        0x1, 0x37C, 0x1, 0x37D, 0x2, 0x415, 0x300, 0x1,
+        0x450, 0x2, 0x415, 0x308, 0x1, 0x451, 0x1, 0x452,
+        0x2, 0x413, 0x301, 0x1, 0x453, 0x1, 0x454, 0x1,
+        0x455, 0x1, 0x456, 0x2, 0x406, 0x308, 0x1, 0x457,
+        0x1, 0x458, 0x1, 0x459, 0x1, 0x45A, 0x1, 0x45B,
+        0x2, 0x41A, 0x301, 0x1, 0x45C, 0x2, 0x418, 0x300,
+        0x1, 0x45D, 0x2, 0x423, 0x306, 0x1, 0x45E, 0x1,
+        0x45F, 0x1, 0x430, 0x1, 0x431, 0x1, 0x432, 0x1,
+        0x433, 0x1, 0x434, 0x1, 0x435, 0x1, 0x436, 0x1,
+        0x437, 0x1, 0x438, 0x2, 0x418, 0x306, 0x1, 0x439,
+        0x1, 0x43A, 0x1, 0x43B, 0x1, 0x43C, 0x1, 0x43D,
+        0x1, 0x43E, 0x1, 0x43F, 0x1, 0x440, 0x1, 0x441,
+        0x1, 0x442, 0x1, 0x443, 0x1, 0x444, 0x1, 0x445,
+        0x1, 0x446, 0x1, 0x447, 0x1, 0x448, 0x1, 0x449,
+        0x1, 0x44A, 0x1, 0x44B, 0x1, 0x44C, 0x1, 0x44D,
+        0x1, 0x44E, 0x1, 0x44F, 0x2, 0x438, 0x306, 0x2,
+        0x435, 0x300, 0x2, 0x435, 0x308, 0x2, 0x433, 0x301,
+        0x2, 0x456, 0x308, 0x2, 0x43A, 0x301, 0x2, 0x438,
+        0x300, 0x2, 0x443, 0x306, 0x1, 0x461, 0x1, 0x463,
+        0x1, 0x465, 0x1, 0x467, 0x1, 0x469, 0x1, 0x46B,
+        0x1, 0x46D, 0x1, 0x46F, 0x1, 0x471, 0x1, 0x473,
+        0x1, 0x475, 0x2, 0x474, 0x30F, 0x1, 0x477, 0x2,
+        0x475, 0x30F, 0x1, 0x479, 0x1, 0x47B, 0x1, 0x47D,
+        0x1, 0x47F, 0x1, 0x481, 0x1, 0x48B, 0x1, 0x48D,
+        0x1, 0x48F, 0x1, 0x491, 0x1, 0x493, 0x1, 0x495,
+        0x1, 0x497, 0x1, 0x499, 0x1, 0x49B, 0x1, 0x49D,
+        0x1, 0x49F, 0x1, 0x4A1, 0x1, 0x4A3, 0x1, 0x4A5,
+        0x1, 0x4A7, 0x1, 0x4A9, 0x1, 0x4AB, 0x1, 0x4AD,
+        0x1, 0x4AF, 0x1, 0x4B1, 0x1, 0x4B3, 0x1, 0x4B5,
+        0x1, 0x4B7, 0x1, 0x4B9, 0x1, 0x4BB, 0x1, 0x4BD,
+        0x1, 0x4BF, 0x1, 0x4CF, 0x2, 0x416, 0x306, 0x1,
+        0x4C2, 0x2, 0x436, 0x306, 0x1, 0x4C4, 0x1, 0x4C6,
+        0x1, 0x4C8, 0x1, 0x4CA, 0x1, 0x4CC, 0x1, 0x4CE,
+        0x2, 0x410, 0x306, 0x1, 0x4D1, 0x2, 0x430, 0x306,
+        0x2, 0x410, 0x308, 0x1, 0x4D3, 0x2, 0x430, 0x308,
+        0x1, 0x4D5, 0x2, 0x415, 0x306, 0x1, 0x4D7, 0x2,
+        0x435, 0x306, 0x1, 0x4D9, 0x2, 0x4D8, 0x308, 0x1,
+        0x4DB, 0x2, 0x4D9, 0x308, 0x2, 0x416, 0x308, 0x1,
+        0x4DD, 0x2, 0x436, 0x308, 0x2, 0x417, 0x308, 0x1,
+        0x4DF, 0x2, 0x437, 0x308, 0x1, 0x4E1, 0x2, 0x418,
+        0x304, 0x1, 0x4E3, 0x2, 0x438, 0x304, 0x2, 0x418,
+        0x308, 0x1, 0x4E5, 0x2, 0x438, 0x308, 0x2, 0x41E,
+        0x308, 0x1, 0x4E7, 0x2, 0x43E, 0x308, 0x1, 0x4E9,
+        0x2, 0x4E8, 0x308, 0x1, 0x4EB, 0x2, 0x4E9, 0x308,
+        0x2, 0x42D, 0x308, 0x1, 0x4ED, 0x2, 0x44D, 0x308,
+        0x2, 0x423, 0x304, 0x1, 0x4EF, 0x2, 0x443, 0x304,
+        0x2, 0x423, 0x308, 0x1, 0x4F1, 0x2, 0x443, 0x308,
+        0x2, 0x423, 0x30B, 0x1, 0x4F3, 0x2, 0x443, 0x30B,
+        0x2, 0x427, 0x308, 0x1, 0x4F5, 0x2, 0x447, 0x308,
+        0x1, 0x4F7, 0x2, 0x42B, 0x308, 0x1, 0x4F9, 0x2,
+        0x44B, 0x308, 0x1, 0x4FB, 0x1, 0x4FD, 0x1, 0x4FF,
+        0x1, 0x501, 0x1, 0x503, 0x1, 0x505, 0x1, 0x507,
+        0x1, 0x509, 0x1, 0x50B, 0x1, 0x50D, 0x1, 0x50F,
+        0x1, 0x511, 0x1, 0x513, 0x1, 0x515, 0x1, 0x517,
+        0x1, 0x519, 0x1, 0x51B, 0x1, 0x51D, 0x1, 0x51F,
+        0x1, 0x521, 0x1, 0x523, 0x1, 0x525, 0x1, 0x527,
+        0x1, 0x529, 0x1, 0x52B, 0x1, 0x52D, 0x1, 0x52F,
+        0x1, 0x561, 0x1, 0x562, 0x1, 0x563, 0x1, 0x564,
+        0x1, 0x565, 0x1, 0x566, 0x1, 0x567, 0x1, 0x568,
+        0x1, 0x569, 0x1, 0x56A, 0x1, 0x56B, 0x1, 0x56C,
+        0x1, 0x56D, 0x1, 0x56E, 0x1, 0x56F, 0x1, 0x570,
+        0x1, 0x571, 0x1, 0x572, 0x1, 0x573, 0x1, 0x574,
+        0x1, 0x575, 0x1, 0x576, 0x1, 0x577, 0x1, 0x578,
+        0x1, 0x579, 0x1, 0x57A, 0x1, 0x57B, 0x1, 0x57C,
+        0x1, 0x57D, 0x1, 0x57E, 0x1, 0x57F, 0x1, 0x580,
+        0x1, 0x581, 0x1, 0x582, 0x1, 0x583, 0x1, 0x584,
+        0x1, 0x585, 0x1, 0x586, 0x2, 0x565, 0x582, 0x2,
+        0x627, 0x653, 0x2, 0x627, 0x654, 0x2, 0x648, 0x654,
+        0x2, 0x627, 0x655, 0x2, 0x64A, 0x654, 0x2, 0x6D5,
+        0x654, 0x2, 0x6C1, 0x654, 0x2, 0x6D2, 0x654, 0x2,
+        0x928, 0x93C, 0x2, 0x930, 0x93C, 0x2, 0x933, 0x93C,
+        0x2, 0x915, 0x93C, 0x2, 0x916, 0x93C, 0x2, 0x917,
+        0x93C, 0x2, 0x91C, 0x93C, 0x2, 0x921, 0x93C, 0x2,
+        0x922, 0x93C, 0x2, 0x92B, 0x93C, 0x2, 0x92F, 0x93C,
+        0x2, 0x9C7, 0x9BE, 0x2, 0x9C7, 0x9D7, 0x2, 0x9A1,
+        0x9BC, 0x2, 0x9A2, 0x9BC, 0x2, 0x9AF, 0x9BC, 0x2,
+        0xA32, 0xA3C, 0x2, 0xA38, 0xA3C, 0x2, 0xA16, 0xA3C,
+        0x2, 0xA17, 0xA3C, 0x2, 0xA1C, 0xA3C, 0x2, 0xA2B,
+        0xA3C, 0x2, 0xB47, 0xB56, 0x2, 0xB47, 0xB3E, 0x2,
+        0xB47, 0xB57, 0x2, 0xB21, 0xB3C, 0x2, 0xB22, 0xB3C,
+        0x2, 0xB92, 0xBD7, 0x2, 0xBC6, 0xBBE, 0x2, 0xBC7,
+        0xBBE, 0x2, 0xBC6, 0xBD7, 0x2, 0xC46, 0xC56, 0x2,
+        0xCBF, 0xCD5, 0x2, 0xCC6, 0xCD5, 0x2, 0xCC6, 0xCD6,
+        0x2, 0xCC6, 0xCC2, 0x3, 0xCC6, 0xCC2, 0xCD5, 0x2,
+        0xD46, 0xD3E, 0x2, 0xD47, 0xD3E, 0x2, 0xD46, 0xD57,
+        0x2, 0xDD9, 0xDCA, 0x2, 0xDD9, 0xDCF, 0x3, 0xDD9,
+        0xDCF, 0xDCA, 0x2, 0xDD9, 0xDDF, 0x2, 0xF42, 0xFB7,
+        0x2, 0xF4C, 0xFB7, 0x2, 0xF51, 0xFB7, 0x2, 0xF56,
+        0xFB7, 0x2, 0xF5B, 0xFB7, 0x2, 0xF40, 0xFB5, 0x2,
+        0xF71, 0xF72, 0x2, 0xF71, 0xF74, 0x2, 0xFB2, 0xF80,
+        0x2, 0xFB3, 0xF80, 0x2, 0xF71, 0xF80, 0x2, 0xF92,
+        0xFB7, 0x2, 0xF9C, 0xFB7, 0x2, 0xFA1, 0xFB7, 0x2,
+        0xFA6, 0xFB7, 0x2, 0xFAB, 0xFB7, 0x2, 0xF90, 0xFB5,
+        0x2, 0x1025, 0x102E, 0x1, 0x2D00, 0x1, 0x2D01, 0x1,
+        0x2D02, 0x1, 0x2D03, 0x1, 0x2D04, 0x1, 0x2D05, 0x1,
+        0x2D06, 0x1, 0x2D07, 0x1, 0x2D08, 0x1, 0x2D09, 0x1,
+        0x2D0A, 0x1, 0x2D0B, 0x1, 0x2D0C, 0x1, 0x2D0D, 0x1,
+        0x2D0E, 0x1, 0x2D0F, 0x1, 0x2D10, 0x1, 0x2D11, 0x1,
+        0x2D12, 0x1, 0x2D13, 0x1, 0x2D14, 0x1, 0x2D15, 0x1,
+        0x2D16, 0x1, 0x2D17, 0x1, 0x2D18, 0x1, 0x2D19, 0x1,
+        0x2D1A, 0x1, 0x2D1B, 0x1, 0x2D1C, 0x1, 0x2D1D, 0x1,
+        0x2D1E, 0x1, 0x2D1F, 0x1, 0x2D20, 0x1, 0x2D21, 0x1,
+        0x2D22, 0x1, 0x2D23, 0x1, 0x2D24, 0x1, 0x2D25, 0x1,
+        0x2D27, 0x1, 0x2D2D, 0x1, 0x13F0, 0x1, 0x13F1, 0x1,
+        0x13F2, 0x1, 0x13F3, 0x1, 0x13F4, 0x1, 0x13F5, 0x2,
+        0x1B05, 0x1B35, 0x2, 0x1B07, 0x1B35, 0x2, 0x1B09, 0x1B35,
+        0x2, 0x1B0B, 0x1B35, 0x2, 0x1B0D, 0x1B35, 0x2, 0x1B11,
+        0x1B35, 0x2, 0x1B3A, 0x1B35, 0x2, 0x1B3C, 0x1B35, 0x2,
+        0x1B3E, 0x1B35, 0x2, 0x1B3F, 0x1B35, 0x2, 0x1B42, 0x1B35,
+        0x1, 0xA64B, 0x1, 0x10D0, 0x1, 0x10D1, 0x1, 0x10D2,
+        0x1, 0x10D3, 0x1, 0x10D4, 0x1, 0x10D5, 0x1, 0x10D6,
+        0x1, 0x10D7, 0x1, 0x10D8, 0x1, 0x10D9, 0x1, 0x10DA,
+        0x1, 0x10DB, 0x1, 0x10DC, 0x1, 0x10DD, 0x1, 0x10DE,
+        0x1, 0x10DF, 0x1, 0x10E0, 0x1, 0x10E1, 0x1, 0x10E2,
+        0x1, 0x10E3, 0x1, 0x10E4, 0x1, 0x10E5, 0x1, 0x10E6,
+        0x1, 0x10E7, 0x1, 0x10E8, 0x1, 0x10E9, 0x1, 0x10EA,
+        0x1, 0x10EB, 0x1, 0x10EC, 0x1, 0x10ED, 0x1, 0x10EE,
+        0x1, 0x10EF, 0x1, 0x10F0, 0x1, 0x10F1, 0x1, 0x10F2,
+        0x1, 0x10F3, 0x1, 0x10F4, 0x1, 0x10F5, 0x1, 0x10F6,
+        0x1, 0x10F7, 0x1, 0x10F8, 0x1, 0x10F9, 0x1, 0x10FA,
+        0x1, 0x10FD, 0x1, 0x10FE, 0x1, 0x10FF, 0x2, 0x41,
+        0x325, 0x1, 0x1E01, 0x2, 0x61, 0x325, 0x2, 0x42,
+        0x307, 0x1, 0x1E03, 0x2, 0x62, 0x307, 0x2, 0x42,
+        0x323, 0x1, 0x1E05, 0x2, 0x62, 0x323, 0x2, 0x42,
+        0x331, 0x1, 0x1E07, 0x2, 0x62, 0x331, 0x3, 0x43,
+        0x327, 0x301, 0x1, 0x1E09, 0x3, 0x63, 0x327, 0x301,
+        0x2, 0x44, 0x307, 0x1, 0x1E0B, 0x2, 0x64, 0x307,
+        0x2, 0x44, 0x323, 0x1, 0x1E0D, 0x2, 0x64, 0x323,
+        0x2, 0x44, 0x331, 0x1, 0x1E0F, 0x2, 0x64, 0x331,
+        0x2, 0x44, 0x327, 0x1, 0x1E11, 0x2, 0x64, 0x327,
+        0x2, 0x44, 0x32D, 0x1, 0x1E13, 0x2, 0x64, 0x32D,
+        0x3, 0x45, 0x304, 0x300, 0x1, 0x1E15, 0x3, 0x65,
+        0x304, 0x300, 0x3, 0x45, 0x304, 0x301, 0x1, 0x1E17,
+        0x3, 0x65, 0x304, 0x301, 0x2, 0x45, 0x32D, 0x1,
+        0x1E19, 0x2, 0x65, 0x32D, 0x2, 0x45, 0x330, 0x1,
+        0x1E1B, 0x2, 0x65, 0x330, 0x3, 0x45, 0x327, 0x306,
+        0x1, 0x1E1D, 0x3, 0x65, 0x327, 0x306, 0x2, 0x46,
+        0x307, 0x1, 0x1E1F, 0x2, 0x66, 0x307, 0x2, 0x47,
+        0x304, 0x1, 0x1E21, 0x2, 0x67, 0x304, 0x2, 0x48,
+        0x307, 0x1, 0x1E23, 0x2, 0x68, 0x307, 0x2, 0x48,
+        0x323, 0x1, 0x1E25, 0x2, 0x68, 0x323, 0x2, 0x48,
+        0x308, 0x1, 0x1E27, 0x2, 0x68, 0x308, 0x2, 0x48,
+        0x327, 0x1, 0x1E29, 0x2, 0x68, 0x327, 0x2, 0x48,
+        0x32E, 0x1, 0x1E2B, 0x2, 0x68, 0x32E, 0x2, 0x49,
+        0x330, 0x1, 0x1E2D, 0x2, 0x69, 0x330, 0x3, 0x49,
+        0x308, 0x301, 0x1, 0x1E2F, 0x3, 0x69, 0x308, 0x301,
+        0x2, 0x4B, 0x301, 0x1, 0x1E31, 0x2, 0x6B, 0x301,
+        0x2, 0x4B, 0x323, 0x1, 0x1E33, 0x2, 0x6B, 0x323,
+        0x2, 0x4B, 0x331, 0x1, 0x1E35, 0x2, 0x6B, 0x331,
+        0x2, 0x4C, 0x323, 0x1, 0x1E37, 0x2, 0x6C, 0x323,
+        0x3, 0x4C, 0x323, 0x304, 0x1, 0x1E39, 0x3, 0x6C,
+        0x323, 0x304, 0x2, 0x4C, 0x331, 0x1, 0x1E3B, 0x2,
+        0x6C, 0x331, 0x2, 0x4C, 0x32D, 0x1, 0x1E3D, 0x2,
+        0x6C, 0x32D, 0x2, 0x4D, 0x301, 0x1, 0x1E3F, 0x2,
+        0x6D, 0x301, 0x2, 0x4D, 0x307, 0x1, 0x1E41, 0x2,
+        0x6D, 0x307, 0x2, 0x4D, 0x323, 0x1, 0x1E43, 0x2,
+        0x6D, 0x323, 0x2, 0x4E, 0x307, 0x1, 0x1E45, 0x2,
+        0x6E, 0x307, 0x2, 0x4E, 0x323, 0x1, 0x1E47, 0x2,
+        0x6E, 0x323, 0x2, 0x4E, 0x331, 0x1, 0x1E49, 0x2,
+        0x6E, 0x331, 0x2, 0x4E, 0x32D, 0x1, 0x1E4B, 0x2,
+        0x6E, 0x32D, 0x3, 0x4F, 0x303, 0x301, 0x1, 0x1E4D,
+        0x3, 0x6F, 0x303, 0x301, 0x3, 0x4F, 0x303, 0x308,
+        0x1, 0x1E4F, 0x3, 0x6F, 0x303, 0x308, 0x3, 0x4F,
+        0x304, 0x300, 0x1, 0x1E51, 0x3, 0x6F, 0x304, 0x300,
+        0x3, 0x4F, 0x304, 0x301, 0x1, 0x1E53, 0x3, 0x6F,
+        0x304, 0x301, 0x2, 0x50, 0x301, 0x1, 0x1E55, 0x2,
+        0x70, 0x301, 0x2, 0x50, 0x307, 0x1, 0x1E57, 0x2,
+        0x70, 0x307, 0x2, 0x52, 0x307, 0x1, 0x1E59, 0x2,
+        0x72, 0x307, 0x2, 0x52, 0x323, 0x1, 0x1E5B, 0x2,
+        0x72, 0x323, 0x3, 0x52, 0x323, 0x304, 0x1, 0x1E5D,
+        0x3, 0x72, 0x323, 0x304, 0x2, 0x52, 0x331, 0x1,
+        0x1E5F, 0x2, 0x72, 0x331, 0x2, 0x53, 0x307, 0x1,
+        0x1E61, 0x2, 0x73, 0x307, 0x2, 0x53, 0x323, 0x1,
+        0x1E63, 0x2, 0x73, 0x323, 0x3, 0x53, 0x301, 0x307,
+        0x1, 0x1E65, 0x3, 0x73, 0x301, 0x307, 0x3, 0x53,
+        0x30C, 0x307, 0x1, 0x1E67, 0x3, 0x73, 0x30C, 0x307,
+        0x3, 0x53, 0x323, 0x307, 0x1, 0x1E69, 0x3, 0x73,
+        0x323, 0x307, 0x2, 0x54, 0x307, 0x1, 0x1E6B, 0x2,
+        0x74, 0x307, 0x2, 0x54, 0x323, 0x1, 0x1E6D, 0x2,
+        0x74, 0x323, 0x2, 0x54, 0x331, 0x1, 0x1E6F, 0x2,
+        0x74, 0x331, 0x2, 0x54, 0x32D, 0x1, 0x1E71, 0x2,
+        0x74, 0x32D, 0x2, 0x55, 0x324, 0x1, 0x1E73, 0x2,
+        0x75, 0x324, 0x2, 0x55, 0x330, 0x1, 0x1E75, 0x2,
+        0x75, 0x330, 0x2, 0x55, 0x32D, 0x1, 0x1E77, 0x2,
+        0x75, 0x32D, 0x3, 0x55, 0x303, 0x301, 0x1, 0x1E79,
+        0x3, 0x75, 0x303, 0x301, 0x3, 0x55, 0x304, 0x308,
+        0x1, 0x1E7B, 0x3, 0x75, 0x304, 0x308, 0x2, 0x56,
+        0x303, 0x1, 0x1E7D, 0x2, 0x76, 0x303, 0x2, 0x56,
+        0x323, 0x1, 0x1E7F, 0x2, 0x76, 0x323, 0x2, 0x57,
+        0x300, 0x1, 0x1E81, 0x2, 0x77, 0x300, 0x2, 0x57,
+        0x301, 0x1, 0x1E83, 0x2, 0x77, 0x301, 0x2, 0x57,
+        0x308, 0x1, 0x1E85, 0x2, 0x77, 0x308, 0x2, 0x57,
+        0x307, 0x1, 0x1E87, 0x2, 0x77, 0x307, 0x2, 0x57,
+        0x323, 0x1, 0x1E89, 0x2, 0x77, 0x323, 0x2, 0x58,
+        0x307, 0x1, 0x1E8B, 0x2, 0x78, 0x307, 0x2, 0x58,
+        0x308, 0x1, 0x1E8D, 0x2, 0x78, 0x308, 0x2, 0x59,
+        0x307, 0x1, 0x1E8F, 0x2, 0x79, 0x307, 0x2, 0x5A,
+        0x302, 0x1, 0x1E91, 0x2, 0x7A, 0x302, 0x2, 0x5A,
+        0x323, 0x1, 0x1E93, 0x2, 0x7A, 0x323, 0x2, 0x5A,
+        0x331, 0x1, 0x1E95, 0x2, 0x7A, 0x331, 0x2, 0x68,
+        0x331, 0x2, 0x74, 0x308, 0x2, 0x77, 0x30A, 0x2,
+        0x79, 0x30A, 0x2, 0x61, 0x2BE, 0x2, 0x17F, 0x307,
+        0x2, 0x41, 0x323, 0x1, 0x1EA1, 0x2, 0x61, 0x323,
+        0x2, 0x41, 0x309, 0x1, 0x1EA3, 0x2, 0x61, 0x309,
+        0x3, 0x41, 0x302, 0x301, 0x1, 0x1EA5, 0x3, 0x61,
+        0x302, 0x301, 0x3, 0x41, 0x302, 0x300, 0x1, 0x1EA7,
+        0x3, 0x61, 0x302, 0x300, 0x3, 0x41, 0x302, 0x309,
+        0x1, 0x1EA9, 0x3, 0x61, 0x302, 0x309, 0x3, 0x41,
+        0x302, 0x303, 0x1, 0x1EAB, 0x3, 0x61, 0x302, 0x303,
+        0x3, 0x41, 0x323, 0x302, 0x1, 0x1EAD, 0x3, 0x61,
+        0x323, 0x302, 0x3, 0x41, 0x306, 0x301, 0x1, 0x1EAF,
+        0x3, 0x61, 0x306, 0x301, 0x3, 0x41, 0x306, 0x300,
+        0x1, 0x1EB1, 0x3, 0x61, 0x306, 0x300, 0x3, 0x41,
+        0x306, 0x309, 0x1, 0x1EB3, 0x3, 0x61, 0x306, 0x309,
+        0x3, 0x41, 0x306, 0x303, 0x1, 0x1EB5, 0x3, 0x61,
+        0x306, 0x303, 0x3, 0x41, 0x323, 0x306, 0x1, 0x1EB7,
+        0x3, 0x61, 0x323, 0x306, 0x2, 0x45, 0x323, 0x1,
+        0x1EB9, 0x2, 0x65, 0x323, 0x2, 0x45, 0x309, 0x1,
+        0x1EBB, 0x2, 0x65, 0x309, 0x2, 0x45, 0x303, 0x1,
+        0x1EBD, 0x2, 0x65, 0x303, 0x3, 0x45, 0x302, 0x301,
+        0x1, 0x1EBF, 0x3, 0x65, 0x302, 0x301, 0x3, 0x45,
+        0x302, 0x300, 0x1, 0x1EC1, 0x3, 0x65, 0x302, 0x300,
+        0x3, 0x45, 0x302, 0x309, 0x1, 0x1EC3, 0x3, 0x65,
+        0x302, 0x309, 0x3, 0x45, 0x302, 0x303, 0x1, 0x1EC5,
+        0x3, 0x65, 0x302, 0x303, 0x3, 0x45, 0x323, 0x302,
+        0x1, 0x1EC7, 0x3, 0x65, 0x323, 0x302, 0x2, 0x49,
+        0x309, 0x1, 0x1EC9, 0x2, 0x69, 0x309, 0x2, 0x49,
+        0x323, 0x1, 0x1ECB, 0x2, 0x69, 0x323, 0x2, 0x4F,
+        0x323, 0x1, 0x1ECD, 0x2, 0x6F, 0x323, 0x2, 0x4F,
+        0x309, 0x1, 0x1ECF, 0x2, 0x6F, 0x309, 0x3, 0x4F,
+        0x302, 0x301, 0x1, 0x1ED1, 0x3, 0x6F, 0x302, 0x301,
+        0x3, 0x4F, 0x302, 0x300, 0x1, 0x1ED3, 0x3, 0x6F,
+        0x302, 0x300, 0x3, 0x4F, 0x302, 0x309, 0x1, 0x1ED5,
+        0x3, 0x6F, 0x302, 0x309, 0x3, 0x4F, 0x302, 0x303,
+        0x1, 0x1ED7, 0x3, 0x6F, 0x302, 0x303, 0x3, 0x4F,
+        0x323, 0x302, 0x1, 0x1ED9, 0x3, 0x6F, 0x323, 0x302,
+        0x3, 0x4F, 0x31B, 0x301, 0x1, 0x1EDB, 0x3, 0x6F,
+        0x31B, 0x301, 0x3, 0x4F, 0x31B, 0x300, 0x1, 0x1EDD,
+        0x3, 0x6F, 0x31B, 0x300, 0x3, 0x4F, 0x31B, 0x309,
+        0x1, 0x1EDF, 0x3, 0x6F, 0x31B, 0x309, 0x3, 0x4F,
+        0x31B, 0x303, 0x1, 0x1EE1, 0x3, 0x6F, 0x31B, 0x303,
+        0x3, 0x4F, 0x31B, 0x323, 0x1, 0x1EE3, 0x3, 0x6F,
+        0x31B, 0x323, 0x2, 0x55, 0x323, 0x1, 0x1EE5, 0x2,
+        0x75, 0x323, 0x2, 0x55, 0x309, 0x1, 0x1EE7, 0x2,
+        0x75, 0x309, 0x3, 0x55, 0x31B, 0x301, 0x1, 0x1EE9,
+        0x3, 0x75, 0x31B, 0x301, 0x3, 0x55, 0x31B, 0x300,
+        0x1, 0x1EEB, 0x3, 0x75, 0x31B, 0x300, 0x3, 0x55,
+        0x31B, 0x309, 0x1, 0x1EED, 0x3, 0x75, 0x31B, 0x309,
+        0x3, 0x55, 0x31B, 0x303, 0x1, 0x1EEF, 0x3, 0x75,
+        0x31B, 0x303, 0x3, 0x55, 0x31B, 0x323, 0x1, 0x1EF1,
+        0x3, 0x75, 0x31B, 0x323, 0x2, 0x59, 0x300, 0x1,
+        0x1EF3, 0x2, 0x79, 0x300, 0x2, 0x59, 0x323, 0x1,
+        0x1EF5, 0x2, 0x79, 0x323, 0x2, 0x59, 0x309, 0x1,
+        0x1EF7, 0x2, 0x79, 0x309, 0x2, 0x59, 0x303, 0x1,
+        0x1EF9, 0x2, 0x79, 0x303, 0x1, 0x1EFB, 0x1, 0x1EFD,
+        0x1, 0x1EFF, 0x2, 0x3B1, 0x313, 0x2, 0x3B1, 0x314,
+        0x3, 0x3B1, 0x313, 0x300, 0x3, 0x3B1, 0x314, 0x300,
+        0x3, 0x3B1, 0x313, 0x301, 0x3, 0x3B1, 0x314, 0x301,
+        0x3, 0x3B1, 0x313, 0x342, 0x3, 0x3B1, 0x314, 0x342,
+        0x2, 0x391, 0x313, 0x1, 0x1F00, 0x2, 0x391, 0x314,
+        0x1, 0x1F01, 0x3, 0x391, 0x313, 0x300, 0x1, 0x1F02,
+        0x3, 0x391, 0x314, 0x300, 0x1, 0x1F03, 0x3, 0x391,
+        0x313, 0x301, 0x1, 0x1F04, 0x3, 0x391, 0x314, 0x301,
+        0x1, 0x1F05, 0x3, 0x391, 0x313, 0x342, 0x1, 0x1F06,
+        0x3, 0x391, 0x314, 0x342, 0x1, 0x1F07, 0x2, 0x3B5,
+        0x313, 0x2, 0x3B5, 0x314, 0x3, 0x3B5, 0x313, 0x300,
+        0x3, 0x3B5, 0x314, 0x300, 0x3, 0x3B5, 0x313, 0x301,
+        0x3, 0x3B5, 0x314, 0x301, 0x2, 0x395, 0x313, 0x1,
+        0x1F10, 0x2, 0x395, 0x314, 0x1, 0x1F11, 0x3, 0x395,
+        0x313, 0x300, 0x1, 0x1F12, 0x3, 0x395, 0x314, 0x300,
+        0x1, 0x1F13, 0x3, 0x395, 0x313, 0x301, 0x1, 0x1F14,
+        0x3, 0x395, 0x314, 0x301, 0x1, 0x1F15, 0x2, 0x3B7,
+        0x313, 0x2, 0x3B7, 0x314, 0x3, 0x3B7, 0x313, 0x300,
+        0x3, 0x3B7, 0x314, 0x300, 0x3, 0x3B7, 0x313, 0x301,
+        0x3, 0x3B7, 0x314, 0x301, 0x3, 0x3B7, 0x313, 0x342,
+        0x3, 0x3B7, 0x314, 0x342, 0x2, 0x397, 0x313, 0x1,
+        0x1F20, 0x2, 0x397, 0x314, 0x1, 0x1F21, 0x3, 0x397,
+        0x313, 0x300, 0x1, 0x1F22, 0x3, 0x397, 0x314, 0x300,
+        0x1, 0x1F23, 0x3, 0x397, 0x313, 0x301, 0x1, 0x1F24,
+        0x3, 0x397, 0x314, 0x301, 0x1, 0x1F25, 0x3, 0x397,
+        0x313, 0x342, 0x1, 0x1F26, 0x3, 0x397, 0x314, 0x342,
+        0x1, 0x1F27, 0x2, 0x3B9, 0x313, 0x2, 0x3B9, 0x314,
+        0x3, 0x3B9, 0x313, 0x300, 0x3, 0x3B9, 0x314, 0x300,
+        0x3, 0x3B9, 0x313, 0x301, 0x3, 0x3B9, 0x314, 0x301,
+        0x3, 0x3B9, 0x313, 0x342, 0x3, 0x3B9, 0x314, 0x342,
+        0x2, 0x399, 0x313, 0x1, 0x1F30, 0x2, 0x399, 0x314,
+        0x1, 0x1F31, 0x3, 0x399, 0x313, 0x300, 0x1, 0x1F32,
+        0x3, 0x399, 0x314, 0x300, 0x1, 0x1F33, 0x3, 0x399,
+        0x313, 0x301, 0x1, 0x1F34, 0x3, 0x399, 0x314, 0x301,
+        0x1, 0x1F35, 0x3, 0x399, 0x313, 0x342, 0x1, 0x1F36,
+        0x3, 0x399, 0x314, 0x342, 0x1, 0x1F37, 0x2, 0x3BF,
+        0x313, 0x2, 0x3BF, 0x314, 0x3, 0x3BF, 0x313, 0x300,
+        0x3, 0x3BF, 0x314, 0x300, 0x3, 0x3BF, 0x313, 0x301,
+        0x3, 0x3BF, 0x314, 0x301, 0x2, 0x39F, 0x313, 0x1,
+        0x1F40, 0x2, 0x39F, 0x314, 0x1, 0x1F41, 0x3, 0x39F,
+        0x313, 0x300, 0x1, 0x1F42, 0x3, 0x39F, 0x314, 0x300,
+        0x1, 0x1F43, 0x3, 0x39F, 0x313, 0x301, 0x1, 0x1F44,
+        0x3, 0x39F, 0x314, 0x301, 0x1, 0x1F45, 0x2, 0x3C5,
+        0x313, 0x2, 0x3C5, 0x314, 0x3, 0x3C5, 0x313, 0x300,
+        0x3, 0x3C5, 0x314, 0x300, 0x3, 0x3C5, 0x313, 0x301,
+        0x3, 0x3C5, 0x314, 0x301, 0x3, 0x3C5, 0x313, 0x342,
+        0x3, 0x3C5, 0x314, 0x342, 0x2, 0x3A5, 0x314, 0x1,
+        0x1F51, 0x3, 0x3A5, 0x314, 0x300, 0x1, 0x1F53, 0x3,
+        0x3A5, 0x314, 0x301, 0x1, 0x1F55, 0x3, 0x3A5, 0x314,
+        0x342, 0x1, 0x1F57, 0x2, 0x3C9, 0x313, 0x2, 0x3C9,
+        0x314, 0x3, 0x3C9, 0x313, 0x300, 0x3, 0x3C9, 0x314,
+        0x300, 0x3, 0x3C9, 0x313, 0x301, 0x3, 0x3C9, 0x314,
+        0x301, 0x3, 0x3C9, 0x313, 0x342, 0x3, 0x3C9, 0x314,
+        0x342, 0x2, 0x3A9, 0x313, 0x1, 0x1F60, 0x2, 0x3A9,
+        0x314, 0x1, 0x1F61, 0x3, 0x3A9, 0x313, 0x300, 0x1,
+        0x1F62, 0x3, 0x3A9, 0x314, 0x300, 0x1, 0x1F63, 0x3,
+        0x3A9, 0x313, 0x301, 0x1, 0x1F64, 0x3, 0x3A9, 0x314,
+        0x301, 0x1, 0x1F65, 0x3, 0x3A9, 0x313, 0x342, 0x1,
+        0x1F66, 0x3, 0x3A9, 0x314, 0x342, 0x1, 0x1F67, 0x2,
+        0x3B1, 0x300, 0x2, 0x3B5, 0x300, 0x2, 0x3B7, 0x300,
+        0x2, 0x3B9, 0x300, 0x2, 0x3BF, 0x300, 0x2, 0x3C5,
+        0x300, 0x2, 0x3C9, 0x300, 0x3, 0x3B1, 0x313, 0x345,
+        0x2, 0x1F00, 0x3B9, 0x3, 0x3B1, 0x314, 0x345, 0x2,
+        0x1F01, 0x3B9, 0x4, 0x3B1, 0x313, 0x300, 0x345, 0x2,
+        0x1F02, 0x3B9, 0x4, 0x3B1, 0x314, 0x300, 0x345, 0x2,
+        0x1F03, 0x3B9, 0x4, 0x3B1, 0x313, 0x301, 0x345, 0x2,
+        0x1F04, 0x3B9, 0x4, 0x3B1, 0x314, 0x301, 0x345, 0x2,
+        0x1F05, 0x3B9, 0x4, 0x3B1, 0x313, 0x342, 0x345, 0x2,
+        0x1F06, 0x3B9, 0x4, 0x3B1, 0x314, 0x342, 0x345, 0x2,
+        0x1F07, 0x3B9, 0x3, 0x391, 0x313, 0x345, 0x3, 0x391,
+        0x314, 0x345, 0x4, 0x391, 0x313, 0x300, 0x345, 0x4,
+        0x391, 0x314, 0x300, 0x345, 0x4, 0x391, 0x313, 0x301,
+        0x345, 0x4, 0x391, 0x314, 0x301, 0x345, 0x4, 0x391,
+        0x313, 0x342, 0x345, 0x4, 0x391, 0x314, 0x342, 0x345,
+        0x3, 0x3B7, 0x313, 0x345, 0x2, 0x1F20, 0x3B9, 0x3,
+        0x3B7, 0x314, 0x345, 0x2, 0x1F21, 0x3B9, 0x4, 0x3B7,
+        0x313, 0x300, 0x345, 0x2, 0x1F22, 0x3B9, 0x4, 0x3B7,
+        0x314, 0x300, 0x345, 0x2, 0x1F23, 0x3B9, 0x4, 0x3B7,
+        0x313, 0x301, 0x345, 0x2, 0x1F24, 0x3B9, 0x4, 0x3B7,
+        0x314, 0x301, 0x345, 0x2, 0x1F25, 0x3B9, 0x4, 0x3B7,
+        0x313, 0x342, 0x345, 0x2, 0x1F26, 0x3B9, 0x4, 0x3B7,
+        0x314, 0x342, 0x345, 0x2, 0x1F27, 0x3B9, 0x3, 0x397,
+        0x313, 0x345, 0x3, 0x397, 0x314, 0x345, 0x4, 0x397,
+        0x313, 0x300, 0x345, 0x4, 0x397, 0x314, 0x300, 0x345,
+        0x4, 0x397, 0x313, 0x301, 0x345, 0x4, 0x397, 0x314,
+        0x301, 0x345, 0x4, 0x397, 0x313, 0x342, 0x345, 0x4,
+        0x397, 0x314, 0x342, 0x345, 0x3, 0x3C9, 0x313, 0x345,
+        0x2, 0x1F60, 0x3B9, 0x3, 0x3C9, 0x314, 0x345, 0x2,
+        0x1F61, 0x3B9, 0x4, 0x3C9, 0x313, 0x300, 0x345, 0x2,
+        0x1F62, 0x3B9, 0x4, 0x3C9, 0x314, 0x300, 0x345, 0x2,
+        0x1F63, 0x3B9, 0x4, 0x3C9, 0x313, 0x301, 0x345, 0x2,
+        0x1F64, 0x3B9, 0x4, 0x3C9, 0x314, 0x301, 0x345, 0x2,
+        0x1F65, 0x3B9, 0x4, 0x3C9, 0x313, 0x342, 0x345, 0x2,
+        0x1F66, 0x3B9, 0x4, 0x3C9, 0x314, 0x342, 0x345, 0x2,
+        0x1F67, 0x3B9, 0x3, 0x3A9, 0x313, 0x345, 0x3, 0x3A9,
+        0x314, 0x345, 0x4, 0x3A9, 0x313, 0x300, 0x345, 0x4,
+        0x3A9, 0x314, 0x300, 0x345, 0x4, 0x3A9, 0x313, 0x301,
+        0x345, 0x4, 0x3A9, 0x314, 0x301, 0x345, 0x4, 0x3A9,
+        0x313, 0x342, 0x345, 0x4, 0x3A9, 0x314, 0x342, 0x345,
+        0x2, 0x3B1, 0x306, 0x2, 0x3B1, 0x304, 0x3, 0x3B1,
+        0x300, 0x345, 0x2, 0x1F70, 0x3B9, 0x2, 0x3B1, 0x345,
+        0x2, 0x3B1, 0x3B9, 0x3, 0x3B1, 0x301, 0x345, 0x2,
+        0x3AC, 0x3B9, 0x2, 0x3B1, 0x342, 0x3, 0x3B1, 0x342,
+        0x345, 0x3, 0x3B1, 0x342, 0x3B9, 0x2, 0x391, 0x306,
+        0x1, 0x1FB0, 0x2, 0x391, 0x304, 0x1, 0x1FB1, 0x2,
+        0x391, 0x300, 0x1, 0x1F70, 0x1, 0x1F71, 0x2, 0x391,
+        0x345, 0x2, 0xA8, 0x342, 0x3, 0x3B7, 0x300, 0x345,
+        0x2, 0x1F74, 0x3B9, 0x2, 0x3B7, 0x345, 0x2, 0x3B7,
+        0x3B9, 0x3, 0x3B7, 0x301, 0x345, 0x2, 0x3AE, 0x3B9,
+        0x2, 0x3B7, 0x342, 0x3, 0x3B7, 0x342, 0x345, 0x3,
+        0x3B7, 0x342, 0x3B9, 0x2, 0x395, 0x300, 0x1, 0x1F72,
+        0x1, 0x1F73, 0x2, 0x397, 0x300, 0x1, 0x1F74, 0x1,
+        0x1F75, 0x2, 0x397, 0x345, 0x2, 0x1FBF, 0x300, 0x2,
+        0x1FBF, 0x301, 0x2, 0x1FBF, 0x342, 0x2, 0x3B9, 0x306,
+        0x2, 0x3B9, 0x304, 0x3, 0x3B9, 0x308, 0x300, 0x2,
+        0x3B9, 0x342, 0x3, 0x3B9, 0x308, 0x342, 0x2, 0x399,
+        0x306, 0x1, 0x1FD0, 0x2, 0x399, 0x304, 0x1, 0x1FD1,
+        0x2, 0x399, 0x300, 0x1, 0x1F76, 0x1, 0x1F77, 0x2,
+        0x1FFE, 0x300, 0x2, 0x1FFE, 0x301, 0x2, 0x1FFE, 0x342,
+        0x2, 0x3C5, 0x306, 0x2, 0x3C5, 0x304, 0x3, 0x3C5,
+        0x308, 0x300, 0x2, 0x3C1, 0x313, 0x2, 0x3C1, 0x314,
+        0x2, 0x3C5, 0x342, 0x3, 0x3C5, 0x308, 0x342, 0x2,
+        0x3A5, 0x306, 0x1, 0x1FE0, 0x2, 0x3A5, 0x304, 0x1,
+        0x1FE1, 0x2, 0x3A5, 0x300, 0x1, 0x1F7A, 0x1, 0x1F7B,
+        0x2, 0x3A1, 0x314, 0x1, 0x1FE5, 0x2, 0xA8, 0x300,
+        0x1, 0x60, 0x3, 0x3C9, 0x300, 0x345, 0x2, 0x1F7C,
+        0x3B9, 0x2, 0x3C9, 0x345, 0x2, 0x3C9, 0x3B9, 0x3,
+        0x3C9, 0x301, 0x345, 0x2, 0x3CE, 0x3B9, 0x2, 0x3C9,
+        0x342, 0x3, 0x3C9, 0x342, 0x345, 0x3, 0x3C9, 0x342,
+        0x3B9, 0x2, 0x39F, 0x300, 0x1, 0x1F78, 0x1, 0x1F79,
+        0x2, 0x3A9, 0x300, 0x1, 0x1F7C, 0x1, 0x1F7D, 0x2,
+        0x3A9, 0x345, 0x1, 0xB4, 0x1, 0x2002, 0x1, 0x2003,
+        0x1, 0x3A9, 0x1, 0x4B, 0x1, 0x214E, 0x1, 0x2170,
+        0x1, 0x2171, 0x1, 0x2172, 0x1, 0x2173, 0x1, 0x2174,
+        0x1, 0x2175, 0x1, 0x2176, 0x1, 0x2177, 0x1, 0x2178,
+        0x1, 0x2179, 0x1, 0x217A, 0x1, 0x217B, 0x1, 0x217C,
+        0x1, 0x217D, 0x1, 0x217E, 0x1, 0x217F, 0x1, 0x2184,
+        0x2, 0x2190, 0x338, 0x2, 0x2192, 0x338, 0x2, 0x2194,
+        0x338, 0x2, 0x21D0, 0x338, 0x2, 0x21D4, 0x338, 0x2,
+        0x21D2, 0x338, 0x2, 0x2203, 0x338, 0x2, 0x2208, 0x338,
+        0x2, 0x220B, 0x338, 0x2, 0x2223, 0x338, 0x2, 0x2225,
+        0x338, 0x2, 0x223C, 0x338, 0x2, 0x2243, 0x338, 0x2,
+        0x2245, 0x338, 0x2, 0x2248, 0x338, 0x2, 0x3D, 0x338,
+        0x2, 0x2261, 0x338, 0x2, 0x224D, 0x338, 0x2, 0x3C,
+        0x338, 0x2, 0x3E, 0x338, 0x2, 0x2264, 0x338, 0x2,
+        0x2265, 0x338, 0x2, 0x2272, 0x338, 0x2, 0x2273, 0x338,
+        0x2, 0x2276, 0x338, 0x2, 0x2277, 0x338, 0x2, 0x227A,
+        0x338, 0x2, 0x227B, 0x338, 0x2, 0x2282, 0x338, 0x2,
+        0x2283, 0x338, 0x2, 0x2286, 0x338, 0x2, 0x2287, 0x338,
+        0x2, 0x22A2, 0x338, 0x2, 0x22A8, 0x338, 0x2, 0x22A9,
+        0x338, 0x2, 0x22AB, 0x338, 0x2, 0x227C, 0x338, 0x2,
+        0x227D, 0x338, 0x2, 0x2291, 0x338, 0x2, 0x2292, 0x338,
+        0x2, 0x22B2, 0x338, 0x2, 0x22B3, 0x338, 0x2, 0x22B4,
+        0x338, 0x2, 0x22B5, 0x338, 0x1, 0x3008, 0x1, 0x3009,
+        0x1, 0x24D0, 0x1, 0x24D1, 0x1, 0x24D2, 0x1, 0x24D3,
+        0x1, 0x24D4, 0x1, 0x24D5, 0x1, 0x24D6, 0x1, 0x24D7,
+        0x1, 0x24D8, 0x1, 0x24D9, 0x1, 0x24DA, 0x1, 0x24DB,
+        0x1, 0x24DC, 0x1, 0x24DD, 0x1, 0x24DE, 0x1, 0x24DF,
+        0x1, 0x24E0, 0x1, 0x24E1, 0x1, 0x24E2, 0x1, 0x24E3,
+        0x1, 0x24E4, 0x1, 0x24E5, 0x1, 0x24E6, 0x1, 0x24E7,
+        0x1, 0x24E8, 0x1, 0x24E9, 0x2, 0x2ADD, 0x338, 0x1,
+        0x2C30, 0x1, 0x2C31, 0x1, 0x2C32, 0x1, 0x2C33, 0x1,
+        0x2C34, 0x1, 0x2C35, 0x1, 0x2C36, 0x1, 0x2C37, 0x1,
+        0x2C38, 0x1, 0x2C39, 0x1, 0x2C3A, 0x1, 0x2C3B, 0x1,
+        0x2C3C, 0x1, 0x2C3D, 0x1, 0x2C3E, 0x1, 0x2C3F, 0x1,
+        0x2C40, 0x1, 0x2C41, 0x1, 0x2C42, 0x1, 0x2C43, 0x1,
+        0x2C44, 0x1, 0x2C45, 0x1, 0x2C46, 0x1, 0x2C47, 0x1,
+        0x2C48, 0x1, 0x2C49, 0x1, 0x2C4A, 0x1, 0x2C4B, 0x1,
+        0x2C4C, 0x1, 0x2C4D, 0x1, 0x2C4E, 0x1, 0x2C4F, 0x1,
+        0x2C50, 0x1, 0x2C51, 0x1, 0x2C52, 0x1, 0x2C53, 0x1,
+        0x2C54, 0x1, 0x2C55, 0x1, 0x2C56, 0x1, 0x2C57, 0x1,
+        0x2C58, 0x1, 0x2C59, 0x1, 0x2C5A, 0x1, 0x2C5B, 0x1,
+        0x2C5C, 0x1, 0x2C5D, 0x1, 0x2C5E, 0x1, 0x2C5F, 0x1,
+        0x2C61, 0x1, 0x26B, 0x1, 0x1D7D, 0x1, 0x27D, 0x1,
+        0x2C68, 0x1, 0x2C6A, 0x1, 0x2C6C, 0x1, 0x251, 0x1,
+        0x271, 0x1, 0x250, 0x1, 0x252, 0x1, 0x2C73, 0x1,
+        0x2C76, 0x1, 0x23F, 0x1, 0x240, 0x1, 0x2C81, 0x1,
+        0x2C83, 0x1, 0x2C85, 0x1, 0x2C87, 0x1, 0x2C89, 0x1,
+        0x2C8B, 0x1, 0x2C8D, 0x1, 0x2C8F, 0x1, 0x2C91, 0x1,
+        0x2C93, 0x1, 0x2C95, 0x1, 0x2C97, 0x1, 0x2C99, 0x1,
+        0x2C9B, 0x1, 0x2C9D, 0x1, 0x2C9F, 0x1, 0x2CA1, 0x1,
+        0x2CA3, 0x1, 0x2CA5, 0x1, 0x2CA7, 0x1, 0x2CA9, 0x1,
+        0x2CAB, 0x1, 0x2CAD, 0x1, 0x2CAF, 0x1, 0x2CB1, 0x1,
+        0x2CB3, 0x1, 0x2CB5, 0x1, 0x2CB7, 0x1, 0x2CB9, 0x1,
+        0x2CBB, 0x1, 0x2CBD, 0x1, 0x2CBF, 0x1, 0x2CC1, 0x1,
+        0x2CC3, 0x1, 0x2CC5, 0x1, 0x2CC7, 0x1, 0x2CC9, 0x1,
+        0x2CCB, 0x1, 0x2CCD, 0x1, 0x2CCF, 0x1, 0x2CD1, 0x1,
+        0x2CD3, 0x1, 0x2CD5, 0x1, 0x2CD7, 0x1, 0x2CD9, 0x1,
+        0x2CDB, 0x1, 0x2CDD, 0x1, 0x2CDF, 0x1, 0x2CE1, 0x1,
+        0x2CE3, 0x1, 0x2CEC, 0x1, 0x2CEE, 0x1, 0x2CF3, 0x2,
+        0x304B, 0x3099, 0x2, 0x304D, 0x3099, 0x2, 0x304F, 0x3099,
+        0x2, 0x3051, 0x3099, 0x2, 0x3053, 0x3099, 0x2, 0x3055,
+        0x3099, 0x2, 0x3057, 0x3099, 0x2, 0x3059, 0x3099, 0x2,
+        0x305B, 0x3099, 0x2, 0x305D, 0x3099, 0x2, 0x305F, 0x3099,
+        0x2, 0x3061, 0x3099, 0x2, 0x3064, 0x3099, 0x2, 0x3066,
+        0x3099, 0x2, 0x3068, 0x3099, 0x2, 0x306F, 0x3099, 0x2,
+        0x306F, 0x309A, 0x2, 0x3072, 0x3099, 0x2, 0x3072, 0x309A,
+        0x2, 0x3075, 0x3099, 0x2, 0x3075, 0x309A, 0x2, 0x3078,
+        0x3099, 0x2, 0x3078, 0x309A, 0x2, 0x307B, 0x3099, 0x2,
+        0x307B, 0x309A, 0x2, 0x3046, 0x3099, 0x2, 0x309D, 0x3099,
+        0x2, 0x30AB, 0x3099, 0x2, 0x30AD, 0x3099, 0x2, 0x30AF,
+        0x3099, 0x2, 0x30B1, 0x3099, 0x2, 0x30B3, 0x3099, 0x2,
+        0x30B5, 0x3099, 0x2, 0x30B7, 0x3099, 0x2, 0x30B9, 0x3099,
+        0x2, 0x30BB, 0x3099, 0x2, 0x30BD, 0x3099, 0x2, 0x30BF,
+        0x3099, 0x2, 0x30C1, 0x3099, 0x2, 0x30C4, 0x3099, 0x2,
+        0x30C6, 0x3099, 0x2, 0x30C8, 0x3099, 0x2, 0x30CF, 0x3099,
+        0x2, 0x30CF, 0x309A, 0x2, 0x30D2, 0x3099, 0x2, 0x30D2,
+        0x309A, 0x2, 0x30D5, 0x3099, 0x2, 0x30D5, 0x309A, 0x2,
+        0x30D8, 0x3099, 0x2, 0x30D8, 0x309A, 0x2, 0x30DB, 0x3099,
+        0x2, 0x30DB, 0x309A, 0x2, 0x30A6, 0x3099, 0x2, 0x30EF,
+        0x3099, 0x2, 0x30F0, 0x3099, 0x2, 0x30F1, 0x3099, 0x2,
+        0x30F2, 0x3099, 0x2, 0x30FD, 0x3099, 0x1, 0xA641, 0x1,
+        0xA643, 0x1, 0xA645, 0x1, 0xA647, 0x1, 0xA649, 0x1,
+        0xA64D, 0x1, 0xA64F, 0x1, 0xA651, 0x1, 0xA653, 0x1,
+        0xA655, 0x1, 0xA657, 0x1, 0xA659, 0x1, 0xA65B, 0x1,
+        0xA65D, 0x1, 0xA65F, 0x1, 0xA661, 0x1, 0xA663, 0x1,
+        0xA665, 0x1, 0xA667, 0x1, 0xA669, 0x1, 0xA66B, 0x1,
+        0xA66D, 0x1, 0xA681, 0x1, 0xA683, 0x1, 0xA685, 0x1,
+        0xA687, 0x1, 0xA689, 0x1, 0xA68B, 0x1, 0xA68D, 0x1,
+        0xA68F, 0x1, 0xA691, 0x1, 0xA693, 0x1, 0xA695, 0x1,
+        0xA697, 0x1, 0xA699, 0x1, 0xA69B, 0x1, 0xA723, 0x1,
+        0xA725, 0x1, 0xA727, 0x1, 0xA729, 0x1, 0xA72B, 0x1,
+        0xA72D, 0x1, 0xA72F, 0x1, 0xA733, 0x1, 0xA735, 0x1,
+        0xA737, 0x1, 0xA739, 0x1, 0xA73B, 0x1, 0xA73D, 0x1,
+        0xA73F, 0x1, 0xA741, 0x1, 0xA743, 0x1, 0xA745, 0x1,
+        0xA747, 0x1, 0xA749, 0x1, 0xA74B, 0x1, 0xA74D, 0x1,
+        0xA74F, 0x1, 0xA751, 0x1, 0xA753, 0x1, 0xA755, 0x1,
+        0xA757, 0x1, 0xA759, 0x1, 0xA75B, 0x1, 0xA75D, 0x1,
+        0xA75F, 0x1, 0xA761, 0x1, 0xA763, 0x1, 0xA765, 0x1,
+        0xA767, 0x1, 0xA769, 0x1, 0xA76B, 0x1, 0xA76D, 0x1,
+        0xA76F, 0x1, 0xA77A, 0x1, 0xA77C, 0x1, 0x1D79, 0x1,
+        0xA77F, 0x1, 0xA781, 0x1, 0xA783, 0x1, 0xA785, 0x1,
+        0xA787, 0x1, 0xA78C, 0x1, 0x265, 0x1, 0xA791, 0x1,
+        0xA793, 0x1, 0xA797, 0x1, 0xA799, 0x1, 0xA79B, 0x1,
+        0xA79D, 0x1, 0xA79F, 0x1, 0xA7A1, 0x1, 0xA7A3, 0x1,
+        0xA7A5, 0x1, 0xA7A7, 0x1, 0xA7A9, 0x1, 0x266, 0x1,
+        0x25C, 0x1, 0x261, 0x1, 0x26C, 0x1, 0x26A, 0x1,
+        0x29E, 0x1, 0x287, 0x1, 0x29D, 0x1, 0xAB53, 0x1,
+        0xA7B5, 0x1, 0xA7B7, 0x1, 0xA7B9, 0x1, 0xA7BB, 0x1,
+        0xA7BD, 0x1, 0xA7BF, 0x1, 0xA7C1, 0x1, 0xA7C3, 0x1,
+        0xA794, 0x1, 0x282, 0x1, 0x1D8E, 0x1, 0xA7C8, 0x1,
+        0xA7CA, 0x1, 0xA7D1, 0x1, 0xA7D7, 0x1, 0xA7D9, 0x1,
+        0xA7F6, 0x1, 0x13A0, 0x1, 0x13A1, 0x1, 0x13A2, 0x1,
+        0x13A3, 0x1, 0x13A4, 0x1, 0x13A5, 0x1, 0x13A6, 0x1,
+        0x13A7, 0x1, 0x13A8, 0x1, 0x13A9, 0x1, 0x13AA, 0x1,
+        0x13AB, 0x1, 0x13AC, 0x1, 0x13AD, 0x1, 0x13AE, 0x1,
+        0x13AF, 0x1, 0x13B0, 0x1, 0x13B1, 0x1, 0x13B2, 0x1,
+        0x13B3, 0x1, 0x13B4, 0x1, 0x13B5, 0x1, 0x13B6, 0x1,
+        0x13B7, 0x1, 0x13B8, 0x1, 0x13B9, 0x1, 0x13BA, 0x1,
+        0x13BB, 0x1, 0x13BC, 0x1, 0x13BD, 0x1, 0x13BE, 0x1,
+        0x13BF, 0x1, 0x13C0, 0x1, 0x13C1, 0x1, 0x13C2, 0x1,
+        0x13C3, 0x1, 0x13C4, 0x1, 0x13C5, 0x1, 0x13C6, 0x1,
+        0x13C7, 0x1, 0x13C8, 0x1, 0x13C9, 0x1, 0x13CA, 0x1,
+        0x13CB, 0x1, 0x13CC, 0x1, 0x13CD, 0x1, 0x13CE, 0x1,
+        0x13CF, 0x1, 0x13D0, 0x1, 0x13D1, 0x1, 0x13D2, 0x1,
+        0x13D3, 0x1, 0x13D4, 0x1, 0x13D5, 0x1, 0x13D6, 0x1,
+        0x13D7, 0x1, 0x13D8, 0x1, 0x13D9, 0x1, 0x13DA, 0x1,
+        0x13DB, 0x1, 0x13DC, 0x1, 0x13DD, 0x1, 0x13DE, 0x1,
+        0x13DF, 0x1, 0x13E0, 0x1, 0x13E1, 0x1, 0x13E2, 0x1,
+        0x13E3, 0x1, 0x13E4, 0x1, 0x13E5, 0x1, 0x13E6, 0x1,
+        0x13E7, 0x1, 0x13E8, 0x1, 0x13E9, 0x1, 0x13EA, 0x1,
+        0x13EB, 0x1, 0x13EC, 0x1, 0x13ED, 0x1, 0x13EE, 0x1,
+        0x13EF, 0x1, 0x8C48, 0x1, 0x66F4, 0x1, 0x8ECA, 0x1,
+        0x8CC8, 0x1, 0x6ED1, 0x1, 0x4E32, 0x1, 0x53E5, 0x1,
+        0x9F9C, 0x1, 0x5951, 0x1, 0x91D1, 0x1, 0x5587, 0x1,
+        0x5948, 0x1, 0x61F6, 0x1, 0x7669, 0x1, 0x7F85, 0x1,
+        0x863F, 0x1, 0x87BA, 0x1, 0x88F8, 0x1, 0x908F, 0x1,
+        0x6A02, 0x1, 0x6D1B, 0x1, 0x70D9, 0x1, 0x73DE, 0x1,
+        0x843D, 0x1, 0x916A, 0x1, 0x99F1, 0x1, 0x4E82, 0x1,
+        0x5375, 0x1, 0x6B04, 0x1, 0x721B, 0x1, 0x862D, 0x1,
+        0x9E1E, 0x1, 0x5D50, 0x1, 0x6FEB, 0x1, 0x85CD, 0x1,
+        0x8964, 0x1, 0x62C9, 0x1, 0x81D8, 0x1, 0x881F, 0x1,
+        0x5ECA, 0x1, 0x6717, 0x1, 0x6D6A, 0x1, 0x72FC, 0x1,
+        0x90CE, 0x1, 0x4F86, 0x1, 0x51B7, 0x1, 0x52DE, 0x1,
+        0x64C4, 0x1, 0x6AD3, 0x1, 0x7210, 0x1, 0x76E7, 0x1,
+        0x8001, 0x1, 0x8606, 0x1, 0x865C, 0x1, 0x8DEF, 0x1,
+        0x9732, 0x1, 0x9B6F, 0x1, 0x9DFA, 0x1, 0x788C, 0x1,
+        0x797F, 0x1, 0x7DA0, 0x1, 0x83C9, 0x1, 0x9304, 0x1,
+        0x9E7F, 0x1, 0x8AD6, 0x1, 0x58DF, 0x1, 0x5F04, 0x1,
+        0x7C60, 0x1, 0x807E, 0x1, 0x7262, 0x1, 0x78CA, 0x1,
+        0x8CC2, 0x1, 0x96F7, 0x1, 0x58D8, 0x1, 0x5C62, 0x1,
+        0x6A13, 0x1, 0x6DDA, 0x1, 0x6F0F, 0x1, 0x7D2F, 0x1,
+        0x7E37, 0x1, 0x964B, 0x1, 0x52D2, 0x1, 0x808B, 0x1,
+        0x51DC, 0x1, 0x51CC, 0x1, 0x7A1C, 0x1, 0x7DBE, 0x1,
+        0x83F1, 0x1, 0x9675, 0x1, 0x8B80, 0x1, 0x62CF, 0x1,
+        0x8AFE, 0x1, 0x4E39, 0x1, 0x5BE7, 0x1, 0x6012, 0x1,
+        0x7387, 0x1, 0x7570, 0x1, 0x5317, 0x1, 0x78FB, 0x1,
+        0x4FBF, 0x1, 0x5FA9, 0x1, 0x4E0D, 0x1, 0x6CCC, 0x1,
+        0x6578, 0x1, 0x7D22, 0x1, 0x53C3, 0x1, 0x585E, 0x1,
+        0x7701, 0x1, 0x8449, 0x1, 0x8AAA, 0x1, 0x6BBA, 0x1,
+        0x8FB0, 0x1, 0x6C88, 0x1, 0x62FE, 0x1, 0x82E5, 0x1,
+        0x63A0, 0x1, 0x7565, 0x1, 0x4EAE, 0x1, 0x5169, 0x1,
+        0x51C9, 0x1, 0x6881, 0x1, 0x7CE7, 0x1, 0x826F, 0x1,
+        0x8AD2, 0x1, 0x91CF, 0x1, 0x52F5, 0x1, 0x5442, 0x1,
+        0x5973, 0x1, 0x5EEC, 0x1, 0x65C5, 0x1, 0x6FFE, 0x1,
+        0x792A, 0x1, 0x95AD, 0x1, 0x9A6A, 0x1, 0x9E97, 0x1,
+        0x9ECE, 0x1, 0x529B, 0x1, 0x66C6, 0x1, 0x6B77, 0x1,
+        0x8F62, 0x1, 0x5E74, 0x1, 0x6190, 0x1, 0x6200, 0x1,
+        0x649A, 0x1, 0x6F23, 0x1, 0x7149, 0x1, 0x7489, 0x1,
+        0x79CA, 0x1, 0x7DF4, 0x1, 0x806F, 0x1, 0x8F26, 0x1,
+        0x84EE, 0x1, 0x9023, 0x1, 0x934A, 0x1, 0x5217, 0x1,
+        0x52A3, 0x1, 0x54BD, 0x1, 0x70C8, 0x1, 0x88C2, 0x1,
+        0x5EC9, 0x1, 0x5FF5, 0x1, 0x637B, 0x1, 0x6BAE, 0x1,
+        0x7C3E, 0x1, 0x7375, 0x1, 0x4EE4, 0x1, 0x56F9, 0x1,
+        0x5DBA, 0x1, 0x601C, 0x1, 0x73B2, 0x1, 0x7469, 0x1,
+        0x7F9A, 0x1, 0x8046, 0x1, 0x9234, 0x1, 0x96F6, 0x1,
+        0x9748, 0x1, 0x9818, 0x1, 0x4F8B, 0x1, 0x79AE, 0x1,
+        0x91B4, 0x1, 0x96B8, 0x1, 0x60E1, 0x1, 0x4E86, 0x1,
+        0x50DA, 0x1, 0x5BEE, 0x1, 0x5C3F, 0x1, 0x6599, 0x1,
+        0x71CE, 0x1, 0x7642, 0x1, 0x84FC, 0x1, 0x907C, 0x1,
+        0x9F8D, 0x1, 0x6688, 0x1, 0x962E, 0x1, 0x5289, 0x1,
+        0x677B, 0x1, 0x67F3, 0x1, 0x6D41, 0x1, 0x6E9C, 0x1,
+        0x7409, 0x1, 0x7559, 0x1, 0x786B, 0x1, 0x7D10, 0x1,
+        0x985E, 0x1, 0x516D, 0x1, 0x622E, 0x1, 0x9678, 0x1,
+        0x502B, 0x1, 0x5D19, 0x1, 0x6DEA, 0x1, 0x8F2A, 0x1,
+        0x5F8B, 0x1, 0x6144, 0x1, 0x6817, 0x1, 0x9686, 0x1,
+        0x5229, 0x1, 0x540F, 0x1, 0x5C65, 0x1, 0x6613, 0x1,
+        0x674E, 0x1, 0x68A8, 0x1, 0x6CE5, 0x1, 0x7406, 0x1,
+        0x75E2, 0x1, 0x7F79, 0x1, 0x88CF, 0x1, 0x88E1, 0x1,
+        0x91CC, 0x1, 0x96E2, 0x1, 0x533F, 0x1, 0x6EBA, 0x1,
+        0x541D, 0x1, 0x71D0, 0x1, 0x7498, 0x1, 0x85FA, 0x1,
+        0x96A3, 0x1, 0x9C57, 0x1, 0x9E9F, 0x1, 0x6797, 0x1,
+        0x6DCB, 0x1, 0x81E8, 0x1, 0x7ACB, 0x1, 0x7B20, 0x1,
+        0x7C92, 0x1, 0x72C0, 0x1, 0x7099, 0x1, 0x8B58, 0x1,
+        0x4EC0, 0x1, 0x8336, 0x1, 0x523A, 0x1, 0x5207, 0x1,
+        0x5EA6, 0x1, 0x62D3, 0x1, 0x7CD6, 0x1, 0x5B85, 0x1,
+        0x6D1E, 0x1, 0x66B4, 0x1, 0x8F3B, 0x1, 0x884C, 0x1,
+        0x964D, 0x1, 0x898B, 0x1, 0x5ED3, 0x1, 0x5140, 0x1,
+        0x55C0, 0x1, 0x585A, 0x1, 0x6674, 0x1, 0x51DE, 0x1,
+        0x732A, 0x1, 0x76CA, 0x1, 0x793C, 0x1, 0x795E, 0x1,
+        0x7965, 0x1, 0x798F, 0x1, 0x9756, 0x1, 0x7CBE, 0x1,
+        0x7FBD, 0x1, 0x8612, 0x1, 0x8AF8, 0x1, 0x9038, 0x1,
+        0x90FD, 0x1, 0x98EF, 0x1, 0x98FC, 0x1, 0x9928, 0x1,
+        0x9DB4, 0x1, 0x90DE, 0x1, 0x96B7, 0x1, 0x4FAE, 0x1,
+        0x50E7, 0x1, 0x514D, 0x1, 0x52C9, 0x1, 0x52E4, 0x1,
+        0x5351, 0x1, 0x559D, 0x1, 0x5606, 0x1, 0x5668, 0x1,
+        0x5840, 0x1, 0x58A8, 0x1, 0x5C64, 0x1, 0x5C6E, 0x1,
+        0x6094, 0x1, 0x6168, 0x1, 0x618E, 0x1, 0x61F2, 0x1,
+        0x654F, 0x1, 0x65E2, 0x1, 0x6691, 0x1, 0x6885, 0x1,
+        0x6D77, 0x1, 0x6E1A, 0x1, 0x6F22, 0x1, 0x716E, 0x1,
+        0x722B, 0x1, 0x7422, 0x1, 0x7891, 0x1, 0x793E, 0x1,
+        0x7949, 0x1, 0x7948, 0x1, 0x7950, 0x1, 0x7956, 0x1,
+        0x795D, 0x1, 0x798D, 0x1, 0x798E, 0x1, 0x7A40, 0x1,
+        0x7A81, 0x1, 0x7BC0, 0x1, 0x7E09, 0x1, 0x7E41, 0x1,
+        0x7F72, 0x1, 0x8005, 0x1, 0x81ED, 0x1, 0x8279, 0x1,
+        0x8457, 0x1, 0x8910, 0x1, 0x8996, 0x1, 0x8B01, 0x1,
+        0x8B39, 0x1, 0x8CD3, 0x1, 0x8D08, 0x1, 0x8FB6, 0x1,
+        0x96E3, 0x1, 0x97FF, 0x1, 0x983B, 0x1, 0x6075, 0x1,
+        0x242EE, 0x1, 0x8218, 0x1, 0x4E26, 0x1, 0x51B5, 0x1,
+        0x5168, 0x1, 0x4F80, 0x1, 0x5145, 0x1, 0x5180, 0x1,
+        0x52C7, 0x1, 0x52FA, 0x1, 0x5555, 0x1, 0x5599, 0x1,
+        0x55E2, 0x1, 0x58B3, 0x1, 0x5944, 0x1, 0x5954, 0x1,
+        0x5A62, 0x1, 0x5B28, 0x1, 0x5ED2, 0x1, 0x5ED9, 0x1,
+        0x5F69, 0x1, 0x5FAD, 0x1, 0x60D8, 0x1, 0x614E, 0x1,
+        0x6108, 0x1, 0x6160, 0x1, 0x6234, 0x1, 0x63C4, 0x1,
+        0x641C, 0x1, 0x6452, 0x1, 0x6556, 0x1, 0x671B, 0x1,
+        0x6756, 0x1, 0x6B79, 0x1, 0x6EDB, 0x1, 0x6ECB, 0x1,
+        0x701E, 0x1, 0x77A7, 0x1, 0x7235, 0x1, 0x72AF, 0x1,
+        0x7471, 0x1, 0x7506, 0x1, 0x753B, 0x1, 0x761D, 0x1,
+        0x761F, 0x1, 0x76DB, 0x1, 0x76F4, 0x1, 0x774A, 0x1,
+        0x7740, 0x1, 0x78CC, 0x1, 0x7AB1, 0x1, 0x7C7B, 0x1,
+        0x7D5B, 0x1, 0x7F3E, 0x1, 0x8352, 0x1, 0x83EF, 0x1,
+        0x8779, 0x1, 0x8941, 0x1, 0x8986, 0x1, 0x8ABF, 0x1,
+        0x8ACB, 0x1, 0x8AED, 0x1, 0x8B8A, 0x1, 0x8F38, 0x1,
+        0x9072, 0x1, 0x9199, 0x1, 0x9276, 0x1, 0x967C, 0x1,
+        0x97DB, 0x1, 0x980B, 0x1, 0x9B12, 0x1, 0x2284A, 0x1,
+        0x22844, 0x1, 0x233D5, 0x1, 0x3B9D, 0x1, 0x4018, 0x1,
+        0x4039, 0x1, 0x25249, 0x1, 0x25CD0, 0x1, 0x27ED3, 0x1,
+        0x9F43, 0x1, 0x9F8E, 0x2, 0x66, 0x66, 0x2, 0x66,
+        0x69, 0x2, 0x66, 0x6C, 0x3, 0x66, 0x66, 0x69,
+        0x3, 0x66, 0x66, 0x6C, 0x2, 0x73, 0x74, 0x2,
+        0x574, 0x576, 0x2, 0x574, 0x565, 0x2, 0x574, 0x56B,
+        0x2, 0x57E, 0x576, 0x2, 0x574, 0x56D, 0x2, 0x5D9,
+        0x5B4, 0x2, 0x5F2, 0x5B7, 0x2, 0x5E9, 0x5C1, 0x2,
+        0x5E9, 0x5C2, 0x3, 0x5E9, 0x5BC, 0x5C1, 0x3, 0x5E9,
+        0x5BC, 0x5C2, 0x2, 0x5D0, 0x5B7, 0x2, 0x5D0, 0x5B8,
+        0x2, 0x5D0, 0x5BC, 0x2, 0x5D1, 0x5BC, 0x2, 0x5D2,
+        0x5BC, 0x2, 0x5D3, 0x5BC, 0x2, 0x5D4, 0x5BC, 0x2,
+        0x5D5, 0x5BC, 0x2, 0x5D6, 0x5BC, 0x2, 0x5D8, 0x5BC,
+        0x2, 0x5D9, 0x5BC, 0x2, 0x5DA, 0x5BC, 0x2, 0x5DB,
+        0x5BC, 0x2, 0x5DC, 0x5BC, 0x2, 0x5DE, 0x5BC, 0x2,
+        0x5E0, 0x5BC, 0x2, 0x5E1, 0x5BC, 0x2, 0x5E3, 0x5BC,
+        0x2, 0x5E4, 0x5BC, 0x2, 0x5E6, 0x5BC, 0x2, 0x5E7,
+        0x5BC, 0x2, 0x5E8, 0x5BC, 0x2, 0x5E9, 0x5BC, 0x2,
+        0x5EA, 0x5BC, 0x2, 0x5D5, 0x5B9, 0x2, 0x5D1, 0x5BF,
+        0x2, 0x5DB, 0x5BF, 0x2, 0x5E4, 0x5BF, 0x1, 0xFF41,
+        0x1, 0xFF42, 0x1, 0xFF43, 0x1, 0xFF44, 0x1, 0xFF45,
+        0x1, 0xFF46, 0x1, 0xFF47, 0x1, 0xFF48, 0x1, 0xFF49,
+        0x1, 0xFF4A, 0x1, 0xFF4B, 0x1, 0xFF4C, 0x1, 0xFF4D,
+        0x1, 0xFF4E, 0x1, 0xFF4F, 0x1, 0xFF50, 0x1, 0xFF51,
+        0x1, 0xFF52, 0x1, 0xFF53, 0x1, 0xFF54, 0x1, 0xFF55,
+        0x1, 0xFF56, 0x1, 0xFF57, 0x1, 0xFF58, 0x1, 0xFF59,
+        0x1, 0xFF5A, 0x1, 0x10428, 0x1, 0x10429, 0x1, 0x1042A,
+        0x1, 0x1042B, 0x1, 0x1042C, 0x1, 0x1042D, 0x1, 0x1042E,
+        0x1, 0x1042F, 0x1, 0x10430, 0x1, 0x10431, 0x1, 0x10432,
+        0x1, 0x10433, 0x1, 0x10434, 0x1, 0x10435, 0x1, 0x10436,
+        0x1, 0x10437, 0x1, 0x10438, 0x1, 0x10439, 0x1, 0x1043A,
+        0x1, 0x1043B, 0x1, 0x1043C, 0x1, 0x1043D, 0x1, 0x1043E,
+        0x1, 0x1043F, 0x1, 0x10440, 0x1, 0x10441, 0x1, 0x10442,
+        0x1, 0x10443, 0x1, 0x10444, 0x1, 0x10445, 0x1, 0x10446,
+        0x1, 0x10447, 0x1, 0x10448, 0x1, 0x10449, 0x1, 0x1044A,
+        0x1, 0x1044B, 0x1, 0x1044C, 0x1, 0x1044D, 0x1, 0x1044E,
+        0x1, 0x1044F, 0x1, 0x104D8, 0x1, 0x104D9, 0x1, 0x104DA,
+        0x1, 0x104DB, 0x1, 0x104DC, 0x1, 0x104DD, 0x1, 0x104DE,
+        0x1, 0x104DF, 0x1, 0x104E0, 0x1, 0x104E1, 0x1, 0x104E2,
+        0x1, 0x104E3, 0x1, 0x104E4, 0x1, 0x104E5, 0x1, 0x104E6,
+        0x1, 0x104E7, 0x1, 0x104E8, 0x1, 0x104E9, 0x1, 0x104EA,
+        0x1, 0x104EB, 0x1, 0x104EC, 0x1, 0x104ED, 0x1, 0x104EE,
+        0x1, 0x104EF, 0x1, 0x104F0, 0x1, 0x104F1, 0x1, 0x104F2,
+        0x1, 0x104F3, 0x1, 0x104F4, 0x1, 0x104F5, 0x1, 0x104F6,
+        0x1, 0x104F7, 0x1, 0x104F8, 0x1, 0x104F9, 0x1, 0x104FA,
+        0x1, 0x104FB, 0x1, 0x10597, 0x1, 0x10598, 0x1, 0x10599,
+        0x1, 0x1059A, 0x1, 0x1059B, 0x1, 0x1059C, 0x1, 0x1059D,
+        0x1, 0x1059E, 0x1, 0x1059F, 0x1, 0x105A0, 0x1, 0x105A1,
+        0x1, 0x105A3, 0x1, 0x105A4, 0x1, 0x105A5, 0x1, 0x105A6,
+        0x1, 0x105A7, 0x1, 0x105A8, 0x1, 0x105A9, 0x1, 0x105AA,
+        0x1, 0x105AB, 0x1, 0x105AC, 0x1, 0x105AD, 0x1, 0x105AE,
+        0x1, 0x105AF, 0x1, 0x105B0, 0x1, 0x105B1, 0x1, 0x105B3,
+        0x1, 0x105B4, 0x1, 0x105B5, 0x1, 0x105B6, 0x1, 0x105B7,
+        0x1, 0x105B8, 0x1, 0x105B9, 0x1, 0x105BB, 0x1, 0x105BC,
+        0x1, 0x10CC0, 0x1, 0x10CC1, 0x1, 0x10CC2, 0x1, 0x10CC3,
+        0x1, 0x10CC4, 0x1, 0x10CC5, 0x1, 0x10CC6, 0x1, 0x10CC7,
+        0x1, 0x10CC8, 0x1, 0x10CC9, 0x1, 0x10CCA, 0x1, 0x10CCB,
+        0x1, 0x10CCC, 0x1, 0x10CCD, 0x1, 0x10CCE, 0x1, 0x10CCF,
+        0x1, 0x10CD0, 0x1, 0x10CD1, 0x1, 0x10CD2, 0x1, 0x10CD3,
+        0x1, 0x10CD4, 0x1, 0x10CD5, 0x1, 0x10CD6, 0x1, 0x10CD7,
+        0x1, 0x10CD8, 0x1, 0x10CD9, 0x1, 0x10CDA, 0x1, 0x10CDB,
+        0x1, 0x10CDC, 0x1, 0x10CDD, 0x1, 0x10CDE, 0x1, 0x10CDF,
+        0x1, 0x10CE0, 0x1, 0x10CE1, 0x1, 0x10CE2, 0x1, 0x10CE3,
+        0x1, 0x10CE4, 0x1, 0x10CE5, 0x1, 0x10CE6, 0x1, 0x10CE7,
+        0x1, 0x10CE8, 0x1, 0x10CE9, 0x1, 0x10CEA, 0x1, 0x10CEB,
+        0x1, 0x10CEC, 0x1, 0x10CED, 0x1, 0x10CEE, 0x1, 0x10CEF,
+        0x1, 0x10CF0, 0x1, 0x10CF1, 0x1, 0x10CF2, 0x2, 0x11099,
+        0x110BA, 0x2, 0x1109B, 0x110BA, 0x2, 0x110A5, 0x110BA, 0x2,
+        0x11131, 0x11127, 0x2, 0x11132, 0x11127, 0x2, 0x11347, 0x1133E,
+        0x2, 0x11347, 0x11357, 0x2, 0x114B9, 0x114BA, 0x2, 0x114B9,
+        0x114B0, 0x2, 0x114B9, 0x114BD, 0x2, 0x115B8, 0x115AF, 0x2,
+        0x115B9, 0x115AF, 0x1, 0x118C0, 0x1, 0x118C1, 0x1, 0x118C2,
+        0x1, 0x118C3, 0x1, 0x118C4, 0x1, 0x118C5, 0x1, 0x118C6,
+        0x1, 0x118C7, 0x1, 0x118C8, 0x1, 0x118C9, 0x1, 0x118CA,
+        0x1, 0x118CB, 0x1, 0x118CC, 0x1, 0x118CD, 0x1, 0x118CE,
+        0x1, 0x118CF, 0x1, 0x118D0, 0x1, 0x118D1, 0x1, 0x118D2,
+        0x1, 0x118D3, 0x1, 0x118D4, 0x1, 0x118D5, 0x1, 0x118D6,
+        0x1, 0x118D7, 0x1, 0x118D8, 0x1, 0x118D9, 0x1, 0x118DA,
+        0x1, 0x118DB, 0x1, 0x118DC, 0x1, 0x118DD, 0x1, 0x118DE,
+        0x1, 0x118DF, 0x2, 0x11935, 0x11930, 0x1, 0x16E60, 0x1,
+        0x16E61, 0x1, 0x16E62, 0x1, 0x16E63, 0x1, 0x16E64, 0x1,
+        0x16E65, 0x1, 0x16E66, 0x1, 0x16E67, 0x1, 0x16E68, 0x1,
+        0x16E69, 0x1, 0x16E6A, 0x1, 0x16E6B, 0x1, 0x16E6C, 0x1,
+        0x16E6D, 0x1, 0x16E6E, 0x1, 0x16E6F, 0x1, 0x16E70, 0x1,
+        0x16E71, 0x1, 0x16E72, 0x1, 0x16E73, 0x1, 0x16E74, 0x1,
+        0x16E75, 0x1, 0x16E76, 0x1, 0x16E77, 0x1, 0x16E78, 0x1,
+        0x16E79, 0x1, 0x16E7A, 0x1, 0x16E7B, 0x1, 0x16E7C, 0x1,
+        0x16E7D, 0x1, 0x16E7E, 0x1, 0x16E7F, 0x2, 0x1D157, 0x1D165,
+        0x2, 0x1D158, 0x1D165, 0x3, 0x1D158, 0x1D165, 0x1D16E, 0x3,
+        0x1D158, 0x1D165, 0x1D16F, 0x3, 0x1D158, 0x1D165, 0x1D170, 0x3,
+        0x1D158, 0x1D165, 0x1D171, 0x3, 0x1D158, 0x1D165, 0x1D172, 0x2,
+        0x1D1B9, 0x1D165, 0x2, 0x1D1BA, 0x1D165, 0x3, 0x1D1B9, 0x1D165,
+        0x1D16E, 0x3, 0x1D1BA, 0x1D165, 0x1D16E, 0x3, 0x1D1B9, 0x1D165,
+        0x1D16F, 0x3, 0x1D1BA, 0x1D165, 0x1D16F, 0x1, 0x1E922, 0x1,
+        0x1E923, 0x1, 0x1E924, 0x1, 0x1E925, 0x1, 0x1E926, 0x1,
+        0x1E927, 0x1, 0x1E928, 0x1, 0x1E929, 0x1, 0x1E92A, 0x1,
+        0x1E92B, 0x1, 0x1E92C, 0x1, 0x1E92D, 0x1, 0x1E92E, 0x1,
+        0x1E92F, 0x1, 0x1E930, 0x1, 0x1E931, 0x1, 0x1E932, 0x1,
+        0x1E933, 0x1, 0x1E934, 0x1, 0x1E935, 0x1, 0x1E936, 0x1,
+        0x1E937, 0x1, 0x1E938, 0x1, 0x1E939, 0x1, 0x1E93A, 0x1,
+        0x1E93B, 0x1, 0x1E93C, 0x1, 0x1E93D, 0x1, 0x1E93E, 0x1,
+        0x1E93F, 0x1, 0x1E940, 0x1, 0x1E941, 0x1, 0x1E942, 0x1,
+        0x1E943, 0x1, 0x4E3D, 0x1, 0x4E38, 0x1, 0x4E41, 0x1,
+        0x20122, 0x1, 0x4F60, 0x1, 0x4FBB, 0x1, 0x5002, 0x1,
+        0x507A, 0x1, 0x5099, 0x1, 0x50CF, 0x1, 0x349E, 0x1,
+        0x2063A, 0x1, 0x5154, 0x1, 0x5164, 0x1, 0x5177, 0x1,
+        0x2051C, 0x1, 0x34B9, 0x1, 0x5167, 0x1, 0x518D, 0x1,
+        0x2054B, 0x1, 0x5197, 0x1, 0x51A4, 0x1, 0x4ECC, 0x1,
+        0x51AC, 0x1, 0x291DF, 0x1, 0x51F5, 0x1, 0x5203, 0x1,
+        0x34DF, 0x1, 0x523B, 0x1, 0x5246, 0x1, 0x5272, 0x1,
+        0x5277, 0x1, 0x3515, 0x1, 0x5305, 0x1, 0x5306, 0x1,
+        0x5349, 0x1, 0x535A, 0x1, 0x5373, 0x1, 0x537D, 0x1,
+        0x537F, 0x1, 0x20A2C, 0x1, 0x7070, 0x1, 0x53CA, 0x1,
+        0x53DF, 0x1, 0x20B63, 0x1, 0x53EB, 0x1, 0x53F1, 0x1,
+        0x5406, 0x1, 0x549E, 0x1, 0x5438, 0x1, 0x5448, 0x1,
+        0x5468, 0x1, 0x54A2, 0x1, 0x54F6, 0x1, 0x5510, 0x1,
+        0x5553, 0x1, 0x5563, 0x1, 0x5584, 0x1, 0x55AB, 0x1,
+        0x55B3, 0x1, 0x55C2, 0x1, 0x5716, 0x1, 0x5717, 0x1,
+        0x5651, 0x1, 0x5674, 0x1, 0x58EE, 0x1, 0x57CE, 0x1,
+        0x57F4, 0x1, 0x580D, 0x1, 0x578B, 0x1, 0x5832, 0x1,
+        0x5831, 0x1, 0x58AC, 0x1, 0x214E4, 0x1, 0x58F2, 0x1,
+        0x58F7, 0x1, 0x5906, 0x1, 0x591A, 0x1, 0x5922, 0x1,
+        0x5962, 0x1, 0x216A8, 0x1, 0x216EA, 0x1, 0x59EC, 0x1,
+        0x5A1B, 0x1, 0x5A27, 0x1, 0x59D8, 0x1, 0x5A66, 0x1,
+        0x36EE, 0x1, 0x36FC, 0x1, 0x5B08, 0x1, 0x5B3E, 0x1,
+        0x219C8, 0x1, 0x5BC3, 0x1, 0x5BD8, 0x1, 0x5BF3, 0x1,
+        0x21B18, 0x1, 0x5BFF, 0x1, 0x5C06, 0x1, 0x5F53, 0x1,
+        0x5C22, 0x1, 0x3781, 0x1, 0x5C60, 0x1, 0x5CC0, 0x1,
+        0x5C8D, 0x1, 0x21DE4, 0x1, 0x5D43, 0x1, 0x21DE6, 0x1,
+        0x5D6E, 0x1, 0x5D6B, 0x1, 0x5D7C, 0x1, 0x5DE1, 0x1,
+        0x5DE2, 0x1, 0x382F, 0x1, 0x5DFD, 0x1, 0x5E28, 0x1,
+        0x5E3D, 0x1, 0x5E69, 0x1, 0x3862, 0x1, 0x22183, 0x1,
+        0x387C, 0x1, 0x5EB0, 0x1, 0x5EB3, 0x1, 0x5EB6, 0x1,
+        0x2A392, 0x1, 0x5EFE, 0x1, 0x22331, 0x1, 0x8201, 0x1,
+        0x5F22, 0x1, 0x38C7, 0x1, 0x232B8, 0x1, 0x261DA, 0x1,
+        0x5F62, 0x1, 0x5F6B, 0x1, 0x38E3, 0x1, 0x5F9A, 0x1,
+        0x5FCD, 0x1, 0x5FD7, 0x1, 0x5FF9, 0x1, 0x6081, 0x1,
+        0x393A, 0x1, 0x391C, 0x1, 0x226D4, 0x1, 0x60C7, 0x1,
+        0x6148, 0x1, 0x614C, 0x1, 0x617A, 0x1, 0x61B2, 0x1,
+        0x61A4, 0x1, 0x61AF, 0x1, 0x61DE, 0x1, 0x6210, 0x1,
+        0x621B, 0x1, 0x625D, 0x1, 0x62B1, 0x1, 0x62D4, 0x1,
+        0x6350, 0x1, 0x22B0C, 0x1, 0x633D, 0x1, 0x62FC, 0x1,
+        0x6368, 0x1, 0x6383, 0x1, 0x63E4, 0x1, 0x22BF1, 0x1,
+        0x6422, 0x1, 0x63C5, 0x1, 0x63A9, 0x1, 0x3A2E, 0x1,
+        0x6469, 0x1, 0x647E, 0x1, 0x649D, 0x1, 0x6477, 0x1,
+        0x3A6C, 0x1, 0x656C, 0x1, 0x2300A, 0x1, 0x65E3, 0x1,
+        0x66F8, 0x1, 0x6649, 0x1, 0x3B19, 0x1, 0x3B08, 0x1,
+        0x3AE4, 0x1, 0x5192, 0x1, 0x5195, 0x1, 0x6700, 0x1,
+        0x669C, 0x1, 0x80AD, 0x1, 0x43D9, 0x1, 0x6721, 0x1,
+        0x675E, 0x1, 0x6753, 0x1, 0x233C3, 0x1, 0x3B49, 0x1,
+        0x67FA, 0x1, 0x6785, 0x1, 0x6852, 0x1, 0x2346D, 0x1,
+        0x688E, 0x1, 0x681F, 0x1, 0x6914, 0x1, 0x6942, 0x1,
+        0x69A3, 0x1, 0x69EA, 0x1, 0x6AA8, 0x1, 0x236A3, 0x1,
+        0x6ADB, 0x1, 0x3C18, 0x1, 0x6B21, 0x1, 0x238A7, 0x1,
+        0x6B54, 0x1, 0x3C4E, 0x1, 0x6B72, 0x1, 0x6B9F, 0x1,
+        0x6BBB, 0x1, 0x23A8D, 0x1, 0x21D0B, 0x1, 0x23AFA, 0x1,
+        0x6C4E, 0x1, 0x23CBC, 0x1, 0x6CBF, 0x1, 0x6CCD, 0x1,
+        0x6C67, 0x1, 0x6D16, 0x1, 0x6D3E, 0x1, 0x6D69, 0x1,
+        0x6D78, 0x1, 0x6D85, 0x1, 0x23D1E, 0x1, 0x6D34, 0x1,
+        0x6E2F, 0x1, 0x6E6E, 0x1, 0x3D33, 0x1, 0x6EC7, 0x1,
+        0x23ED1, 0x1, 0x6DF9, 0x1, 0x6F6E, 0x1, 0x23F5E, 0x1,
+        0x23F8E, 0x1, 0x6FC6, 0x1, 0x7039, 0x1, 0x701B, 0x1,
+        0x3D96, 0x1, 0x704A, 0x1, 0x707D, 0x1, 0x7077, 0x1,
+        0x70AD, 0x1, 0x20525, 0x1, 0x7145, 0x1, 0x24263, 0x1,
+        0x719C, 0x1, 0x243AB, 0x1, 0x7228, 0x1, 0x7250, 0x1,
+        0x24608, 0x1, 0x7280, 0x1, 0x7295, 0x1, 0x24735, 0x1,
+        0x24814, 0x1, 0x737A, 0x1, 0x738B, 0x1, 0x3EAC, 0x1,
+        0x73A5, 0x1, 0x3EB8, 0x1, 0x7447, 0x1, 0x745C, 0x1,
+        0x7485, 0x1, 0x74CA, 0x1, 0x3F1B, 0x1, 0x7524, 0x1,
+        0x24C36, 0x1, 0x753E, 0x1, 0x24C92, 0x1, 0x2219F, 0x1,
+        0x7610, 0x1, 0x24FA1, 0x1, 0x24FB8, 0x1, 0x25044, 0x1,
+        0x3FFC, 0x1, 0x4008, 0x1, 0x250F3, 0x1, 0x250F2, 0x1,
+        0x25119, 0x1, 0x25133, 0x1, 0x771E, 0x1, 0x771F, 0x1,
+        0x778B, 0x1, 0x4046, 0x1, 0x4096, 0x1, 0x2541D, 0x1,
+        0x784E, 0x1, 0x40E3, 0x1, 0x25626, 0x1, 0x2569A, 0x1,
+        0x256C5, 0x1, 0x79EB, 0x1, 0x412F, 0x1, 0x7A4A, 0x1,
+        0x7A4F, 0x1, 0x2597C, 0x1, 0x25AA7, 0x1, 0x7AEE, 0x1,
+        0x4202, 0x1, 0x25BAB, 0x1, 0x7BC6, 0x1, 0x7BC9, 0x1,
+        0x4227, 0x1, 0x25C80, 0x1, 0x7CD2, 0x1, 0x42A0, 0x1,
+        0x7CE8, 0x1, 0x7CE3, 0x1, 0x7D00, 0x1, 0x25F86, 0x1,
+        0x7D63, 0x1, 0x4301, 0x1, 0x7DC7, 0x1, 0x7E02, 0x1,
+        0x7E45, 0x1, 0x4334, 0x1, 0x26228, 0x1, 0x26247, 0x1,
+        0x4359, 0x1, 0x262D9, 0x1, 0x7F7A, 0x1, 0x2633E, 0x1,
+        0x7F95, 0x1, 0x7FFA, 0x1, 0x264DA, 0x1, 0x26523, 0x1,
+        0x8060, 0x1, 0x265A8, 0x1, 0x8070, 0x1, 0x2335F, 0x1,
+        0x43D5, 0x1, 0x80B2, 0x1, 0x8103, 0x1, 0x440B, 0x1,
+        0x813E, 0x1, 0x5AB5, 0x1, 0x267A7, 0x1, 0x267B5, 0x1,
+        0x23393, 0x1, 0x2339C, 0x1, 0x8204, 0x1, 0x8F9E, 0x1,
+        0x446B, 0x1, 0x8291, 0x1, 0x828B, 0x1, 0x829D, 0x1,
+        0x52B3, 0x1, 0x82B1, 0x1, 0x82B3, 0x1, 0x82BD, 0x1,
+        0x82E6, 0x1, 0x26B3C, 0x1, 0x831D, 0x1, 0x8363, 0x1,
+        0x83AD, 0x1, 0x8323, 0x1, 0x83BD, 0x1, 0x83E7, 0x1,
+        0x8353, 0x1, 0x83CA, 0x1, 0x83CC, 0x1, 0x83DC, 0x1,
+        0x26C36, 0x1, 0x26D6B, 0x1, 0x26CD5, 0x1, 0x452B, 0x1,
+        0x84F1, 0x1, 0x84F3, 0x1, 0x8516, 0x1, 0x273CA, 0x1,
+        0x8564, 0x1, 0x26F2C, 0x1, 0x455D, 0x1, 0x4561, 0x1,
+        0x26FB1, 0x1, 0x270D2, 0x1, 0x456B, 0x1, 0x8650, 0x1,
+        0x8667, 0x1, 0x8669, 0x1, 0x86A9, 0x1, 0x8688, 0x1,
+        0x870E, 0x1, 0x86E2, 0x1, 0x8728, 0x1, 0x876B, 0x1,
+        0x8786, 0x1, 0x45D7, 0x1, 0x87E1, 0x1, 0x8801, 0x1,
+        0x45F9, 0x1, 0x8860, 0x1, 0x8863, 0x1, 0x27667, 0x1,
+        0x88D7, 0x1, 0x88DE, 0x1, 0x4635, 0x1, 0x88FA, 0x1,
+        0x34BB, 0x1, 0x278AE, 0x1, 0x27966, 0x1, 0x46BE, 0x1,
+        0x46C7, 0x1, 0x8AA0, 0x1, 0x8C55, 0x1, 0x27CA8, 0x1,
+        0x8CAB, 0x1, 0x8CC1, 0x1, 0x8D1B, 0x1, 0x8D77, 0x1,
+        0x27F2F, 0x1, 0x20804, 0x1, 0x8DCB, 0x1, 0x8DBC, 0x1,
+        0x8DF0, 0x1, 0x208DE, 0x1, 0x8ED4, 0x1, 0x285D2, 0x1,
+        0x285ED, 0x1, 0x9094, 0x1, 0x90F1, 0x1, 0x9111, 0x1,
+        0x2872E, 0x1, 0x911B, 0x1, 0x9238, 0x1, 0x92D7, 0x1,
+        0x92D8, 0x1, 0x927C, 0x1, 0x93F9, 0x1, 0x9415, 0x1,
+        0x28BFA, 0x1, 0x958B, 0x1, 0x4995, 0x1, 0x95B7, 0x1,
+        0x28D77, 0x1, 0x49E6, 0x1, 0x96C3, 0x1, 0x5DB2, 0x1,
+        0x9723, 0x1, 0x29145, 0x1, 0x2921A, 0x1, 0x4A6E, 0x1,
+        0x4A76, 0x1, 0x97E0, 0x1, 0x2940A, 0x1, 0x4AB2, 0x1,
+        0x29496, 0x1, 0x9829, 0x1, 0x295B6, 0x1, 0x98E2, 0x1,
+        0x4B33, 0x1, 0x9929, 0x1, 0x99A7, 0x1, 0x99C2, 0x1,
+        0x99FE, 0x1, 0x4BCE, 0x1, 0x29B30, 0x1, 0x9C40, 0x1,
+        0x9CFD, 0x1, 0x4CCE, 0x1, 0x4CED, 0x1, 0x9D67, 0x1,
+        0x2A0CE, 0x1, 0x4CF8, 0x1, 0x2A105, 0x1, 0x2A20E, 0x1,
+        0x2A291, 0x1, 0x9EBB, 0x1, 0x4D56, 0x1, 0x9EF9, 0x1,
+        0x9EFE, 0x1, 0x9F05, 0x1, 0x9F0F, 0x1, 0x9F16, 0x1,
+        0x9F3B, 0x1, 0x2A600,
+    };
+
+    static const uint64_t cstr_unicode_compose_keys[941] =
+    {
+        0x7800338ULL, 0x7A00338ULL, 0x7C00338ULL, 0x8200300ULL,
+        0x8200301ULL, 0x8200302ULL, 0x8200303ULL, 0x8200304ULL,
+        0x8200306ULL, 0x8200307ULL, 0x8200308ULL, 0x8200309ULL,
+        0x820030AULL, 0x820030CULL, 0x820030FULL, 0x8200311ULL,
+        0x8200323ULL, 0x8200325ULL, 0x8200328ULL, 0x8400307ULL,
+        0x8400323ULL, 0x8400331ULL, 0x8600301ULL, 0x8600302ULL,
+        0x8600307ULL, 0x860030CULL, 0x8600327ULL, 0x8800307ULL,
+        0x880030CULL, 0x8800323ULL, 0x8800327ULL, 0x880032DULL,
+        0x8800331ULL, 0x8A00300ULL, 0x8A00301ULL, 0x8A00302ULL,
+        0x8A00303ULL, 0x8A00304ULL, 0x8A00306ULL, 0x8A00307ULL,
+        0x8A00308ULL, 0x8A00309ULL, 0x8A0030CULL, 0x8A0030FULL,
+        0x8A00311ULL, 0x8A00323ULL, 0x8A00327ULL, 0x8A00328ULL,
+        0x8A0032DULL, 0x8A00330ULL, 0x8C00307ULL, 0x8E00301ULL,
+        0x8E00302ULL, 0x8E00304ULL, 0x8E00306ULL, 0x8E00307ULL,
+        0x8E0030CULL, 0x8E00327ULL, 0x9000302ULL, 0x9000307ULL,
+        0x9000308ULL, 0x900030CULL, 0x9000323ULL, 0x9000327ULL,
+        0x900032EULL, 0x9200300ULL, 0x9200301ULL, 0x9200302ULL,
+        0x9200303ULL, 0x9200304ULL, 0x9200306ULL, 0x9200307ULL,
+        0x9200308ULL, 0x9200309ULL, 0x920030CULL, 0x920030FULL,
+        0x9200311ULL, 0x9200323ULL, 0x9200328ULL, 0x9200330ULL,
+        0x9400302ULL, 0x9600301ULL, 0x960030CULL, 0x9600323ULL,
+        0x9600327ULL, 0x9600331ULL, 0x9800301ULL, 0x980030CULL,
+        0x9800323ULL, 0x9800327ULL, 0x980032DULL, 0x9800331ULL,
+        0x9A00301ULL, 0x9A00307ULL, 0x9A00323ULL, 0x9C00300ULL,
+        0x9C00301ULL, 0x9C00303ULL, 0x9C00307ULL, 0x9C0030CULL,
+        0x9C00323ULL, 0x9C00327ULL, 0x9C0032DULL, 0x9C00331ULL,
+        0x9E00300ULL, 0x9E00301ULL, 0x9E00302ULL, 0x9E00303ULL,
+        0x9E00304ULL, 0x9E00306ULL, 0x9E00307ULL, 0x9E00308ULL,
+        0x9E00309ULL, 0x9E0030BULL, 0x9E0030CULL, 0x9E0030FULL,
+        0x9E00311ULL, 0x9E0031BULL, 0x9E00323ULL, 0x9E00328ULL,
+        0xA000301ULL, 0xA000307ULL, 0xA400301ULL, 0xA400307ULL,
+        0xA40030CULL, 0xA40030FULL, 0xA400311ULL, 0xA400323ULL,
+        0xA400327ULL, 0xA400331ULL, 0xA600301ULL, 0xA600302ULL,
+        0xA600307ULL, 0xA60030CULL, 0xA600323ULL, 0xA600326ULL,
+        0xA600327ULL, 0xA800307ULL, 0xA80030CULL, 0xA800323ULL,
+        0xA800326ULL, 0xA800327ULL, 0xA80032DULL, 0xA800331ULL,
+        0xAA00300ULL, 0xAA00301ULL, 0xAA00302ULL, 0xAA00303ULL,
+        0xAA00304ULL, 0xAA00306ULL, 0xAA00308ULL, 0xAA00309ULL,
+        0xAA0030AULL, 0xAA0030BULL, 0xAA0030CULL, 0xAA0030FULL,
+        0xAA00311ULL, 0xAA0031BULL, 0xAA00323ULL, 0xAA00324ULL,
+        0xAA00328ULL, 0xAA0032DULL, 0xAA00330ULL, 0xAC00303ULL,
+        0xAC00323ULL, 0xAE00300ULL, 0xAE00301ULL, 0xAE00302ULL,
+        0xAE00307ULL, 0xAE00308ULL, 0xAE00323ULL, 0xB000307ULL,
+        0xB000308ULL, 0xB200300ULL, 0xB200301ULL, 0xB200302ULL,
+        0xB200303ULL, 0xB200304ULL, 0xB200307ULL, 0xB200308ULL,
+        0xB200309ULL, 0xB200323ULL, 0xB400301ULL, 0xB400302ULL,
+        0xB400307ULL, 0xB40030CULL, 0xB400323ULL, 0xB400331ULL,
+        0xC200300ULL, 0xC200301ULL, 0xC200302ULL, 0xC200303ULL,
+        0xC200304ULL, 0xC200306ULL, 0xC200307ULL, 0xC200308ULL,
+        0xC200309ULL, 0xC20030AULL, 0xC20030CULL, 0xC20030FULL,
+        0xC200311ULL, 0xC200323ULL, 0xC200325ULL, 0xC200328ULL,
+        0xC400307ULL, 0xC400323ULL, 0xC400331ULL, 0xC600301ULL,
+        0xC600302ULL, 0xC600307ULL, 0xC60030CULL, 0xC600327ULL,
+        0xC800307ULL, 0xC80030CULL, 0xC800323ULL, 0xC800327ULL,
+        0xC80032DULL, 0xC800331ULL, 0xCA00300ULL, 0xCA00301ULL,
+        0xCA00302ULL, 0xCA00303ULL, 0xCA00304ULL, 0xCA00306ULL,
+        0xCA00307ULL, 0xCA00308ULL, 0xCA00309ULL, 0xCA0030CULL,
+        0xCA0030FULL, 0xCA00311ULL, 0xCA00323ULL, 0xCA00327ULL,
+        0xCA00328ULL, 0xCA0032DULL, 0xCA00330ULL, 0xCC00307ULL,
+        0xCE00301ULL, 0xCE00302ULL, 0xCE00304ULL, 0xCE00306ULL,
+        0xCE00307ULL, 0xCE0030CULL, 0xCE00327ULL, 0xD000302ULL,
+        0xD000307ULL, 0xD000308ULL, 0xD00030CULL, 0xD000323ULL,
+        0xD000327ULL, 0xD00032EULL, 0xD000331ULL, 0xD200300ULL,
+        0xD200301ULL, 0xD200302ULL, 0xD200303ULL, 0xD200304ULL,
+        0xD200306ULL, 0xD200308ULL, 0xD200309ULL, 0xD20030CULL,
+        0xD20030FULL, 0xD200311ULL, 0xD200323ULL, 0xD200328ULL,
+        0xD200330ULL, 0xD400302ULL, 0xD40030CULL, 0xD600301ULL,
+        0xD60030CULL, 0xD600323ULL, 0xD600327ULL, 0xD600331ULL,
+        0xD800301ULL, 0xD80030CULL, 0xD800323ULL, 0xD800327ULL,
+        0xD80032DULL, 0xD800331ULL, 0xDA00301ULL, 0xDA00307ULL,
+        0xDA00323ULL, 0xDC00300ULL, 0xDC00301ULL, 0xDC00303ULL,
+        0xDC00307ULL, 0xDC0030CULL, 0xDC00323ULL, 0xDC00327ULL,
+        0xDC0032DULL, 0xDC00331ULL, 0xDE00300ULL, 0xDE00301ULL,
+        0xDE00302ULL, 0xDE00303ULL, 0xDE00304ULL, 0xDE00306ULL,
+        0xDE00307ULL, 0xDE00308ULL, 0xDE00309ULL, 0xDE0030BULL,
+        0xDE0030CULL, 0xDE0030FULL, 0xDE00311ULL, 0xDE0031BULL,
+        0xDE00323ULL, 0xDE00328ULL, 0xE000301ULL, 0xE000307ULL,
+        0xE400301ULL, 0xE400307ULL, 0xE40030CULL, 0xE40030FULL,
+        0xE400311ULL, 0xE400323ULL, 0xE400327ULL, 0xE400331ULL,
+        0xE600301ULL, 0xE600302ULL, 0xE600307ULL, 0xE60030CULL,
+        0xE600323ULL, 0xE600326ULL, 0xE600327ULL, 0xE800307ULL,
+        0xE800308ULL, 0xE80030CULL, 0xE800323ULL, 0xE800326ULL,
+        0xE800327ULL, 0xE80032DULL, 0xE800331ULL, 0xEA00300ULL,
+        0xEA00301ULL, 0xEA00302ULL, 0xEA00303ULL, 0xEA00304ULL,
+        0xEA00306ULL, 0xEA00308ULL, 0xEA00309ULL, 0xEA0030AULL,
+        0xEA0030BULL, 0xEA0030CULL, 0xEA0030FULL, 0xEA00311ULL,
+        0xEA0031BULL, 0xEA00323ULL, 0xEA00324ULL, 0xEA00328ULL,
+        0xEA0032DULL, 0xEA00330ULL, 0xEC00303ULL, 0xEC00323ULL,
+        0xEE00300ULL, 0xEE00301ULL, 0xEE00302ULL, 0xEE00307ULL,
+        0xEE00308ULL, 0xEE0030AULL, 0xEE00323ULL, 0xF000307ULL,
+        0xF000308ULL, 0xF200300ULL, 0xF200301ULL, 0xF200302ULL,
+        0xF200303ULL, 0xF200304ULL, 0xF200307ULL, 0xF200308ULL,
+        0xF200309ULL, 0xF20030AULL, 0xF200323ULL, 0xF400301ULL,
+        0xF400302ULL, 0xF400307ULL, 0xF40030CULL, 0xF400323ULL,
+        0xF400331ULL, 0x15000300ULL, 0x15000301ULL, 0x15000342ULL,
+        0x18400300ULL, 0x18400301ULL, 0x18400303ULL, 0x18400309ULL,
+        0x18800304ULL, 0x18A00301ULL, 0x18C00301ULL, 0x18C00304ULL,
+        0x18E00301ULL, 0x19400300ULL, 0x19400301ULL, 0x19400303ULL,
+        0x19400309ULL, 0x19E00301ULL, 0x1A800300ULL, 0x1A800301ULL,
+        0x1A800303ULL, 0x1A800309ULL, 0x1AA00301ULL, 0x1AA00304ULL,
+        0x1AA00308ULL, 0x1AC00304ULL, 0x1B000301ULL, 0x1B800300ULL,
+        0x1B800301ULL, 0x1B800304ULL, 0x1B80030CULL, 0x1C400300ULL,
+        0x1C400301ULL, 0x1C400303ULL, 0x1C400309ULL, 0x1C800304ULL,
+        0x1CA00301ULL, 0x1CC00301ULL, 0x1CC00304ULL, 0x1CE00301ULL,
+        0x1D400300ULL, 0x1D400301ULL, 0x1D400303ULL, 0x1D400309ULL,
+        0x1DE00301ULL, 0x1E800300ULL, 0x1E800301ULL, 0x1E800303ULL,
+        0x1E800309ULL, 0x1EA00301ULL, 0x1EA00304ULL, 0x1EA00308ULL,
+        0x1EC00304ULL, 0x1F000301ULL, 0x1F800300ULL, 0x1F800301ULL,
+        0x1F800304ULL, 0x1F80030CULL, 0x20400300ULL, 0x20400301ULL,
+        0x20400303ULL, 0x20400309ULL, 0x20600300ULL, 0x20600301ULL,
+        0x20600303ULL, 0x20600309ULL, 0x22400300ULL, 0x22400301ULL,
+        0x22600300ULL, 0x22600301ULL, 0x29800300ULL, 0x29800301ULL,
+        0x29A00300ULL, 0x29A00301ULL, 0x2B400307ULL, 0x2B600307ULL,
+        0x2C000307ULL, 0x2C200307ULL, 0x2D000301ULL, 0x2D200301ULL,
+        0x2D400308ULL, 0x2D600308ULL, 0x2FE00307ULL, 0x34000300ULL,
+        0x34000301ULL, 0x34000303ULL, 0x34000309ULL, 0x34000323ULL,
+        0x34200300ULL, 0x34200301ULL, 0x34200303ULL, 0x34200309ULL,
+        0x34200323ULL, 0x35E00300ULL, 0x35E00301ULL, 0x35E00303ULL,
+        0x35E00309ULL, 0x35E00323ULL, 0x36000300ULL, 0x36000301ULL,
+        0x36000303ULL, 0x36000309ULL, 0x36000323ULL, 0x36E0030CULL,
+        0x3D400304ULL, 0x3D600304ULL, 0x44C00304ULL, 0x44E00304ULL,
+        0x45000306ULL, 0x45200306ULL, 0x45C00304ULL, 0x45E00304ULL,
+        0x5240030CULL, 0x72200300ULL, 0x72200301ULL, 0x72200304ULL,
+        0x72200306ULL, 0x72200313ULL, 0x72200314ULL, 0x72200345ULL,
+        0x72A00300ULL, 0x72A00301ULL, 0x72A00313ULL, 0x72A00314ULL,
+        0x72E00300ULL, 0x72E00301ULL, 0x72E00313ULL, 0x72E00314ULL,
+        0x72E00345ULL, 0x73200300ULL, 0x73200301ULL, 0x73200304ULL,
+        0x73200306ULL, 0x73200308ULL, 0x73200313ULL, 0x73200314ULL,
+        0x73E00300ULL, 0x73E00301ULL, 0x73E00313ULL, 0x73E00314ULL,
+        0x74200314ULL, 0x74A00300ULL, 0x74A00301ULL, 0x74A00304ULL,
+        0x74A00306ULL, 0x74A00308ULL, 0x74A00314ULL, 0x75200300ULL,
+        0x75200301ULL, 0x75200313ULL, 0x75200314ULL, 0x75200345ULL,
+        0x75800345ULL, 0x75C00345ULL, 0x76200300ULL, 0x76200301ULL,
+        0x76200304ULL, 0x76200306ULL, 0x76200313ULL, 0x76200314ULL,
+        0x76200342ULL, 0x76200345ULL, 0x76A00300ULL, 0x76A00301ULL,
+        0x76A00313ULL, 0x76A00314ULL, 0x76E00300ULL, 0x76E00301ULL,
+        0x76E00313ULL, 0x76E00314ULL, 0x76E00342ULL, 0x76E00345ULL,
+        0x77200300ULL, 0x77200301ULL, 0x77200304ULL, 0x77200306ULL,
+        0x77200308ULL, 0x77200313ULL, 0x77200314ULL, 0x77200342ULL,
+        0x77E00300ULL, 0x77E00301ULL, 0x77E00313ULL, 0x77E00314ULL,
+        0x78200313ULL, 0x78200314ULL, 0x78A00300ULL, 0x78A00301ULL,
+        0x78A00304ULL, 0x78A00306ULL, 0x78A00308ULL, 0x78A00313ULL,
+        0x78A00314ULL, 0x78A00342ULL, 0x79200300ULL, 0x79200301ULL,
+        0x79200313ULL, 0x79200314ULL, 0x79200342ULL, 0x79200345ULL,
+        0x79400300ULL, 0x79400301ULL, 0x79400342ULL, 0x79600300ULL,
+        0x79600301ULL, 0x79600342ULL, 0x79C00345ULL, 0x7A400301ULL,
+        0x7A400308ULL, 0x80C00308ULL, 0x82000306ULL, 0x82000308ULL,
+        0x82600301ULL, 0x82A00300ULL, 0x82A00306ULL, 0x82A00308ULL,
+        0x82C00306ULL, 0x82C00308ULL, 0x82E00308ULL, 0x83000300ULL,
+        0x83000304ULL, 0x83000306ULL, 0x83000308ULL, 0x83400301ULL,
+        0x83C00308ULL, 0x84600304ULL, 0x84600306ULL, 0x84600308ULL,
+        0x8460030BULL, 0x84E00308ULL, 0x85600308ULL, 0x85A00308ULL,
+        0x86000306ULL, 0x86000308ULL, 0x86600301ULL, 0x86A00300ULL,
+        0x86A00306ULL, 0x86A00308ULL, 0x86C00306ULL, 0x86C00308ULL,
+        0x86E00308ULL, 0x87000300ULL, 0x87000304ULL, 0x87000306ULL,
+        0x87000308ULL, 0x87400301ULL, 0x87C00308ULL, 0x88600304ULL,
+        0x88600306ULL, 0x88600308ULL, 0x8860030BULL, 0x88E00308ULL,
+        0x89600308ULL, 0x89A00308ULL, 0x8AC00308ULL, 0x8E80030FULL,
+        0x8EA0030FULL, 0x9B000308ULL, 0x9B200308ULL, 0x9D000308ULL,
+        0x9D200308ULL, 0xC4E00653ULL, 0xC4E00654ULL, 0xC4E00655ULL,
+        0xC9000654ULL, 0xC9400654ULL, 0xD8200654ULL, 0xDA400654ULL,
+        0xDAA00654ULL, 0x12500093CULL, 0x12600093CULL, 0x12660093CULL,
+        0x138E009BEULL, 0x138E009D7ULL, 0x168E00B3EULL, 0x168E00B56ULL,
+        0x168E00B57ULL, 0x172400BD7ULL, 0x178C00BBEULL, 0x178C00BD7ULL,
+        0x178E00BBEULL, 0x188C00C56ULL, 0x197E00CD5ULL, 0x198C00CC2ULL,
+        0x198C00CD5ULL, 0x198C00CD6ULL, 0x199400CD5ULL, 0x1A8C00D3EULL,
+        0x1A8C00D57ULL, 0x1A8E00D3EULL, 0x1BB200DCAULL, 0x1BB200DCFULL,
+        0x1BB200DDFULL, 0x1BB800DCAULL, 0x204A0102EULL, 0x360A01B35ULL,
+        0x360E01B35ULL, 0x361201B35ULL, 0x361601B35ULL, 0x361A01B35ULL,
+        0x362201B35ULL, 0x367401B35ULL, 0x367801B35ULL, 0x367C01B35ULL,
+        0x367E01B35ULL, 0x368401B35ULL, 0x3C6C00304ULL, 0x3C6E00304ULL,
+        0x3CB400304ULL, 0x3CB600304ULL, 0x3CC400307ULL, 0x3CC600307ULL,
+        0x3D4000302ULL, 0x3D4000306ULL, 0x3D4200302ULL, 0x3D4200306ULL,
+        0x3D7000302ULL, 0x3D7200302ULL, 0x3D9800302ULL, 0x3D9A00302ULL,
+        0x3E0000300ULL, 0x3E0000301ULL, 0x3E0000342ULL, 0x3E0000345ULL,
+        0x3E0200300ULL, 0x3E0200301ULL, 0x3E0200342ULL, 0x3E0200345ULL,
+        0x3E0400345ULL, 0x3E0600345ULL, 0x3E0800345ULL, 0x3E0A00345ULL,
+        0x3E0C00345ULL, 0x3E0E00345ULL, 0x3E1000300ULL, 0x3E1000301ULL,
+        0x3E1000342ULL, 0x3E1000345ULL, 0x3E1200300ULL, 0x3E1200301ULL,
+        0x3E1200342ULL, 0x3E1200345ULL, 0x3E1400345ULL, 0x3E1600345ULL,
+        0x3E1800345ULL, 0x3E1A00345ULL, 0x3E1C00345ULL, 0x3E1E00345ULL,
+        0x3E2000300ULL, 0x3E2000301ULL, 0x3E2200300ULL, 0x3E2200301ULL,
+        0x3E3000300ULL, 0x3E3000301ULL, 0x3E3200300ULL, 0x3E3200301ULL,
+        0x3E4000300ULL, 0x3E4000301ULL, 0x3E4000342ULL, 0x3E4000345ULL,
+        0x3E4200300ULL, 0x3E4200301ULL, 0x3E4200342ULL, 0x3E4200345ULL,
+        0x3E4400345ULL, 0x3E4600345ULL, 0x3E4800345ULL, 0x3E4A00345ULL,
+        0x3E4C00345ULL, 0x3E4E00345ULL, 0x3E5000300ULL, 0x3E5000301ULL,
+        0x3E5000342ULL, 0x3E5000345ULL, 0x3E5200300ULL, 0x3E5200301ULL,
+        0x3E5200342ULL, 0x3E5200345ULL, 0x3E5400345ULL, 0x3E5600345ULL,
+        0x3E5800345ULL, 0x3E5A00345ULL, 0x3E5C00345ULL, 0x3E5E00345ULL,
+        0x3E6000300ULL, 0x3E6000301ULL, 0x3E6000342ULL, 0x3E6200300ULL,
+        0x3E6200301ULL, 0x3E6200342ULL, 0x3E7000300ULL, 0x3E7000301ULL,
+        0x3E7000342ULL, 0x3E7200300ULL, 0x3E7200301ULL, 0x3E7200342ULL,
+        0x3E8000300ULL, 0x3E8000301ULL, 0x3E8200300ULL, 0x3E8200301ULL,
+        0x3E9000300ULL, 0x3E9000301ULL, 0x3E9200300ULL, 0x3E9200301ULL,
+        0x3EA000300ULL, 0x3EA000301ULL, 0x3EA000342ULL, 0x3EA200300ULL,
+        0x3EA200301ULL, 0x3EA200342ULL, 0x3EB200300ULL, 0x3EB200301ULL,
+        0x3EB200342ULL, 0x3EC000300ULL, 0x3EC000301ULL, 0x3EC000342ULL,
+        0x3EC000345ULL, 0x3EC200300ULL, 0x3EC200301ULL, 0x3EC200342ULL,
+        0x3EC200345ULL, 0x3EC400345ULL, 0x3EC600345ULL, 0x3EC800345ULL,
+        0x3ECA00345ULL, 0x3ECC00345ULL, 0x3ECE00345ULL, 0x3ED000300ULL,
+        0x3ED000301ULL, 0x3ED000342ULL, 0x3ED000345ULL, 0x3ED200300ULL,
+        0x3ED200301ULL, 0x3ED200342ULL, 0x3ED200345ULL, 0x3ED400345ULL,
+        0x3ED600345ULL, 0x3ED800345ULL, 0x3EDA00345ULL, 0x3EDC00345ULL,
+        0x3EDE00345ULL, 0x3EE000345ULL, 0x3EE800345ULL, 0x3EF800345ULL,
+        0x3F6C00345ULL, 0x3F7E00300ULL, 0x3F7E00301ULL, 0x3F7E00342ULL,
+        0x3F8C00345ULL, 0x3FEC00345ULL, 0x3FFC00300ULL, 0x3FFC00301ULL,
+        0x3FFC00342ULL, 0x432000338ULL, 0x432400338ULL, 0x432800338ULL,
+        0x43A000338ULL, 0x43A400338ULL, 0x43A800338ULL, 0x440600338ULL,
+        0x441000338ULL, 0x441600338ULL, 0x444600338ULL, 0x444A00338ULL,
+        0x447800338ULL, 0x448600338ULL, 0x448A00338ULL, 0x449000338ULL,
+        0x449A00338ULL, 0x44C200338ULL, 0x44C800338ULL, 0x44CA00338ULL,
+        0x44E400338ULL, 0x44E600338ULL, 0x44EC00338ULL, 0x44EE00338ULL,
+        0x44F400338ULL, 0x44F600338ULL, 0x44F800338ULL, 0x44FA00338ULL,
+        0x450400338ULL, 0x450600338ULL, 0x450C00338ULL, 0x450E00338ULL,
+        0x452200338ULL, 0x452400338ULL, 0x454400338ULL, 0x455000338ULL,
+        0x455200338ULL, 0x455600338ULL, 0x456400338ULL, 0x456600338ULL,
+        0x456800338ULL, 0x456A00338ULL, 0x608C03099ULL, 0x609603099ULL,
+        0x609A03099ULL, 0x609E03099ULL, 0x60A203099ULL, 0x60A603099ULL,
+        0x60AA03099ULL, 0x60AE03099ULL, 0x60B203099ULL, 0x60B603099ULL,
+        0x60BA03099ULL, 0x60BE03099ULL, 0x60C203099ULL, 0x60C803099ULL,
+        0x60CC03099ULL, 0x60D003099ULL, 0x60DE03099ULL, 0x60DE0309AULL,
+        0x60E403099ULL, 0x60E40309AULL, 0x60EA03099ULL, 0x60EA0309AULL,
+        0x60F003099ULL, 0x60F00309AULL, 0x60F603099ULL, 0x60F60309AULL,
+        0x613A03099ULL, 0x614C03099ULL, 0x615603099ULL, 0x615A03099ULL,
+        0x615E03099ULL, 0x616203099ULL, 0x616603099ULL, 0x616A03099ULL,
+        0x616E03099ULL, 0x617203099ULL, 0x617603099ULL, 0x617A03099ULL,
+        0x617E03099ULL, 0x618203099ULL, 0x618803099ULL, 0x618C03099ULL,
+        0x619003099ULL, 0x619E03099ULL, 0x619E0309AULL, 0x61A403099ULL,
+        0x61A40309AULL, 0x61AA03099ULL, 0x61AA0309AULL, 0x61B003099ULL,
+        0x61B00309AULL, 0x61B603099ULL, 0x61B60309AULL, 0x61DE03099ULL,
+        0x61E003099ULL, 0x61E203099ULL, 0x61E403099ULL, 0x61FA03099ULL,
+        0x22132110BAULL, 0x22136110BAULL, 0x2214A110BAULL, 0x2226211127ULL,
+        0x2226411127ULL, 0x2268E1133EULL, 0x2268E11357ULL, 0x22972114B0ULL,
+        0x22972114BAULL, 0x22972114BDULL, 0x22B70115AFULL, 0x22B72115AFULL,
+        0x2326A11930ULL,
+    };
+
+    static const uint32_t cstr_unicode_compose_values[941] =
+    {
+        0x226E, 0x2260, 0x226F, 0xC0, 0xC1, 0xC2, 0xC3, 0x100,
+        0x102, 0x226, 0xC4, 0x1EA2, 0xC5, 0x1CD, 0x200, 0x202,
+        0x1EA0, 0x1E00, 0x104, 0x1E02, 0x1E04, 0x1E06, 0x106, 0x108,
+        0x10A, 0x10C, 0xC7, 0x1E0A, 0x10E, 0x1E0C, 0x1E10, 0x1E12,
+        0x1E0E, 0xC8, 0xC9, 0xCA, 0x1EBC, 0x112, 0x114, 0x116,
+        0xCB, 0x1EBA, 0x11A, 0x204, 0x206, 0x1EB8, 0x228, 0x118,
+        0x1E18, 0x1E1A, 0x1E1E, 0x1F4, 0x11C, 0x1E20, 0x11E, 0x120,
+        0x1E6, 0x122, 0x124, 0x1E22, 0x1E26, 0x21E, 0x1E24, 0x1E28,
+        0x1E2A, 0xCC, 0xCD, 0xCE, 0x128, 0x12A, 0x12C, 0x130,
+        0xCF, 0x1EC8, 0x1CF, 0x208, 0x20A, 0x1ECA, 0x12E, 0x1E2C,
+        0x134, 0x1E30, 0x1E8, 0x1E32, 0x136, 0x1E34, 0x139, 0x13D,
+        0x1E36, 0x13B, 0x1E3C, 0x1E3A, 0x1E3E, 0x1E40, 0x1E42, 0x1F8,
+        0x143, 0xD1, 0x1E44, 0x147, 0x1E46, 0x145, 0x1E4A, 0x1E48,
+        0xD2, 0xD3, 0xD4, 0xD5, 0x14C, 0x14E, 0x22E, 0xD6,
+        0x1ECE, 0x150, 0x1D1, 0x20C, 0x20E, 0x1A0, 0x1ECC, 0x1EA,
+        0x1E54, 0x1E56, 0x154, 0x1E58, 0x158, 0x210, 0x212, 0x1E5A,
+        0x156, 0x1E5E, 0x15A, 0x15C, 0x1E60, 0x160, 0x1E62, 0x218,
+        0x15E, 0x1E6A, 0x164, 0x1E6C, 0x21A, 0x162, 0x1E70, 0x1E6E,
+        0xD9, 0xDA, 0xDB, 0x168, 0x16A, 0x16C, 0xDC, 0x1EE6,
+        0x16E, 0x170, 0x1D3, 0x214, 0x216, 0x1AF, 0x1EE4, 0x1E72,
+        0x172, 0x1E76, 0x1E74, 0x1E7C, 0x1E7E, 0x1E80, 0x1E82, 0x174,
+        0x1E86, 0x1E84, 0x1E88, 0x1E8A, 0x1E8C, 0x1EF2, 0xDD, 0x176,
+        0x1EF8, 0x232, 0x1E8E, 0x178, 0x1EF6, 0x1EF4, 0x179, 0x1E90,
+        0x17B, 0x17D, 0x1E92, 0x1E94, 0xE0, 0xE1, 0xE2, 0xE3,
+        0x101, 0x103, 0x227, 0xE4, 0x1EA3, 0xE5, 0x1CE, 0x201,
+        0x203, 0x1EA1, 0x1E01, 0x105, 0x1E03, 0x1E05, 0x1E07, 0x107,
+        0x109, 0x10B, 0x10D, 0xE7, 0x1E0B, 0x10F, 0x1E0D, 0x1E11,
+        0x1E13, 0x1E0F, 0xE8, 0xE9, 0xEA, 0x1EBD, 0x113, 0x115,
+        0x117, 0xEB, 0x1EBB, 0x11B, 0x205, 0x207, 0x1EB9, 0x229,
+        0x119, 0x1E19, 0x1E1B, 0x1E1F, 0x1F5, 0x11D, 0x1E21, 0x11F,
+        0x121, 0x1E7, 0x123, 0x125, 0x1E23, 0x1E27, 0x21F, 0x1E25,
+        0x1E29, 0x1E2B, 0x1E96, 0xEC, 0xED, 0xEE, 0x129, 0x12B,
+        0x12D, 0xEF, 0x1EC9, 0x1D0, 0x209, 0x20B, 0x1ECB, 0x12F,
+        0x1E2D, 0x135, 0x1F0, 0x1E31, 0x1E9, 0x1E33, 0x137, 0x1E35,
+        0x13A, 0x13E, 0x1E37, 0x13C, 0x1E3D, 0x1E3B, 0x1E3F, 0x1E41,
+        0x1E43, 0x1F9, 0x144, 0xF1, 0x1E45, 0x148, 0x1E47, 0x146,
+        0x1E4B, 0x1E49, 0xF2, 0xF3, 0xF4, 0xF5, 0x14D, 0x14F,
+        0x22F, 0xF6, 0x1ECF, 0x151, 0x1D2, 0x20D, 0x20F, 0x1A1,
+        0x1ECD, 0x1EB, 0x1E55, 0x1E57, 0x155, 0x1E59, 0x159, 0x211,
+        0x213, 0x1E5B, 0x157, 0x1E5F, 0x15B, 0x15D, 0x1E61, 0x161,
+        0x1E63, 0x219, 0x15F, 0x1E6B, 0x1E97, 0x165, 0x1E6D, 0x21B,
+        0x163, 0x1E71, 0x1E6F, 0xF9, 0xFA, 0xFB, 0x169, 0x16B,
+        0x16D, 0xFC, 0x1EE7, 0x16F, 0x171, 0x1D4, 0x215, 0x217,
+        0x1B0, 0x1EE5, 0x1E73, 0x173, 0x1E77, 0x1E75, 0x1E7D, 0x1E7F,
+        0x1E81, 0x1E83, 0x175, 0x1E87, 0x1E85, 0x1E98, 0x1E89, 0x1E8B,
+        0x1E8D, 0x1EF3, 0xFD, 0x177, 0x1EF9, 0x233, 0x1E8F, 0xFF,
+        0x1EF7, 0x1E99, 0x1EF5, 0x17A, 0x1E91, 0x17C, 0x17E, 0x1E93,
+        0x1E95, 0x1FED, 0x385, 0x1FC1, 0x1EA6, 0x1EA4, 0x1EAA, 0x1EA8,
+        0x1DE, 0x1FA, 0x1FC, 0x1E2, 0x1E08, 0x1EC0, 0x1EBE, 0x1EC4,
+        0x1EC2, 0x1E2E, 0x1ED2, 0x1ED0, 0x1ED6, 0x1ED4, 0x1E4C, 0x22C,
+        0x1E4E, 0x22A, 0x1FE, 0x1DB, 0x1D7, 0x1D5, 0x1D9, 0x1EA7,
+        0x1EA5, 0x1EAB, 0x1EA9, 0x1DF, 0x1FB, 0x1FD, 0x1E3, 0x1E09,
+        0x1EC1, 0x1EBF, 0x1EC5, 0x1EC3, 0x1E2F, 0x1ED3, 0x1ED1, 0x1ED7,
+        0x1ED5, 0x1E4D, 0x22D, 0x1E4F, 0x22B, 0x1FF, 0x1DC, 0x1D8,
+        0x1D6, 0x1DA, 0x1EB0, 0x1EAE, 0x1EB4, 0x1EB2, 0x1EB1, 0x1EAF,
+        0x1EB5, 0x1EB3, 0x1E14, 0x1E16, 0x1E15, 0x1E17, 0x1E50, 0x1E52,
+        0x1E51, 0x1E53, 0x1E64, 0x1E65, 0x1E66, 0x1E67, 0x1E78, 0x1E79,
+        0x1E7A, 0x1E7B, 0x1E9B, 0x1EDC, 0x1EDA, 0x1EE0, 0x1EDE, 0x1EE2,
+        0x1EDD, 0x1EDB, 0x1EE1, 0x1EDF, 0x1EE3, 0x1EEA, 0x1EE8, 0x1EEE,
+        0x1EEC, 0x1EF0, 0x1EEB, 0x1EE9, 0x1EEF, 0x1EED, 0x1EF1, 0x1EE,
+        0x1EC, 0x1ED, 0x1E0, 0x1E1, 0x1E1C, 0x1E1D, 0x230, 0x231,
+        0x1EF, 0x1FBA, 0x386, 0x1FB9, 0x1FB8, 0x1F08, 0x1F09, 0x1FBC,
+        0x1FC8, 0x388, 0x1F18, 0x1F19, 0x1FCA, 0x389, 0x1F28, 0x1F29,
+        0x1FCC, 0x1FDA, 0x38A, 0x1FD9, 0x1FD8, 0x3AA, 0x1F38, 0x1F39,
+        0x1FF8, 0x38C, 0x1F48, 0x1F49, 0x1FEC, 0x1FEA, 0x38E, 0x1FE9,
+        0x1FE8, 0x3AB, 0x1F59, 0x1FFA, 0x38F, 0x1F68, 0x1F69, 0x1FFC,
+        0x1FB4, 0x1FC4, 0x1F70, 0x3AC, 0x1FB1, 0x1FB0, 0x1F00, 0x1F01,
+        0x1FB6, 0x1FB3, 0x1F72, 0x3AD, 0x1F10, 0x1F11, 0x1F74, 0x3AE,
+        0x1F20, 0x1F21, 0x1FC6, 0x1FC3, 0x1F76, 0x3AF, 0x1FD1, 0x1FD0,
+        0x3CA, 0x1F30, 0x1F31, 0x1FD6, 0x1F78, 0x3CC, 0x1F40, 0x1F41,
+        0x1FE4, 0x1FE5, 0x1F7A, 0x3CD, 0x1FE1, 0x1FE0, 0x3CB, 0x1F50,
+        0x1F51, 0x1FE6, 0x1F7C, 0x3CE, 0x1F60, 0x1F61, 0x1FF6, 0x1FF3,
+        0x1FD2, 0x390, 0x1FD7, 0x1FE2, 0x3B0, 0x1FE7, 0x1FF4, 0x3D3,
+        0x3D4, 0x407, 0x4D0, 0x4D2, 0x403, 0x400, 0x4D6, 0x401,
+        0x4C1, 0x4DC, 0x4DE, 0x40D, 0x4E2, 0x419, 0x4E4, 0x40C,
+        0x4E6, 0x4EE, 0x40E, 0x4F0, 0x4F2, 0x4F4, 0x4F8, 0x4EC,
+        0x4D1, 0x4D3, 0x453, 0x450, 0x4D7, 0x451, 0x4C2, 0x4DD,
+        0x4DF, 0x45D, 0x4E3, 0x439, 0x4E5, 0x45C, 0x4E7, 0x4EF,
+        0x45E, 0x4F1, 0x4F3, 0x4F5, 0x4F9, 0x4ED, 0x457, 0x476,
+        0x477, 0x4DA, 0x4DB, 0x4EA, 0x4EB, 0x622, 0x623, 0x625,
+        0x624, 0x626, 0x6C2, 0x6D3, 0x6C0, 0x929, 0x931, 0x934,
+        0x9CB, 0x9CC, 0xB4B, 0xB48, 0xB4C, 0xB94, 0xBCA, 0xBCC,
+        0xBCB, 0xC48, 0xCC0, 0xCCA, 0xCC7, 0xCC8, 0xCCB, 0xD4A,
+        0xD4C, 0xD4B, 0xDDA, 0xDDC, 0xDDE, 0xDDD, 0x1026, 0x1B06,
+        0x1B08, 0x1B0A, 0x1B0C, 0x1B0E, 0x1B12, 0x1B3B, 0x1B3D, 0x1B40,
+        0x1B41, 0x1B43, 0x1E38, 0x1E39, 0x1E5C, 0x1E5D, 0x1E68, 0x1E69,
+        0x1EAC, 0x1EB6, 0x1EAD, 0x1EB7, 0x1EC6, 0x1EC7, 0x1ED8, 0x1ED9,
+        0x1F02, 0x1F04, 0x1F06, 0x1F80, 0x1F03, 0x1F05, 0x1F07, 0x1F81,
+        0x1F82, 0x1F83, 0x1F84, 0x1F85, 0x1F86, 0x1F87, 0x1F0A, 0x1F0C,
+        0x1F0E, 0x1F88, 0x1F0B, 0x1F0D, 0x1F0F, 0x1F89, 0x1F8A, 0x1F8B,
+        0x1F8C, 0x1F8D, 0x1F8E, 0x1F8F, 0x1F12, 0x1F14, 0x1F13, 0x1F15,
+        0x1F1A, 0x1F1C, 0x1F1B, 0x1F1D, 0x1F22, 0x1F24, 0x1F26, 0x1F90,
+        0x1F23, 0x1F25, 0x1F27, 0x1F91, 0x1F92, 0x1F93, 0x1F94, 0x1F95,
+        0x1F96, 0x1F97, 0x1F2A, 0x1F2C, 0x1F2E, 0x1F98, 0x1F2B, 0x1F2D,
+        0x1F2F, 0x1F99, 0x1F9A, 0x1F9B, 0x1F9C, 0x1F9D, 0x1F9E, 0x1F9F,
+        0x1F32, 0x1F34, 0x1F36, 0x1F33, 0x1F35, 0x1F37, 0x1F3A, 0x1F3C,
+        0x1F3E, 0x1F3B, 0x1F3D, 0x1F3F, 0x1F42, 0x1F44, 0x1F43, 0x1F45,
+        0x1F4A, 0x1F4C, 0x1F4B, 0x1F4D, 0x1F52, 0x1F54, 0x1F56, 0x1F53,
+        0x1F55, 0x1F57, 0x1F5B, 0x1F5D, 0x1F5F, 0x1F62, 0x1F64, 0x1F66,
+        0x1FA0, 0x1F63, 0x1F65, 0x1F67, 0x1FA1, 0x1FA2, 0x1FA3, 0x1FA4,
+        0x1FA5, 0x1FA6, 0x1FA7, 0x1F6A, 0x1F6C, 0x1F6E, 0x1FA8, 0x1F6B,
+        0x1F6D, 0x1F6F, 0x1FA9, 0x1FAA, 0x1FAB, 0x1FAC, 0x1FAD, 0x1FAE,
+        0x1FAF, 0x1FB2, 0x1FC2, 0x1FF2, 0x1FB7, 0x1FCD, 0x1FCE, 0x1FCF,
+        0x1FC7, 0x1FF7, 0x1FDD, 0x1FDE, 0x1FDF, 0x219A, 0x219B, 0x21AE,
+        0x21CD, 0x21CF, 0x21CE, 0x2204, 0x2209, 0x220C, 0x2224, 0x2226,
+        0x2241, 0x2244, 0x2247, 0x2249, 0x226D, 0x2262, 0x2270, 0x2271,
+        0x2274, 0x2275, 0x2278, 0x2279, 0x2280, 0x2281, 0x22E0, 0x22E1,
+        0x2284, 0x2285, 0x2288, 0x2289, 0x22E2, 0x22E3, 0x22AC, 0x22AD,
+        0x22AE, 0x22AF, 0x22EA, 0x22EB, 0x22EC, 0x22ED, 0x3094, 0x304C,
+        0x304E, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305A, 0x305C,
+        0x305E, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070, 0x3071,
+        0x3073, 0x3074, 0x3076, 0x3077, 0x3079, 0x307A, 0x307C, 0x307D,
+        0x309E, 0x30F4, 0x30AC, 0x30AE, 0x30B0, 0x30B2, 0x30B4, 0x30B6,
+        0x30B8, 0x30BA, 0x30BC, 0x30BE, 0x30C0, 0x30C2, 0x30C5, 0x30C7,
+        0x30C9, 0x30D0, 0x30D1, 0x30D3, 0x30D4, 0x30D6, 0x30D7, 0x30D9,
+        0x30DA, 0x30DC, 0x30DD, 0x30F7, 0x30F8, 0x30F9, 0x30FA, 0x30FE,
+        0x1109A, 0x1109C, 0x110AB, 0x1112E, 0x1112F, 0x1134B, 0x1134C, 0x114BC,
+        0x114BB, 0x114BE, 0x115BA, 0x115BB, 0x11938,
+    };
+
+    static const uint32_t cstr_unicode_compose_starters[24] =
+    {
+        0x9BE, 0x9D7, 0xB3E, 0xB56, 0xB57, 0xBBE, 0xBD7, 0xCC2,
+        0xCD5, 0xCD6, 0xD3E, 0xD57, 0xDCF, 0xDDF, 0x102E, 0x1B35,
+        0x11127, 0x1133E, 0x11357, 0x114B0, 0x114BA, 0x114BD, 0x115AF, 0x11930,
+    };
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_UNICODE_TABLES_H
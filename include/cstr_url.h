@@ -0,0 +1,462 @@
+#pragma once
+
+/**
+ * @file cstr_url.h
+ * @brief Percent-encoding (RFC 3986) and query-string splitting for CString.
+ *
+ * Decoding works in place, since output is never longer than input.
+ * The query iterator returns raw views into the source. Decode a key or
+ * value only when it is actually needed.
+ */
+
+#ifndef CSTR_URL_H
+#define CSTR_URL_H
+
+#include "cstr.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    CSTR_API size_t cstr_url_decode_buffer(_Out_ char* out, _In_reads_(size) const char* data, _In_ size_t size, _In_ bool plus_as_space);
+    CSTR_API bool cstr_url_valid(_In_reads_(size) const char* data, _In_ size_t size);
+    CSTR_API bool cstr_url_decode(_In_ CString* obj, _In_ bool plus_as_space);
+    CSTR_API bool cstr_append_url_decoded(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ bool plus_as_space);
+    CSTR_API bool cstr_append_url_encoded(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ bool space_as_plus);
+    CSTR_API bool cstr_query_next(_In_ CStringView query, _Inout_ size_t* start_pos, _Out_ CStringView* key, _Out_ CStringView* value);
+    CSTR_API bool cstr_url_equals(_In_ CStringView encoded, _In_reads_(size) const char* plain, _In_ size_t size);
+    CSTR_API bool cstr_query_find(_In_ CStringView query, _In_ const char* name, _Out_ CStringView* value);
+
+#if !defined(CSTR_LIBRARY) || defined(CSTR_IMPLEMENT_URL)
+
+    /**
+     * @brief Map hex digit to its value (0xFF = invalid)
+     */
+    CSTR_INLINE uint8_t cstr_url_hex_value(_In_ uint8_t c)
+    {
+        if (c >= '0' && c <= '9')
+            return (uint8_t)(c - '0');
+        if ((c | 0x20) >= 'a' && (c | 0x20) <= 'f')
+            return (uint8_t)((c | 0x20) - 'a' + 10);
+        return 0xFF;
+    }
+
+    /**
+     * @brief Check if byte is RFC 3986 unreserved (ALPHA / DIGIT / "-" / "." / "_" / "~")
+     */
+    CSTR_INLINE bool cstr_url_unreserved(_In_ uint8_t c)
+    {
+        return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '-' || c == '.' || c == '_' || c == '~';
+    }
+
+    /**
+     * @brief Find the first byte that must be percent-encoded
+     * @param data Input bytes
+     * @param size Input length
+     * @return Offset of first reserved byte, or size if none
+     */
+    CSTR_INLINE size_t cstr_url_scan_reserved(_In_reads_(size) const char* data, _In_ size_t size)
+    {
+        const uint8_t* in = (const uint8_t*)data;
+        size_t i = 0;
+
+#ifdef CSTR_HAVE_SSE2
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+
+            // Unsigned range checks: x - lo <= hi - lo  <=>  min(x - lo, hi - lo) == x - lo
+            __m128i digit = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+            __m128i alpha = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            __m128i ok = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+            ok = _mm_or_si128(ok, _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(25)), alpha));
+            ok = _mm_or_si128(ok, _mm_cmpeq_epi8(v, _mm_set1_epi8('-')));
+            ok = _mm_or_si128(ok, _mm_cmpeq_epi8(v, _mm_set1_epi8('.')));
+            ok = _mm_or_si128(ok, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+            ok = _mm_or_si128(ok, _mm_cmpeq_epi8(v, _mm_set1_epi8('~')));
+
+            int mask = _mm_movemask_epi8(ok) ^ 0xFFFF;
+            if (mask)
+                return i + cstr_ctz32((uint32_t)mask);
+        }
+#endif
+
+        for (; i < size; ++i)
+        {
+            if (!cstr_url_unreserved(in[i]))
+                return i;
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Find the first '%' (or '+' when plus_as_space) in encoded text
+     * @return Offset of the byte, or size if none
+     */
+    CSTR_INLINE size_t cstr_url_scan_escape(_In_reads_(size) const char* data, _In_ size_t size, _In_ bool plus_as_space)
+    {
+        const uint8_t* in = (const uint8_t*)data;
+        size_t i = 0;
+
+#ifdef CSTR_HAVE_SSE2
+        const __m128i percent = _mm_set1_epi8('%');
+        const __m128i plus = _mm_set1_epi8(plus_as_space ? '+' : '%');
+
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+            int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, percent), _mm_cmpeq_epi8(v, plus)));
+            if (mask)
+                return i + cstr_ctz32((uint32_t)mask);
+        }
+#endif
+
+        for (; i < size; ++i)
+        {
+            if (in[i] == '%' || (plus_as_space && in[i] == '+'))
+                return i;
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Percent-decode a buffer
+     * @param out           Destination (may equal data for in-place decoding)
+     * @param data          Encoded text
+     * @param size          Input length
+     * @param plus_as_space Decode '+' as ' ' (form encoding)
+     * @return Decoded length, or CSTR_INVALID on a malformed '%' escape
+     * @note On failure out may be partially written
+     */
+    size_t cstr_url_decode_buffer(_Out_ char* out, _In_reads_(size) const char* data, _In_ size_t size, _In_ bool plus_as_space)
+    {
+        char* start = out;
+        size_t i = 0;
+
+        while (i < size)
+        {
+            size_t run = cstr_url_scan_escape(data + i, size - i, plus_as_space);
+            if (out != data + i)
+                memmove(out, data + i, run);
+            out += run;
+            i += run;
+
+            if (i == size)
+                break;
+
+            if (data[i] == '+')
+            {
+                *out++ = ' ';
+                ++i;
+                continue;
+            }
+
+            if (size - i < 3)
+                return cstr_invalid;
+
+            uint8_t high = cstr_url_hex_value((uint8_t)data[i + 1]);
+            uint8_t low = cstr_url_hex_value((uint8_t)data[i + 2]);
+            if ((high | low) & 0x80)
+                return cstr_invalid;
+
+            *out++ = (char)((high << 4) | low);
+            i += 3;
+        }
+
+        return (size_t)(out - start);
+    }
+
+    /**
+     * @brief Check percent escapes without decoding
+     * @return true if every '%' is followed by two hex digits
+     */
+    bool cstr_url_valid(_In_reads_(size) const char* data, _In_ size_t size)
+    {
+        for (size_t i = 0; (i += cstr_url_scan_escape(data + i, size - i, false)) < size; i += 3)
+        {
+            if (size - i < 3 || ((cstr_url_hex_value((uint8_t)data[i + 1]) | cstr_url_hex_value((uint8_t)data[i + 2])) & 0x80))
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Percent-decode CString in place
+     * @param obj           CString to decode
+     * @param plus_as_space Decode '+' as ' ' (form encoding)
+     * @return true on success, false on a malformed '%' escape
+     * @note String is left unchanged on failure; no allocation is performed
+     */
+    bool cstr_url_decode(_In_ CString* obj, _In_ bool plus_as_space)
+    {
+        if (!obj)
+            return false;
+
+        cstr_lock(obj);
+
+        // Validate first so a malformed escape leaves the string untouched
+        if (!cstr_url_valid(obj->data, obj->length))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        obj->length = cstr_url_decode_buffer(obj->data, obj->data, obj->length, plus_as_space);
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Append percent-decoded text
+     * @param obj           Destination CString
+     * @param data          Encoded text
+     * @param size          Input length
+     * @param plus_as_space Decode '+' as ' ' (form encoding)
+     * @return true on success, false on malformed input or allocation failure
+     * @note On failure the destination is left unchanged
+     */
+    bool cstr_append_url_decoded(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ bool plus_as_space)
+    {
+        if (!obj || (!data && size))
+            return false;
+
+        cstr_lock(obj);
+
+        if (!cstr_reserve(obj, obj->length + size))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        size_t decoded = cstr_url_decode_buffer(obj->data + obj->length, data, size, plus_as_space);
+        if (decoded == cstr_invalid)
+        {
+            obj->data[obj->length] = '\0';
+            cstr_unlock(obj);
+            return false;
+        }
+
+        obj->length += decoded;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Append percent-encoded text
+     * @param obj           Destination CString
+     * @param data          Raw bytes
+     * @param size          Input length
+     * @param space_as_plus Encode ' ' as '+' (form encoding) instead of %20
+     * @return true on success, false on allocation failure
+     * @note Everything except RFC 3986 unreserved characters is escaped (uppercase hex)
+     */
+    bool cstr_append_url_encoded(_In_ CString* obj, _In_reads_(size) const char* data, _In_ size_t size, _In_ bool space_as_plus)
+    {
+        if (!obj || (!data && size))
+            return false;
+
+        if (size > cstr_invalid / 3)
+            return false;
+
+        // Sizing pass: each reserved byte grows by two characters
+        size_t encoded = size;
+        for (size_t i = 0; (i += cstr_url_scan_reserved(data + i, size - i)) < size; ++i)
+        {
+            if (!(space_as_plus && data[i] == ' '))
+                encoded += 2;
+        }
+
+        cstr_lock(obj);
+
+        if (encoded > cstr_invalid - 1 - obj->length || !cstr_reserve(obj, obj->length + encoded))
+        {
+            cstr_unlock(obj);
+            return false;
+        }
+
+        static const char digits[] = "0123456789ABCDEF";
+        char* out = obj->data + obj->length;
+        size_t i = 0;
+
+        while (i < size)
+        {
+            size_t run = cstr_url_scan_reserved(data + i, size - i);
+            memcpy(out, data + i, run);
+            out += run;
+            i += run;
+
+            if (i == size)
+                break;
+
+            uint8_t c = (uint8_t)data[i++];
+
+            if (space_as_plus && c == ' ')
+            {
+                *out++ = '+';
+                continue;
+            }
+
+            *out++ = '%';
+            *out++ = digits[c >> 4];
+            *out++ = digits[c & 15];
+        }
+
+        obj->length += encoded;
+        obj->data[obj->length] = '\0';
+
+        cstr_unlock(obj);
+
+        return true;
+    }
+
+    /**
+     * @brief Iterate key/value pairs of a query string
+     * @param query     Query text (without leading '?'; one is skipped if present)
+     * @param start_pos Starting/ending position (updated)
+     * @param key       Output view of the still-encoded key
+     * @param value     Output view of the still-encoded value (empty if no '=')
+     * @return true if a pair was found
+     * @note Pairs are separated by '&' or ';'; empty pairs are skipped.
+     *       No allocation: decode with cstr_append_url_decoded() when needed.
+     */
+    bool cstr_query_next(_In_ CStringView query, _Inout_ size_t* start_pos, _Out_ CStringView* key, _Out_ CStringView* value)
+    {
+        if (!start_pos || !key || !value || (!query.data && query.length))
+            return false;
+
+        size_t pos = *start_pos;
+        if (pos == 0 && query.length && query.data[0] == '?')
+            pos = 1;
+
+        while (pos < query.length && (query.data[pos] == '&' || query.data[pos] == ';'))
+            ++pos;
+
+        if (pos >= query.length)
+        {
+            *start_pos = query.length;
+            return false;
+        }
+
+        size_t end = pos;
+        size_t equals = cstr_invalid;
+
+        while (end < query.length && query.data[end] != '&' && query.data[end] != ';')
+        {
+            if (query.data[end] == '=' && equals == cstr_invalid)
+                equals = end;
+            ++end;
+        }
+
+        key->data = query.data + pos;
+        if (equals == cstr_invalid)
+        {
+            key->length = end - pos;
+            value->data = query.data + end;
+            value->length = 0;
+        }
+        else
+        {
+            key->length = equals - pos;
+            value->data = query.data + equals + 1;
+            value->length = end - equals - 1;
+        }
+
+        *start_pos = end;
+
+        return true;
+    }
+
+    /**
+     * @brief Compare an encoded view with plain text without decoding it
+     * @param encoded Form-encoded text (e.g. a key from cstr_query_next())
+     * @param plain   Decoded text to compare with
+     * @param size    Length of plain
+     * @return true if encoded decodes (with '+' as ' ') to exactly plain
+     */
+    bool cstr_url_equals(_In_ CStringView encoded, _In_reads_(size) const char* plain, _In_ size_t size)
+    {
+        size_t i = 0;
+        size_t j = 0;
+
+        while (i < encoded.length)
+        {
+            size_t run = cstr_url_scan_escape(encoded.data + i, encoded.length - i, true);
+            if (run > size - j || (run && memcmp(encoded.data + i, plain + j, run)))
+                return false;
+            i += run;
+            j += run;
+
+            if (i == encoded.length)
+                break;
+
+            if (j == size)
+                return false;
+
+            char c = ' ';
+            if (encoded.data[i] == '+')
+            {
+                ++i;
+            }
+            else
+            {
+                if (encoded.length - i < 3)
+                    return false;
+
+                uint8_t high = cstr_url_hex_value((uint8_t)encoded.data[i + 1]);
+                uint8_t low = cstr_url_hex_value((uint8_t)encoded.data[i + 2]);
+                if ((high | low) & 0x80)
+                    return false;
+
+                c = (char)((high << 4) | low);
+                i += 3;
+            }
+
+            if (plain[j++] != c)
+                return false;
+        }
+
+        return j == size;
+    }
+
+    /**
+     * @brief Find the first value for a key in a query string
+     * @param query Query text
+     * @param name  Decoded key to look for
+     * @param value Output view of the still-encoded value
+     * @return true if the key is present
+     */
+    bool cstr_query_find(_In_ CStringView query, _In_ const char* name, _Out_ CStringView* value)
+    {
+        if (!name || !value)
+            return false;
+
+        size_t name_length = strlen(name);
+        size_t pos = 0;
+        CStringView key;
+
+        while (cstr_query_next(query, &pos, &key, value))
+        {
+            if (cstr_url_equals(key, name, name_length))
+                return true;
+        }
+
+        return false;
+    }
+
+#endif // CSTR_IMPLEMENT_URL
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CSTR_URL_H
@@ -0,0 +1,11 @@
+/**
+ * @file cstr.c
+ * @brief Compiled definitions of cstr.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_CORE
+#include "cstr.h"
@@ -0,0 +1,11 @@
+/**
+ * @file cstr_array.c
+ * @brief Compiled definitions of cstr_array.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_ARRAY
+#include "cstr_array.h"
@@ -0,0 +1,11 @@
+/**
+ * @file cstr_art.c
+ * @brief Compiled definitions of cstr_art.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_ART
+#include "cstr_art.h"
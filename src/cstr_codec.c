@@ -0,0 +1,11 @@
+/**
+ * @file cstr_codec.c
+ * @brief Compiled definitions of cstr_codec.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_CODEC
+#include "cstr_codec.h"
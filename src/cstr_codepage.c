@@ -0,0 +1,11 @@
+/**
+ * @file cstr_codepage.c
+ * @brief Compiled definitions of cstr_codepage.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_CODEPAGE
+#include "cstr_codepage.h"
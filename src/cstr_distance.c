@@ -0,0 +1,11 @@
+/**
+ * @file cstr_distance.c
+ * @brief Compiled definitions of cstr_distance.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_DISTANCE
+#include "cstr_distance.h"
@@ -0,0 +1,11 @@
+/**
+ * @file cstr_glob.c
+ * @brief Compiled definitions of cstr_glob.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_GLOB
+#include "cstr_glob.h"
@@ -0,0 +1,11 @@
+/**
+ * @file cstr_index.c
+ * @brief Compiled definitions of cstr_index.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_INDEX
+#include "cstr_index.h"
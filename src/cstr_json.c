@@ -0,0 +1,11 @@
+/**
+ * @file cstr_json.c
+ * @brief Compiled definitions of cstr_json.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_JSON
+#include "cstr_json.h"
@@ -0,0 +1,11 @@
+/**
+ * @file cstr_ngram.c
+ * @brief Compiled definitions of cstr_ngram.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_NGRAM
+#include "cstr_ngram.h"
@@ -0,0 +1,11 @@
+/**
+ * @file cstr_regex.c
+ * @brief Compiled definitions of cstr_regex.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_REGEX
+#include "cstr_regex.h"
@@ -0,0 +1,11 @@
+/**
+ * @file cstr_sort.c
+ * @brief Compiled definitions of cstr_sort.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_SORT
+#include "cstr_sort.h"
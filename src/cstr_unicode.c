@@ -0,0 +1,11 @@
+/**
+ * @file cstr_unicode.c
+ * @brief Compiled definitions of cstr_unicode.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_UNICODE
+#include "cstr_unicode.h"
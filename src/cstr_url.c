@@ -0,0 +1,11 @@
+/**
+ * @file cstr_url.c
+ * @brief Compiled definitions of cstr_url.h for the cstr library.
+ */
+
+#ifndef CSTR_LIBRARY
+#define CSTR_LIBRARY
+#endif
+
+#define CSTR_IMPLEMENT_URL
+#include "cstr_url.h"
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Generate include/cstr_codepage_tables.h from Python's codec tables.
+
+Only the high half (0x80-0xFF) of each code page is stored; every page
+listed here is ASCII-compatible below 0x80. Bytes the code page leaves
+undefined are stored as 0.
+
+Usage: python3 tools/gen_codepages.py > include/cstr_codepage_tables.h
+"""
+
+# (Windows code page identifier, Python codec, display name)
+PAGES = [
+    (1251, "cp1251", "windows-1251"),
+    (1252, "cp1252", "windows-1252"),
+    (20866, "koi8_r", "KOI8-R"),
+    (28591, "iso8859_1", "ISO-8859-1"),
+    (28592, "iso8859_2", "ISO-8859-2"),
+    (28593, "iso8859_3", "ISO-8859-3"),
+    (28594, "iso8859_4", "ISO-8859-4"),
+    (28595, "iso8859_5", "ISO-8859-5"),
+    (28596, "iso8859_6", "ISO-8859-6"),
+    (28597, "iso8859_7", "ISO-8859-7"),
+    (28598, "iso8859_8", "ISO-8859-8"),
+    (28599, "iso8859_9", "ISO-8859-9"),
+    (28600, "iso8859_10", "ISO-8859-10"),
+    (28601, "iso8859_11", "ISO-8859-11"),
+    (28603, "iso8859_13", "ISO-8859-13"),
+    (28604, "iso8859_14", "ISO-8859-14"),
+    (28605, "iso8859_15", "ISO-8859-15"),
+    (28606, "iso8859_16", "ISO-8859-16"),
+]
+
+
+def high_half(codec):
+    table = []
+    for byte in range(0x80, 0x100):
+        try:
+            text = bytes([byte]).decode(codec)
+        except UnicodeDecodeError:
+            table.append(0)
+            continue
+        assert len(text) == 1 and ord(text) <= 0xFFFF
+        table.append(ord(text))
+    return table
+
+
+def rows(values, fmt, per_line):
+    for i in range(0, len(values), per_line):
+        yield "                " + ", ".join(fmt % v for v in values[i:i + per_line]) + ","
+
+
+def main():
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("/**")
+    out.append(" * @file cstr_codepage_tables.h")
+    out.append(" * @brief Single-byte code page tables (generated by tools/gen_codepages.py, do not edit).")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef CSTR_CODEPAGE_TABLES_H")
+    out.append("#define CSTR_CODEPAGE_TABLES_H")
+    out.append("")
+    out.append("#ifdef __cplusplus")
+    out.append('extern "C"')
+    out.append("{")
+    out.append("#endif")
+    out.append("")
+    out.append("    static const CStringCodePage cstr_codepages[] =")
+    out.append("    {")
+
+    for cp, codec, name in PAGES:
+        table = high_half(codec)
+        reverse = sorted((code, 0x80 + i) for i, code in enumerate(table) if code)
+
+        out.append("        {")
+        out.append('            %d, "%s", %d,' % (cp, name, len(reverse)))
+        out.append("            {")
+        out.extend(rows(table, "0x%04X", 8))
+        out.append("            },")
+        out.append("            {")
+        out.extend(rows([c for c, _ in reverse] + [0] * (128 - len(reverse)), "0x%04X", 8))
+        out.append("            },")
+        out.append("            {")
+        out.extend(rows([b for _, b in reverse] + [0] * (128 - len(reverse)), "0x%02X", 8))
+        out.append("            },")
+        out.append("        },")
+
+    out.append("    };")
+    out.append("")
+    out.append("#ifdef __cplusplus")
+    out.append("}")
+    out.append("#endif")
+    out.append("")
+    out.append("#endif // CSTR_CODEPAGE_TABLES_H")
+
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+"""Generate include/cstr_unicode_tables.h from Python's Unicode database.
+
+Per-code-point properties are stored as two-stage tables: the high bits of a
+code point select a block, and identical blocks are shared. Canonical
+combining class values are stored directly as bytes. Decompositions and case foldings
+are stored as offsets into a shared pool of length-prefixed code point
+sequences. Hangul syllables are handled algorithmically and are not stored.
+
+Usage: python3 tools/gen_unicode.py > include/cstr_unicode_tables.h
+"""
+
+import math
+import unicodedata
+
+SHIFT = 7
+BLOCK = 1 << SHIFT
+MAX_CODE = 0x110000
+
+
+def is_scalar(cp):
+    return not 0xD800 <= cp <= 0xDFFF
+
+
+def is_hangul_syllable(cp):
+    return 0xAC00 <= cp <= 0xD7A3
+
+
+class Pool:
+    """Length-prefixed code point sequences; offset 0 means "no mapping"."""
+
+    def __init__(self):
+        self.data = [0]
+        self.offsets = {}
+
+    def add(self, seq):
+        seq = tuple(seq)
+        if seq not in self.offsets:
+            self.offsets[seq] = len(self.data)
+            self.data.append(len(seq))
+            self.data.extend(seq)
+        return self.offsets[seq]
+
+
+def two_stage(values):
+    """Split a {code point: value} map into (limit, stage1, stage2)."""
+    limit = (max(values) // BLOCK + 1) * BLOCK if values else BLOCK
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, limit, BLOCK):
+        block = tuple(values.get(cp, 0) for cp in range(start, start + BLOCK))
+        if block not in blocks:
+            blocks[block] = len(stage2) // BLOCK
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    assert len(blocks) < 0x10000 and max(stage2) < 0x10000
+    return limit, stage1, stage2
+
+
+def utf8_length(seq):
+    return len("".join(map(chr, seq)).encode("utf-8"))
+
+
+def emit_array(out, ctype, name, values, fmt, per_line):
+    out.append("    static const %s %s[%d] =" % (ctype, name, len(values)))
+    out.append("    {")
+    for i in range(0, len(values), per_line):
+        out.append("        " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    out.append("    };")
+    out.append("")
+
+
+def main():
+    ccc = {}
+    decomp = {}
+    fold = {}
+    pool = Pool()
+    growth = 1
+
+    for cp in range(MAX_CODE):
+        if not is_scalar(cp):
+            continue
+        ch = chr(cp)
+
+        combining = unicodedata.combining(ch)
+        if combining:
+            ccc[cp] = combining
+
+        nfd = unicodedata.normalize("NFD", ch)
+        if nfd != ch and not is_hangul_syllable(cp):
+            decomp[cp] = pool.add(map(ord, nfd))
+
+        folded = ch.casefold()
+        if folded != ch:
+            fold[cp] = pool.add(map(ord, folded))
+
+        size = len(ch.encode("utf-8"))
+        for text in (nfd, unicodedata.normalize("NFC", ch), folded):
+            growth = max(growth, math.ceil(len(text.encode("utf-8")) / size))
+
+    # Primary composites: canonical pairs that survive NFC unchanged
+    compose = []
+    for cp in range(MAX_CODE):
+        if not is_scalar(cp):
+            continue
+        parts = unicodedata.decomposition(chr(cp)).split()
+        if len(parts) != 2 or parts[0].startswith("<"):
+            continue
+        if unicodedata.normalize("NFC", chr(cp)) != chr(cp):
+            continue
+        first, second = (int(p, 16) for p in parts)
+        compose.append(((first << 21) | second, cp))
+    compose.sort()
+
+    # Starters that can still combine with what precedes them
+    starters = sorted({key & 0x1FFFFF for key, _ in compose if not unicodedata.combining(chr(key & 0x1FFFFF))})
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("/**")
+    out.append(" * @file cstr_unicode_tables.h")
+    out.append(" * @brief Unicode %s property tables (generated by tools/gen_unicode.py, do not edit)." % unicodedata.unidata_version)
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef CSTR_UNICODE_TABLES_H")
+    out.append("#define CSTR_UNICODE_TABLES_H")
+    out.append("")
+    out.append('#define CSTR_UNICODE_VERSION "%s"' % unicodedata.unidata_version)
+    out.append("#define CSTR_UNICODE_BLOCK_SHIFT %d" % SHIFT)
+    out.append("#define CSTR_UNICODE_MAX_GROWTH %d" % growth)
+    out.append("")
+    out.append("#ifdef __cplusplus")
+    out.append('extern "C"')
+    out.append("{")
+    out.append("#endif")
+    out.append("")
+
+    for name, values in (("ccc", ccc), ("decomp", decomp), ("fold", fold)):
+        limit, stage1, stage2 = two_stage(values)
+        out.append("#define CSTR_UNICODE_%s_LIMIT 0x%X" % (name.upper(), limit))
+        out.append("")
+        emit_array(out, "uint16_t", "cstr_unicode_%s_index" % name, stage1, "%d", 16)
+        emit_array(out, "uint8_t" if name == "ccc" else "uint16_t", "cstr_unicode_%s_blocks" % name, stage2, "%d", 16)
+
+    emit_array(out, "uint32_t", "cstr_unicode_sequences", pool.data, "0x%X", 8)
+    emit_array(out, "uint64_t", "cstr_unicode_compose_keys", [k for k, _ in compose], "0x%XULL", 4)
+    emit_array(out, "uint32_t", "cstr_unicode_compose_values", [v for _, v in compose], "0x%X", 8)
+    emit_array(out, "uint32_t", "cstr_unicode_compose_starters", starters, "0x%X", 8)
+
+    out.append("#ifdef __cplusplus")
+    out.append("}")
+    out.append("#endif")
+    out.append("")
+    out.append("#endif // CSTR_UNICODE_TABLES_H")
+
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()